@@ -189,6 +189,40 @@ let benchmarks: @Sendable () -> Void = {
         }
     }
 
+    Benchmark(
+        "base64-encode-1MB-toData-base64URLAlphabet",
+        configuration: Benchmark.Configuration(
+            metrics: metrics,
+            scalingFactor: .one,
+            maxDuration: .seconds(3)
+        )
+    ) { benchmark in
+        for _ in benchmark.scaledIterations {
+            autoreleasepool {
+                blackHole(oneMBTestData.base64EncodedData(options: .base64URLAlphabet))
+            }
+        }
+    }
+
+    Benchmark(
+        "base64-decode-1MB-fromData-base64URLAlphabet",
+        configuration: Benchmark.Configuration(
+            metrics: metrics,
+            scalingFactor: .one,
+            maxDuration: .seconds(3)
+        )
+    ) { benchmark in
+        let base64Data = oneMBTestData.base64EncodedData(options: .base64URLAlphabet)
+
+        benchmark.startMeasurement()
+
+        for _ in benchmark.scaledIterations {
+            autoreleasepool {
+                blackHole(Data(base64Encoded: base64Data, options: .base64URLAlphabet))
+            }
+        }
+    }
+
 }
 
 let jwtHeaderTestData = Data(#"{"alg":"ES256","typ":"JWT"}"#.utf8)
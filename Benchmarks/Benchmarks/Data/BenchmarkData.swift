@@ -166,6 +166,108 @@ let benchmarks: @Sendable () -> Void = {
         })
     }
 
+    // MARK: - Growing huge data
+
+    let uploadChunk = Data(repeating: 0x2A, count: 8 * 1024 * 1024)
+    Benchmark("DataAppendHuge") { benchmark in
+        var upload = Data()
+        for _ in 0 ..< 64 {
+            upload.append(uploadChunk)
+        }
+        blackHole(upload)
+    }
+
+    // MARK: - Chunked data
+
+    // 16 frames of a 64KB payload between a small header and trailer, as in a chunked HTTP response
+    let framePayload = Data(repeating: 0x2A, count: 64 * 1024)
+    let frameHeader = Data("10000\r\n".utf8)
+    let frameTrailer = Data("\r\n".utf8)
+
+    Benchmark("DataAppendFrames") { benchmark in
+        for _ in benchmark.scaledIterations {
+            var message = Data()
+            for _ in 0 ..< 16 {
+                message.append(frameHeader)
+                message.append(framePayload)
+                message.append(frameTrailer)
+            }
+            blackHole(message)
+        }
+    }
+
+    Benchmark("ChunkedDataAppendFrames") { benchmark in
+        for _ in benchmark.scaledIterations {
+            var message = ChunkedData()
+            for _ in 0 ..< 16 {
+                message.append(frameHeader)
+                message.append(framePayload)
+                message.append(frameTrailer)
+            }
+            blackHole(message)
+        }
+    }
+
+    // MARK: - Checksums
+
+    let checksumInput = createSomeData(1024 * 1024)
+
+    Benchmark("DataCRC32C") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(checksumInput.crc32cChecksum())
+        }
+    }
+
+    Benchmark("DataXXH3") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(checksumInput.xxh3Hash())
+        }
+    }
+
+    Benchmark("DataHashValue") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(checksumInput.hashValue)
+        }
+    }
+
+    Benchmark("DataSampledHashValue") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(Data.SampledHashKey(checksumInput).hashValue)
+        }
+    }
+
+    // MARK: - Searching
+
+    // 1MB of text in which the needles only occur at the very end.
+    func createSearchHaystack() -> Data {
+        var haystack = Data(String(repeating: "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ", count: 1024 * 1024 / 57).utf8)
+        haystack.append(contentsOf: "\r\n--boundary-4f2a91c3d7e8b605a4f2a91c3d7e8b605a\r\nERROR".utf8)
+        return haystack
+    }
+
+    for needle in ["\r\n--b", "\r\n--boundary-4f2a91c3d7e8b605a4f2a91c3d7e8b605a"] {
+        let kind = needle.utf8.count > 32 ? "long" : "short"
+        let needleData = Data(needle.utf8)
+
+        Benchmark("DataRangeOf", configuration: .init(tags: ["needle": kind]), closure: { benchmark, haystack in
+            blackHole(haystack.range(of: needleData))
+        }, setup: createSearchHaystack)
+
+        Benchmark("DataRangeOf", configuration: .init(tags: ["needle": kind, "options": "backwards"]), closure: { benchmark, haystack in
+            blackHole(haystack.range(of: needleData, options: .backwards, in: 0 ..< haystack.count - 64))
+        }, setup: createSearchHaystack)
+
+        let searcher = Data.Searcher(pattern: needleData)
+        Benchmark("DataRangeOfSearcher", configuration: .init(tags: ["needle": kind]), closure: { benchmark, haystack in
+            blackHole(haystack.range(of: searcher))
+        }, setup: createSearchHaystack)
+    }
+
+    let logLevels = Data.MultiPatternSearcher(patterns: ["FATAL", "ERROR", "WARNING", "\r\n--boundary"].map { Data($0.utf8) })
+    Benchmark("DataFirstMatch", closure: { benchmark, haystack in
+        blackHole(haystack.firstMatch(of: logLevels))
+    }, setup: createSearchHaystack)
+
     Benchmark("DataFromString", closure: { benchmark, string in
         blackHole(string.data(using: .ascii))
     }, setup: { () -> String in
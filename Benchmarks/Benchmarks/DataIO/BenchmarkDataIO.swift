@@ -129,6 +129,19 @@ let benchmarks: @Sendable () -> Void = {
         blackHole(try Data(contentsOf: testPath))
     }
     
+    for (options, name) in [(Data.ReadingOptions.sequentialAccess, "sequentialAccess"), (.preferHugePages, "preferHugePages"), ([.alwaysMapped, .populateMapping], "alwaysMapped-populateMapping")] {
+        Benchmark("read-regularFile-\(name)",
+                  configuration: .init(
+                    setup: {
+                        try! data.write(to: testPath)
+                    },
+                    teardown: cleanupTestPath
+                  )
+        ) { benchmark in
+            blackHole(try Data(contentsOf: testPath, options: options))
+        }
+    }
+    
     Benchmark("read-nonExistentFile") { benchmark in
         for _ in benchmark.scaledIterations {
             blackHole(try? Data(contentsOf: nonExistentPath))
@@ -343,6 +343,27 @@ func calendarBenchmarks() {
         }
     }
 
+    // Log timestamps: many per day, rising monotonically
+    let risingTimestamps = (0 ..< 10_000).map { Date(timeIntervalSince1970: 1700000000 + Double($0) * 17.3) }
+    var pacificCalendar = Calendar(identifier: .gregorian)
+    pacificCalendar.timeZone = TimeZone(identifier: "America/Los_Angeles")!
+
+    Benchmark("GregorianCalendar-dateComponents-risingTimestamps", configuration: .init(scalingFactor: .mega)) { benchmark in
+        for date in risingTimestamps {
+            let dc = pacificCalendar.dateComponents([.year, .month, .day, .hour, .minute, .second, .nanosecond], from: date)
+            blackHole(dc)
+        }
+    }
+
+    let risingTimestampComponents = risingTimestamps.map { pacificCalendar.dateComponents([.year, .month, .day, .hour, .minute, .second], from: $0) }
+
+    Benchmark("GregorianCalendar-date-from-DateComponents-risingTimestamps", configuration: .init(scalingFactor: .mega)) { benchmark in
+        for components in risingTimestampComponents {
+            let date = pacificCalendar.date(from: components)
+            blackHole(date)
+        }
+    }
+
     // MARK: - Current calendar
 
     let testDateComponents_ymd = {
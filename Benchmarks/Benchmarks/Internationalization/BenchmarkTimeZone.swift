@@ -12,6 +12,7 @@
 
 import Benchmark
 import func Benchmark.blackHole
+import Dispatch
 
 #if os(macOS) && USE_PACKAGE
 import FoundationEssentials
@@ -184,5 +185,15 @@ func timeZoneBenchmarks() {
             blackHole(isDST)
         }
     }
+
+    // Formatting dates on many threads at once looks up offsets in the same time zone concurrently
+    Benchmark("PacificTime-secondsFromGMT-concurrent", configuration: PacificTimeConfiguration) { benchmark in
+        DispatchQueue.concurrentPerform(iterations: 8) { _ in
+            for d in testDates {
+                let secondsFromGMT = pacificTime.secondsFromGMT(for: d)
+                blackHole(secondsFromGMT)
+            }
+        }
+    }
 }
 
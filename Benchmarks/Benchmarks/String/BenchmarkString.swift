@@ -198,4 +198,49 @@ let benchmarks: @Sendable () -> Void = {
         }
     }
 
+    // MARK: - Case insensitive comparison
+
+    let mixedCaseLargeStr = asciiLargeStr.uppercased()
+
+    Benchmark("caseInsensitiveCompare") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(asciiLargeStr.caseInsensitiveCompare(mixedCaseLargeStr))
+        }
+    }
+
+    Benchmark("range-caseInsensitive") { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(asciiLargeStr.range(of: "XYZABCDEFGHIJKLMNOPQRTUVWXYZ!", options: .caseInsensitive))
+        }
+    }
+
+    let logLines = (0 ..< 10_000).map { "2026-01-01T00:00:\($0 % 60)Z worker-\($0 % 16) request \($0) completed in \($0 % 977)ms" }
+    let timeoutSearcher = String.Searcher(pattern: "Connection Timed Out", options: .caseInsensitive)
+
+    Benchmark("range-searcher") { benchmark in
+        for _ in benchmark.scaledIterations {
+            for line in logLines {
+                blackHole(line.contains(timeoutSearcher))
+            }
+        }
+    }
+
+    // MARK: - Lines
+
+    let logText = logLines.joined(separator: "\n")
+
+    Benchmark("lines") { benchmark in
+        for _ in benchmark.scaledIterations {
+            for line in logText.lines {
+                blackHole(line)
+            }
+        }
+    }
+
+    Benchmark("lineRange") { benchmark in
+        let middle = logText.index(logText.startIndex, offsetBy: logText.utf8.count / 2)
+        for _ in benchmark.scaledIterations {
+            blackHole(logText.lineRange(for: middle ..< middle))
+        }
+    }
 }
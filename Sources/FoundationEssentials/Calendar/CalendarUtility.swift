@@ -103,6 +103,9 @@ internal enum _CalendarUtility {
     /// Rata die of the Foundation reference date (2001-01-01 == RD 730486).
     static let rataDieAtDateReference = 730_486
 
+    /// Rata die of 1970-01-01, the offset between rata die and `daysSince1970(year:month:day:)`.
+    static let rataDieAt1970 = 719_163
+
     /// Floor division rounding toward negative infinity for any sign of divisor.
     static func floorDiv<I: FixedWidthInteger>(_ a: I, _ b: I) -> I {
         if (a >= 0) == (b > 0) {
@@ -112,6 +115,29 @@ internal enum _CalendarUtility {
         }
     }
 
+    /// Days since 1970-01-01 of a proleptic Gregorian date, from http://howardhinnant.github.io/date_algorithms.html
+    static func daysSince1970(year: Int64, month: Int64, day: Int64) -> Int64 {
+        let y = month <= 2 ? year - 1 : year
+        let era = (y >= 0 ? y : y - 399) / 400
+        let yearOfEra = y - era * 400
+        let dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1
+        let dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear
+        return era * 146097 + dayOfEra - 719468
+    }
+
+    /// The proleptic Gregorian date of a number of days since 1970-01-01. The inverse of `daysSince1970(year:month:day:)`.
+    static func civilDate(daysSince1970 days: Int64) -> (year: Int64, month: Int64, day: Int64) {
+        let z = days + 719468
+        let era = (z >= 0 ? z : z - 146096) / 146097
+        let dayOfEra = z - era * 146097
+        let yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365
+        let dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100)
+        let mp = (5 * dayOfYear + 2) / 153
+        let day = dayOfYear - (153 * mp + 2) / 5 + 1
+        let month = mp < 10 ? mp + 3 : mp - 9
+        return (yearOfEra + era * 400 + (month <= 2 ? 1 : 0), month, day)
+    }
+
     /// Splits local-seconds-since-reference into a fixed-day rata die and the seconds within that day.
     static func rataDieAndSecondsInDay<I: FixedWidthInteger>(localSeconds: Double) -> (rataDie: I, secondsInDay: Double) {
         let totalDays = (localSeconds / 86400).rounded(.down)
@@ -120,6 +120,23 @@ internal final class _CalendarAutoupdating: _CalendarProtocol, @unchecked Sendab
     func dateComponents(_ components: Calendar.ComponentSet, from start: Date, to end: Date) -> DateComponents {
         CalendarCache.cache.current.dateComponents(components, from: start, to: end)
     }
+
+    @available(FoundationPreview 6.5, *)
+    func dateComponents(_ components: Calendar.ComponentSet, from dates: UnsafeBufferPointer<Date>, in timeZone: TimeZone, appendingTo columns: inout Calendar.ComponentColumns) {
+        CalendarCache.cache.current.dateComponents(components, from: dates, in: timeZone, appendingTo: &columns)
+    }
+
+    func nextExactDate(after date: Date, matching components: DateComponents, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        CalendarCache.cache.current.nextExactDate(after: date, matching: components, repeatedTimePolicy: repeatedTimePolicy, direction: direction)
+    }
+
+    func exactDate(_ n: Int, matching components: DateComponents, after date: Date, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        CalendarCache.cache.current.exactDate(n, matching: components, after: date, repeatedTimePolicy: repeatedTimePolicy, direction: direction)
+    }
+
+    func numberOfExactDates(matching components: DateComponents, in range: Range<Date>, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Int? {
+        CalendarCache.cache.current.numberOfExactDates(matching: components, in: range, repeatedTimePolicy: repeatedTimePolicy)
+    }
     
 #if FOUNDATION_FRAMEWORK
     func bridgeToNSCalendar() -> NSCalendar {
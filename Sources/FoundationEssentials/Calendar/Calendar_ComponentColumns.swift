@@ -0,0 +1,272 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+@available(FoundationPreview 6.5, *)
+extension Calendar {
+    /// The components of many dates, stored as one array per component.
+    ///
+    /// Element `i` of each array belongs to the `i`th date. Arrays of components that were not requested are left unchanged. A component that the calendar can not compute for a date is `Int.max`.
+    public struct ComponentColumns : Hashable, Sendable {
+        public var era: [Int] = []
+        public var year: [Int] = []
+        public var month: [Int] = []
+        public var day: [Int] = []
+        public var hour: [Int] = []
+        public var minute: [Int] = []
+        public var second: [Int] = []
+        public var nanosecond: [Int] = []
+        public var weekday: [Int] = []
+        public var weekdayOrdinal: [Int] = []
+        public var quarter: [Int] = []
+        public var weekOfMonth: [Int] = []
+        public var weekOfYear: [Int] = []
+        public var yearForWeekOfYear: [Int] = []
+        public var dayOfYear: [Int] = []
+
+        public init() {
+        }
+
+        /// The components that have a column
+        static let components: ComponentSet = [.era, .year, .month, .day, .hour, .minute, .second, .nanosecond, .weekday, .weekdayOrdinal, .quarter, .weekOfMonth, .weekOfYear, .yearForWeekOfYear, .dayOfYear]
+
+        /// Removes the components of all dates, optionally keeping the capacity of the arrays so that they can be filled again without allocating.
+        public mutating func removeAll(keepingCapacity keepCapacity: Bool = false) {
+            era.removeAll(keepingCapacity: keepCapacity)
+            year.removeAll(keepingCapacity: keepCapacity)
+            month.removeAll(keepingCapacity: keepCapacity)
+            day.removeAll(keepingCapacity: keepCapacity)
+            hour.removeAll(keepingCapacity: keepCapacity)
+            minute.removeAll(keepingCapacity: keepCapacity)
+            second.removeAll(keepingCapacity: keepCapacity)
+            nanosecond.removeAll(keepingCapacity: keepCapacity)
+            weekday.removeAll(keepingCapacity: keepCapacity)
+            weekdayOrdinal.removeAll(keepingCapacity: keepCapacity)
+            quarter.removeAll(keepingCapacity: keepCapacity)
+            weekOfMonth.removeAll(keepingCapacity: keepCapacity)
+            weekOfYear.removeAll(keepingCapacity: keepCapacity)
+            yearForWeekOfYear.removeAll(keepingCapacity: keepCapacity)
+            dayOfYear.removeAll(keepingCapacity: keepCapacity)
+        }
+
+        mutating func reserveCapacity(adding count: Int, for components: ComponentSet) {
+            func reserve(_ array: inout [Int], _ component: ComponentSet) {
+                if components.contains(component) { array.reserveCapacity(array.count + count) }
+            }
+            reserve(&era, .era)
+            reserve(&year, .year)
+            reserve(&month, .month)
+            reserve(&day, .day)
+            reserve(&hour, .hour)
+            reserve(&minute, .minute)
+            reserve(&second, .second)
+            reserve(&nanosecond, .nanosecond)
+            reserve(&weekday, .weekday)
+            reserve(&weekdayOrdinal, .weekdayOrdinal)
+            reserve(&quarter, .quarter)
+            reserve(&weekOfMonth, .weekOfMonth)
+            reserve(&weekOfYear, .weekOfYear)
+            reserve(&yearForWeekOfYear, .yearForWeekOfYear)
+            reserve(&dayOfYear, .dayOfYear)
+        }
+
+        mutating func append(_ dc: DateComponents, for components: ComponentSet) {
+            if components.contains(.era) { era.append(dc.era ?? .max) }
+            if components.contains(.year) { year.append(dc.year ?? .max) }
+            if components.contains(.month) { month.append(dc.month ?? .max) }
+            if components.contains(.day) { day.append(dc.day ?? .max) }
+            if components.contains(.hour) { hour.append(dc.hour ?? .max) }
+            if components.contains(.minute) { minute.append(dc.minute ?? .max) }
+            if components.contains(.second) { second.append(dc.second ?? .max) }
+            if components.contains(.nanosecond) { nanosecond.append(dc.nanosecond ?? .max) }
+            if components.contains(.weekday) { weekday.append(dc.weekday ?? .max) }
+            if components.contains(.weekdayOrdinal) { weekdayOrdinal.append(dc.weekdayOrdinal ?? .max) }
+            if components.contains(.quarter) { quarter.append(dc.quarter ?? .max) }
+            if components.contains(.weekOfMonth) { weekOfMonth.append(dc.weekOfMonth ?? .max) }
+            if components.contains(.weekOfYear) { weekOfYear.append(dc.weekOfYear ?? .max) }
+            if components.contains(.yearForWeekOfYear) { yearForWeekOfYear.append(dc.yearForWeekOfYear ?? .max) }
+            if components.contains(.dayOfYear) { dayOfYear.append(dc.dayOfYear ?? .max) }
+        }
+    }
+
+    /// Appends the requested components of each date to `columns`, using the calendar's time zone.
+    ///
+    /// The result is the same as calling `dateComponents(_:from:)` for each date, but this is much faster for large numbers of dates, especially when they are in ascending order. The `calendar`, `timeZone`, `isLeapMonth` and `isRepeatedDay` components are ignored.
+    ///
+    /// - parameter components: The components to compute.
+    /// - parameter dates: The dates to compute the components of.
+    /// - parameter columns: The arrays to append the components to.
+    public func dateComponents(_ components: Set<Component>, from dates: some Collection<Date>, appendingTo columns: inout ComponentColumns) {
+        let componentSet = ComponentSet(components).intersection(ComponentColumns.components)
+        guard !componentSet.isEmpty else { return }
+
+        let timeZone = self.timeZone
+        let done: Void? = dates.withContiguousStorageIfAvailable {
+            _calendar.dateComponents(componentSet, from: $0, in: timeZone, appendingTo: &columns)
+        }
+        if done == nil {
+            Array(dates).withUnsafeBufferPointer {
+                _calendar.dateComponents(componentSet, from: $0, in: timeZone, appendingTo: &columns)
+            }
+        }
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension _CalendarProtocol {
+    package func dateComponents(_ components: Calendar.ComponentSet, from dates: UnsafeBufferPointer<Date>, in timeZone: TimeZone, appendingTo columns: inout Calendar.ComponentColumns) {
+        columns.reserveCapacity(adding: dates.count, for: components)
+        for date in dates {
+            columns.append(dateComponents(components, from: date.capped, in: timeZone), for: components)
+        }
+    }
+}
+
+/// Returns the offset from GMT of each date, reusing the offset of the previous date while the dates ascend within the same period between two time zone transitions.
+private struct _AscendingOffsetCache {
+    let timeZone: TimeZone
+    private var period: Range<Date>?
+    private var offset = 0
+    private var previous: Date?
+
+    init(timeZone: TimeZone) {
+        self.timeZone = timeZone
+    }
+
+    mutating func secondsFromGMT(for date: Date) -> Int {
+        defer { previous = date }
+        if let period, period.contains(date) {
+            return offset
+        }
+
+        let offset = timeZone.secondsFromGMT(for: date)
+        // Only look for the end of the period once the dates are ascending; for unordered dates it would be wasted work
+        if let previous, previous <= date {
+            let next = timeZone.nextDaylightSavingTimeTransition(after: date) ?? .distantFuture
+            if next > date {
+                self.period = date ..< next
+                self.offset = offset
+            }
+        }
+        return offset
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension _CalendarGregorian {
+    /// The components that the columnar conversion computes itself. Week of year and year for week of year go through `dateComponents(_:from:in:)` one date at a time.
+    static let columnComponents: Calendar.ComponentSet = [.era, .year, .month, .day, .hour, .minute, .second, .nanosecond, .weekday, .weekdayOrdinal, .quarter, .weekOfMonth, .dayOfYear]
+
+    package func dateComponents(_ components: Calendar.ComponentSet, from dates: UnsafeBufferPointer<Date>, in timeZone: TimeZone, appendingTo columns: inout Calendar.ComponentColumns) {
+        columns.reserveCapacity(adding: dates.count, for: components)
+        guard components.isSubset(of: Self.columnComponents) else {
+            for date in dates {
+                columns.append(dateComponents(components, from: date.capped, in: timeZone), for: components)
+            }
+            return
+        }
+
+        let daysBeforeMonthNonLeap = [0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334]
+        let daysBeforeMonthLeap =    [0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335]
+
+        let chunkSize = 256
+        // Seconds since 1970 in local time, rounded down, and the fraction of the second in nanoseconds
+        var localSeconds = [Int](repeating: 0, count: chunkSize)
+        var nanoseconds = [Int](repeating: 0, count: chunkSize)
+        // Days since 1970 in local time, and the year, month and day of each
+        let storage = UnsafeMutableBufferPointer<Int32>.allocate(capacity: 4 * chunkSize)
+        storage.initialize(repeating: 0)
+        defer { storage.deallocate() }
+        let days = UnsafeMutableBufferPointer(rebasing: storage[0 ..< chunkSize])
+        let years = UnsafeMutableBufferPointer(rebasing: storage[chunkSize ..< 2 * chunkSize])
+        let months = UnsafeMutableBufferPointer(rebasing: storage[2 * chunkSize ..< 3 * chunkSize])
+        let daysOfMonth = UnsafeMutableBufferPointer(rebasing: storage[3 * chunkSize ..< 4 * chunkSize])
+
+        var offsets = _AscendingOffsetCache(timeZone: timeZone)
+        var chunkStart = 0
+        while chunkStart < dates.count {
+            let chunk = chunkStart ..< min(chunkStart + chunkSize, dates.count)
+            let count = chunk.count
+
+            // Local time of each date, as in `_dateComponents(_:from:in:)`. Dates that are not finite are marked with `Int.min` and handled one at a time below.
+            for i in 0 ..< count {
+                let date = dates[chunk.lowerBound + i].capped
+                let localTime = date.timeIntervalSinceReferenceDate + Double(offsets.secondsFromGMT(for: date))
+                let roundedDown = localTime.rounded(.down)
+                guard roundedDown.isFinite else {
+                    localSeconds[i] = .min
+                    days[i] = 0
+                    continue
+                }
+                nanoseconds[i] = Int((localTime - roundedDown) * 1_000_000_000)
+                localSeconds[i] = Int(roundedDown) + Int(Date.timeIntervalBetween1970AndReferenceDate)
+                // Floor division; capped dates are within ±2^31 days
+                let seconds = localSeconds[i]
+                days[i] = Int32((seconds >= 0 ? seconds : seconds - 86399) / 86400)
+            }
+
+            // Proleptic Gregorian year, month and day from days since 1970. This has no branches or table lookups so that the optimizer can vectorize it.
+            for i in 0 ..< count {
+                let z = days[i] &+ 719468 // Days since 0000-03-01
+                let era = (z >= 0 ? z : z &- 146096) / 146097
+                let dayOfEra = z &- era &* 146097 // 0...146096
+                let yearOfEra = (dayOfEra &- dayOfEra / 1460 &+ dayOfEra / 36524 &- dayOfEra / 146096) / 365 // 0...399
+                let dayOfMarchYear = dayOfEra &- (365 &* yearOfEra &+ yearOfEra / 4 &- yearOfEra / 100) // 0...365, counting from March 1
+                let marchMonth = (5 &* dayOfMarchYear &+ 2) / 153 // 0...11, counting from March
+                let month = marchMonth < 10 ? marchMonth &+ 3 : marchMonth &- 9
+                daysOfMonth[i] = dayOfMarchYear &- (153 &* marchMonth &+ 2) / 5 &+ 1
+                months[i] = month
+                years[i] = yearOfEra &+ era &* 400 &+ (month <= 2 ? 1 : 0)
+            }
+
+            for i in 0 ..< count {
+                let year = Int(years[i])
+                // Dates up to the end of the year of the Gregorian cutover need its special cases, as do dates that are not finite
+                guard localSeconds[i] != .min, year > gregorianStartYear else {
+                    columns.append(dateComponents(components, from: dates[chunk.lowerBound + i].capped, in: timeZone), for: components)
+                    continue
+                }
+
+                let month = Int(months[i])
+                let day = Int(daysOfMonth[i])
+                let secondsInDay = localSeconds[i] - Int(days[i]) * 86400
+                let isLeapYear = gregorianYearIsLeap(year)
+                let dayOfYear = (isLeapYear ? daysBeforeMonthLeap : daysBeforeMonthNonLeap)[month - 1] + day
+                // 1-based, from the julian day as in `_dateComponents(_:from:in:)`
+                let weekday = (Int(days[i]) + 2440588 + 1) % 7
+                let dcWeekday = (weekday < 0 ? weekday + 7 : weekday) + 1
+
+                if components.contains(.era) { columns.era.append(year < 1 ? 0 : 1) }
+                if components.contains(.year) { columns.year.append(year < 1 ? 1 - year : year) }
+                if components.contains(.month) { columns.month.append(month) }
+                if components.contains(.day) { columns.day.append(day) }
+                if components.contains(.hour) { columns.hour.append(secondsInDay / 3600) }
+                if components.contains(.minute) { columns.minute.append(secondsInDay % 3600 / 60) }
+                if components.contains(.second) { columns.second.append(secondsInDay % 60) }
+                if components.contains(.nanosecond) { columns.nanosecond.append(nanoseconds[i]) }
+                if components.contains(.weekday) { columns.weekday.append(dcWeekday) }
+                if components.contains(.weekdayOrdinal) { columns.weekdayOrdinal.append((day - 1) / 7 + 1) }
+                if components.contains(.quarter) {
+                    let quarter = if !isLeapYear {
+                        dayOfYear < 90 ? 1 : dayOfYear < 181 ? 2 : dayOfYear < 273 ? 3 : 4
+                    } else {
+                        dayOfYear < 91 ? 1 : dayOfYear < 182 ? 2 : dayOfYear < 274 ? 3 : 4
+                    }
+                    columns.quarter.append(quarter)
+                }
+                if components.contains(.weekOfMonth) { columns.weekOfMonth.append(weekNumber(desiredDay: day, dayOfPeriod: day, weekday: dcWeekday)) }
+                if components.contains(.dayOfYear) { columns.dayOfYear.append(dayOfYear) }
+            }
+
+            chunkStart = chunk.upperBound
+        }
+    }
+}
@@ -472,12 +472,14 @@ extension Calendar {
         var newSearchDate: Date
     }
 
+    /// - parameter computingExactMatches: Whether `.strict` matches may be computed directly by the calendar, rather than found by the search below. Turning this off gives the results of the search alone.
     internal func _enumerateDates(startingAfter start: Date,
                                   previouslyReturnedMatchDate: Date? = nil,
                                   matching matchingComponents: DateComponents,
                                   matchingPolicy: MatchingPolicy,
                                   repeatedTimePolicy: RepeatedTimePolicy,
                                   direction: SearchDirection,
+                                  computingExactMatches: Bool = true,
                                   using block: (_ result: Date?, _ exactMatch: Bool, _ stop: inout Bool) -> Void) {
         guard matchingComponents._validate(for: self) else {
             return
@@ -496,7 +498,7 @@ extension Calendar {
         repeat {
             iterations += 1
             do {
-                let result = try _enumerateDatesStep(startingAfter: start, matching: matchingComponents, matchingPolicy: matchingPolicy, repeatedTimePolicy: repeatedTimePolicy, direction: direction, inSearchingDate: searchingDate, previouslyReturnedMatchDate: previouslyReturnedMatchDate)
+                let result = try _enumerateDatesStep(startingAfter: start, matching: matchingComponents, matchingPolicy: matchingPolicy, repeatedTimePolicy: repeatedTimePolicy, direction: direction, inSearchingDate: searchingDate, previouslyReturnedMatchDate: previouslyReturnedMatchDate, computingExactMatches: computingExactMatches)
                 
                 searchingDate = result.newSearchDate
                 
@@ -532,7 +534,8 @@ extension Calendar {
                                          repeatedTimePolicy: RepeatedTimePolicy,
                                          direction: SearchDirection,
                                          inSearchingDate searchingDate: Date,
-                                         previouslyReturnedMatchDate: Date?) throws -> SearchStepResult {
+                                         previouslyReturnedMatchDate: Date?,
+                                         computingExactMatches: Bool = true) throws -> SearchStepResult {
 
         // Fast-path: ask the calendar directly.
         if _supportsNextDateFastPath(for: matchingComponents._populatedComponentSet) && matchingPolicy == .nextTime && repeatedTimePolicy == .first {
@@ -542,6 +545,11 @@ extension Calendar {
             return SearchStepResult(result: nil, newSearchDate: searchingDate)
         }
 
+        // Exact matches: the calendar may jump straight to the next day that matches, skipping sparse candidates such as February 29 or the 31st without visiting the dates in between.
+        if matchingPolicy == .strict, computingExactMatches, let exact = _calendar.nextExactDate(after: searchingDate, matching: matchingComponents, repeatedTimePolicy: repeatedTimePolicy, direction: direction) {
+            return SearchStepResult(result: (exact, true), newSearchDate: exact)
+        }
+
         // Step A: Call helper method that does the searching
 
         /* Note: The reasoning behind this is a bit difficult to immediately grok because it's not obvious but what it does is ensure that the algorithm enumerates through each year or month if they are not explicitly set in the DateComponents passed in by the caller.  This only applies to cases where the highest set unit is month or day (at least for now).
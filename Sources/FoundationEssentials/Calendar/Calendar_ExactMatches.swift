@@ -0,0 +1,401 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+@available(FoundationPreview 6.5, *)
+extension Calendar {
+    /// Returns the `n`th date after `start` which exactly matches the given components.
+    ///
+    /// The result is the `n`th date of `dates(byMatching:startingAt:in:matchingPolicy:repeatedTimePolicy:direction:)` with the `.strict` matching policy. Some calendars compute it without visiting the earlier matches; the Gregorian calendar does so for a time of day on days given by a month, a day, a weekday and a weekday ordinal, such as February 29, the 31st, the second Tuesday of each month or Friday the 13th.
+    /// - parameter n: Which match to return. The first match after `start` is `1`.
+    /// - parameter components: The components to search for.
+    /// - parameter start: The date to start the search after.
+    /// - parameter repeatedTimePolicy: Determines which of the dates to return when the components name a time that occurs twice on a particular day.
+    /// - parameter direction: Which direction in time to search. The default value is `.forward`, which means later in time.
+    /// - returns: The `n`th matching date, or `nil` if there are fewer than `n` matches or `n` is less than `1`.
+    public func date(_ n: Int, matching components: DateComponents, startingAfter start: Date, repeatedTimePolicy: RepeatedTimePolicy = .first, direction: SearchDirection = .forward) -> Date? {
+        guard n >= 1 else { return nil }
+        if let result = _calendar.exactDate(n, matching: components, after: start, repeatedTimePolicy: repeatedTimePolicy, direction: direction) {
+            return result
+        }
+
+        var count = 0
+        var result: Date?
+        enumerateDates(startingAfter: start, matching: components, matchingPolicy: .strict, repeatedTimePolicy: repeatedTimePolicy, direction: direction) { date, _, stop in
+            count += 1
+            if date == nil || count == n {
+                result = date
+                stop = true
+            }
+        }
+        return result
+    }
+
+    /// Returns the number of dates in `range` which exactly match the given components.
+    ///
+    /// The result is the number of dates of `dates(byMatching:startingAt:in:matchingPolicy:repeatedTimePolicy:direction:)` in `range` with the `.strict` matching policy, including a match at `range.lowerBound`. For the patterns that `date(_:matching:startingAfter:repeatedTimePolicy:direction:)` computes directly, the count takes time proportional to the number of time zone transitions in `range` rather than the number of matches.
+    /// - parameter components: The components to search for.
+    /// - parameter range: The range of dates to count matches in.
+    /// - parameter repeatedTimePolicy: Determines which of the dates to count when the components name a time that occurs twice on a particular day.
+    /// - returns: The number of matching dates in `range`.
+    public func numberOfDates(matching components: DateComponents, in range: Range<Date>, repeatedTimePolicy: RepeatedTimePolicy = .first) -> Int {
+        guard !range.isEmpty else { return 0 }
+        if let count = _calendar.numberOfExactDates(matching: components, in: range, repeatedTimePolicy: repeatedTimePolicy) {
+            return count
+        }
+
+        let start = Date(timeIntervalSinceReferenceDate: range.lowerBound.timeIntervalSinceReferenceDate.nextDown)
+        var count = 0
+        for _ in DatesByMatching(calendar: self, start: start, range: range, matchingComponents: components, matchingPolicy: .strict, repeatedTimePolicy: repeatedTimePolicy) {
+            count += 1
+        }
+        return count
+    }
+}
+
+/// The local days on which `.strict` matches of some date components fall in the proleptic Gregorian calendar, and the time of day of the matches.
+///
+/// Only a time of day on days given by a month, a day, a weekday and a weekday ordinal is described. Other components, and combinations whose meaning depends on the week rules of the calendar, are left to the search in `Calendar_Enumerate.swift`. Days are rata die: day 1 is January 1 of year 1.
+struct _GregorianMatchPattern : Hashable, Sendable {
+    let month: Int?
+    let day: Int?
+    let weekday: Int?
+    let weekdayOrdinal: Int?
+    let secondsInDay: Double
+    /// Whether an hour is given. Without one, a match is at the start of its day, which is not midnight when a time zone transition skips midnight.
+    let hasTimeOfDay: Bool
+
+    init?(_ components: DateComponents) {
+        guard components.era == nil, components.year == nil, components.quarter == nil, components.weekOfMonth == nil, components.weekOfYear == nil, components.yearForWeekOfYear == nil, components.dayOfYear == nil, components.isLeapMonth == nil, components.isRepeatedDay == nil else {
+            return nil
+        }
+
+        let (month, day, weekday, weekdayOrdinal) = (components.month, components.day, components.weekday, components.weekdayOrdinal)
+        if let month, !(1...12).contains(month) { return nil }
+        if let day, !(1...31).contains(day) { return nil }
+        if let weekday, !(1...7).contains(weekday) { return nil }
+        if let weekdayOrdinal {
+            // Only the nth weekday of a month, counting from its start
+            guard (1...5).contains(weekdayOrdinal), weekday != nil, day == nil else { return nil }
+        }
+        // Every such weekday of a month is more than one match a month
+        if month != nil, weekday != nil, day == nil, weekdayOrdinal == nil { return nil }
+
+        // Smaller components than the largest one that is set default to their minimum. A gap in the time of day is left to the search.
+        let (hour, minute, second, nanosecond) = (components.hour, components.minute, components.second, components.nanosecond)
+        guard minute == nil || hour != nil, second == nil || minute != nil, nanosecond == nil || second != nil else { return nil }
+        guard month != nil || day != nil || weekday != nil || hour != nil else { return nil }
+        if let hour, !(0..<24).contains(hour) { return nil }
+        if let minute, !(0..<60).contains(minute) { return nil }
+        if let second, !(0..<60).contains(second) { return nil }
+        if let nanosecond, !(0..<1_000_000_000).contains(nanosecond) { return nil }
+
+        self.month = month
+        self.day = day
+        self.weekday = weekday
+        self.weekdayOrdinal = weekdayOrdinal
+        hasTimeOfDay = hour != nil
+        secondsInDay = Double(hour ?? 0) * 3600 + Double(minute ?? 0) * 60 + Double(second ?? 0) + Double(nanosecond ?? 0) / 1_000_000_000
+    }
+
+    // MARK: - Day arithmetic
+
+    static func rataDie(year: Int, month: Int, day: Int) -> Int {
+        Int(_CalendarUtility.daysSince1970(year: Int64(year), month: Int64(month), day: Int64(day))) + _CalendarUtility.rataDieAt1970
+    }
+
+    static func yearMonthDay(fromRataDie rataDie: Int) -> (year: Int, month: Int, day: Int) {
+        let date = _CalendarUtility.civilDate(daysSince1970: Int64(rataDie - _CalendarUtility.rataDieAt1970))
+        return (Int(date.year), Int(date.month), Int(date.day))
+    }
+
+    /// 1 is Sunday. Day 1 is a Monday.
+    static func weekday(ofRataDie rataDie: Int) -> Int {
+        rataDie - _CalendarUtility.floorDiv(rataDie, 7) * 7 + 1
+    }
+
+    static func daysInMonth(_ month: Int, year: Int) -> Int {
+        switch month {
+        case 2:
+            _CalendarGregorian.isLeapYear(year) ? 29 : 28
+        case 4, 6, 9, 11:
+            30
+        default:
+            31
+        }
+    }
+
+    /// The first leap year after `year`, or the last one before it.
+    static func leapYear(after year: Int, forward: Bool) -> Int {
+        let candidate = forward ? (_CalendarUtility.floorDiv(year, 4) + 1) * 4 : _CalendarUtility.floorDiv(year - 1, 4) * 4
+        // Century years are only leap years every 400 years, and the next multiple of four never is another century
+        if !_CalendarGregorian.isLeapYear(candidate) {
+            return forward ? candidate + 4 : candidate - 4
+        }
+        return candidate
+    }
+
+    // MARK: - Matching days
+
+    /// The matching day of `month` in `year` which is on or after the day of the month `bound`, or on or before it when searching backward. There is at most one.
+    func dayOfMonth(year: Int, month: Int, from bound: Int, forward: Bool) -> Int? {
+        let daysInMonth = Self.daysInMonth(month, year: year)
+        let candidate: Int
+        if let day {
+            candidate = day
+        } else if let weekday, let weekdayOrdinal {
+            // The nth weekday of the month is n - 1 weeks after the first one
+            let firstWeekday = Self.weekday(ofRataDie: Self.rataDie(year: year, month: month, day: 1))
+            let first = 1 + (weekday - firstWeekday + 7) % 7
+            candidate = first + 7 * (weekdayOrdinal - 1)
+        } else {
+            // A month alone matches its first day
+            candidate = 1
+        }
+
+        guard candidate <= daysInMonth, forward ? candidate >= bound : candidate <= bound else {
+            return nil
+        }
+        if day != nil, let weekday, Self.weekday(ofRataDie: Self.rataDie(year: year, month: month, day: candidate)) != weekday {
+            return nil
+        }
+        return candidate
+    }
+
+    /// The first matching day on or after `rataDie`, or the last one on or before it when searching backward. Returns nil if the pattern never matches.
+    func firstDay(from rataDie: Int, forward: Bool) -> Int? {
+        if month == nil && day == nil && weekdayOrdinal == nil {
+            // Every day, or every week
+            guard let weekday else { return rataDie }
+            let currentWeekday = Self.weekday(ofRataDie: rataDie)
+            return forward ? rataDie + (weekday - currentWeekday + 7) % 7 : rataDie - (currentWeekday - weekday + 7) % 7
+        }
+
+        var (year, month, bound) = Self.yearMonthDay(fromRataDie: rataDie)
+        if let targetMonth = self.month, targetMonth != month {
+            if forward != (targetMonth > month) {
+                year += forward ? 1 : -1
+            }
+            month = targetMonth
+            bound = forward ? 1 : 31
+        }
+
+        // The calendar repeats every 400 years, so a pattern without a match in 4800 months never matches
+        for _ in 0 ..< 4801 {
+            if let day = dayOfMonth(year: year, month: month, from: bound, forward: forward) {
+                return Self.rataDie(year: year, month: month, day: day)
+            }
+            if self.month != nil {
+                // February 29 only exists in leap years; jump straight to the next one
+                year = month == 2 && day == 29 ? Self.leapYear(after: year, forward: forward) : year + (forward ? 1 : -1)
+            } else if forward {
+                // A month with fewer days than `day` is followed by one with enough within two months
+                (year, month) = month == 12 ? (year + 1, 1) : (year, month + 1)
+            } else {
+                (year, month) = month == 1 ? (year - 1, 12) : (year, month - 1)
+            }
+            bound = forward ? 1 : 31
+        }
+        return nil
+    }
+
+    func matches(rataDie: Int) -> Bool {
+        firstDay(from: rataDie, forward: true) == rataDie
+    }
+
+    /// The matching days, as a pattern that repeats every `period` days: day `origin + k * period + offsets[i]` matches for every `k` and `i`.
+    struct Repetition {
+        let origin: Int
+        let period: Int
+        /// Ascending, and within `0 ..< period`.
+        let offsets: [Int]
+
+        /// The number of matching days from `origin` through `rataDie`. This is negative, or zero, for days before `origin`.
+        func count(through rataDie: Int) -> Int {
+            let cycle = _CalendarUtility.floorDiv(rataDie - origin, period)
+            let offset = rataDie - origin - cycle * period
+            // The number of offsets not greater than `offset`
+            var low = 0
+            var high = offsets.count
+            while low < high {
+                let middle = (low + high) / 2
+                if offsets[middle] <= offset {
+                    low = middle + 1
+                } else {
+                    high = middle
+                }
+            }
+            return cycle * offsets.count + low
+        }
+
+        /// The matching day with the given index, such that `count(through: day(at: index)) == index + 1`.
+        func day(at index: Int) -> Int {
+            let cycle = _CalendarUtility.floorDiv(index, offsets.count)
+            return origin + cycle * period + offsets[index - cycle * offsets.count]
+        }
+    }
+
+    /// Returns nil if the pattern never matches.
+    var repetition: Repetition? {
+        if month == nil && day == nil && weekdayOrdinal == nil {
+            guard let weekday else { return Repetition(origin: 0, period: 1, offsets: [0]) }
+            return Repetition(origin: 0, period: 7, offsets: [weekday - 1])
+        }
+
+        // Every Gregorian 400 years has the same number of days, 146097, which is a whole number of weeks
+        let origin = Self.rataDie(year: 2000, month: 1, day: 1)
+        let months = self.month.map { $0 ... $0 } ?? 1 ... 12
+        var offsets: [Int] = []
+        for year in 2000 ..< 2400 {
+            for month in months {
+                if let day = dayOfMonth(year: year, month: month, from: 1, forward: true) {
+                    offsets.append(Self.rataDie(year: year, month: month, day: day) - origin)
+                }
+            }
+        }
+        return offsets.isEmpty ? nil : Repetition(origin: origin, period: 146097, offsets: offsets)
+    }
+}
+
+extension _CalendarGregorian {
+    /// The days on which exact matches are computed directly: from the first year after the Gregorian cutover to the end of the valid calendar range.
+    private var exactMatchDays: ClosedRange<Int> {
+        let first = _GregorianMatchPattern.rataDie(year: gregorianStartYear + 1, month: 1, day: 1)
+        let (last, _): (Int, Double) = _CalendarUtility.rataDieAndSecondsInDay(localSeconds: Date.validCalendarRange.upperBound.timeIntervalSinceReferenceDate)
+        return first ... last - 1
+    }
+
+    private func localRataDie(of date: Date) -> Int {
+        let localSeconds = date.timeIntervalSinceReferenceDate + Double(timeZone.secondsFromGMT(for: date))
+        return _CalendarUtility.rataDieAndSecondsInDay(localSeconds: localSeconds).rataDie
+    }
+
+    /// The pattern for `components`, if they can be matched directly in this calendar.
+    private func matchPattern(_ components: DateComponents) -> _GregorianMatchPattern? {
+        if let timeZone = components.timeZone, timeZone != self.timeZone {
+            return nil
+        }
+        return _GregorianMatchPattern(components)
+    }
+
+    /// The date of the time of day of `pattern` on the local day `rataDie`, or nil if a time zone transition skips that time. Without an hour in `pattern`, this is the start of the day, which always exists.
+    private func exactDate(rataDie: Int, _ pattern: _GregorianMatchPattern, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Date? {
+        let date = _CalendarUtility.utcDate(fromRataDie: rataDie, secondsInDay: pattern.secondsInDay, in: timeZone, repeatedTimePolicy: repeatedTimePolicy == .first ? .former : .latter, skippedTimePolicy: .former)
+        let localSeconds = date.timeIntervalSinceReferenceDate + Double(timeZone.secondsFromGMT(for: date))
+        let expected = Double(rataDie - _CalendarUtility.rataDieAtDateReference) * 86400 + pattern.secondsInDay
+        if abs(localSeconds - expected) < 1 {
+            return date
+        }
+        guard !pattern.hasTimeOfDay else {
+            return nil
+        }
+        // Midnight is skipped, so the day starts at the end of the transition. Noon of the same day is not skipped.
+        let noon = _CalendarUtility.utcDate(fromRataDie: rataDie, secondsInDay: 43200, in: timeZone, repeatedTimePolicy: .former, skippedTimePolicy: .former)
+        return dateInterval(of: .day, for: noon)?.start
+    }
+
+    /// The number of matching days in `days`, other than `excludedDay`, whose time of day is skipped by a time zone transition.
+    private func numberOfSkippedMatches(of pattern: _GregorianMatchPattern, in days: ClosedRange<Int>, excluding excludedDay: Int?, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Int {
+        guard pattern.hasTimeOfDay, timeZone.fixedOffsetFromGMT == nil else { return 0 }
+        let end = _CalendarUtility.utcDate(fromRataDie: days.upperBound + 2, secondsInDay: 0, in: timeZone, repeatedTimePolicy: .former, skippedTimePolicy: .former)
+        var cursor = _CalendarUtility.utcDate(fromRataDie: days.lowerBound - 1, secondsInDay: 0, in: timeZone, repeatedTimePolicy: .former, skippedTimePolicy: .former)
+        var count = 0
+        var lastCounted = Int.min
+        // Only a transition skips a time of day, so only the days on either side of one need a look
+        while let transition = timeZone.nextDaylightSavingTimeTransition(after: cursor), transition < end {
+            for day in [localRataDie(of: transition - 1), localRataDie(of: transition)] where day > lastCounted && day != excludedDay && days.contains(day) {
+                if pattern.matches(rataDie: day) && exactDate(rataDie: day, pattern, repeatedTimePolicy: repeatedTimePolicy) == nil {
+                    count += 1
+                    lastCounted = day
+                }
+            }
+            cursor = transition
+        }
+        return count
+    }
+
+    package func nextExactDate(after date: Date, matching components: DateComponents, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        guard let pattern = matchPattern(components), Date.validCalendarRange.contains(date) else {
+            return nil
+        }
+        let days = exactMatchDays
+        let forward = direction == .forward
+        var rataDie = localRataDie(of: date)
+        // The match on the day of `date` may be on either side of it, and a transition may skip the time of a match. Either way, move on to the next day that matches.
+        for _ in 0 ..< 4 {
+            guard days.contains(rataDie), let day = pattern.firstDay(from: rataDie, forward: forward), days.contains(day) else {
+                return nil
+            }
+            if let result = exactDate(rataDie: day, pattern, repeatedTimePolicy: repeatedTimePolicy), forward ? result > date : result < date {
+                return result
+            }
+            rataDie = forward ? day + 1 : day - 1
+        }
+        return nil
+    }
+
+    package func exactDate(_ n: Int, matching components: DateComponents, after date: Date, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        guard n >= 1, let pattern = matchPattern(components), Date.validCalendarRange.contains(date), let repetition = pattern.repetition else {
+            return nil
+        }
+        let days = exactMatchDays
+        let startDay = localRataDie(of: date)
+        guard days.contains(startDay) else { return nil }
+
+        let step = direction == .forward ? 1 : -1
+        // The index of the first matching day on or after the day of `date`, or on or before it
+        var index = direction == .forward ? repetition.count(through: startDay - 1) : repetition.count(through: startDay) - 1
+        var remaining = n
+        while true {
+            let target = index + step * (remaining - 1)
+            let first = repetition.day(at: index)
+            let last = repetition.day(at: target)
+            guard days.contains(last) else { return nil }
+
+            // Matching days without a match after `date`: the day of `date` itself when its match is not past `date`, and days whose time of day is skipped
+            let range = min(first, last) ... max(first, last)
+            remaining = numberOfSkippedMatches(of: pattern, in: range, excluding: startDay, repeatedTimePolicy: repeatedTimePolicy)
+            if range.contains(startDay) && pattern.matches(rataDie: startDay) {
+                let match = exactDate(rataDie: startDay, pattern, repeatedTimePolicy: repeatedTimePolicy)
+                if match.map({ direction == .forward ? $0 <= date : $0 >= date }) ?? true {
+                    remaining += 1
+                }
+            }
+            if remaining == 0 {
+                return exactDate(rataDie: last, pattern, repeatedTimePolicy: repeatedTimePolicy)
+            }
+            index = target + step
+        }
+    }
+
+    package func numberOfExactDates(matching components: DateComponents, in range: Range<Date>, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Int? {
+        guard let pattern = matchPattern(components), Date.validCalendarRange.contains(range.lowerBound), Date.validCalendarRange.contains(range.upperBound), let repetition = pattern.repetition else {
+            return nil
+        }
+        let days = exactMatchDays
+        let first = localRataDie(of: range.lowerBound)
+        let last = localRataDie(of: range.upperBound)
+        guard days.contains(first), days.contains(last) else { return nil }
+
+        // A match on a day between the days of the bounds is within the range. The days of the bounds are checked one at a time.
+        var count = 0
+        if last - first >= 2 {
+            count = repetition.count(through: last - 1) - repetition.count(through: first)
+            count -= numberOfSkippedMatches(of: pattern, in: first + 1 ... last - 1, excluding: nil, repeatedTimePolicy: repeatedTimePolicy)
+        }
+        for day in first == last ? [first] : [first, last] where pattern.matches(rataDie: day) {
+            if let match = exactDate(rataDie: day, pattern, repeatedTimePolicy: repeatedTimePolicy), range.contains(match) {
+                count += 1
+            }
+        }
+        return count
+    }
+}
@@ -26,6 +26,7 @@ import CRT
 @preconcurrency import EmscriptenLibc
 #endif
 
+internal import Synchronization
 
 /// Julian date helper
 /// Julian dates are noon-based. Gregorian dates are midnight-based.
@@ -172,6 +173,40 @@ package enum GregorianCalendarError : Error {
     case notAdvancing(Date /* next */, Date /* previous */)
 }
 
+/// A day after the Gregorian cutover and its julian day, packed into one word so that it can be stored atomically: the low 32 bits hold the julian day, followed by 5 bits of day, 4 bits of month and 23 bits of year.
+struct _GregorianDay {
+    static let maxYear = (1 << 23) - 1
+
+    let julianDay: Int
+    let year: Int
+    let month: Int
+    let day: Int
+
+    init(julianDay: Int, year: Int, month: Int, day: Int) {
+        self.julianDay = julianDay
+        self.year = year
+        self.month = month
+        self.day = day
+    }
+
+    /// Returns nil for 0, which stands for no day
+    init?(packed: UInt64) {
+        guard packed != 0 else { return nil }
+        julianDay = Int(Int32(truncatingIfNeeded: packed))
+        day = Int((packed >> 32) & 0x1F)
+        month = Int((packed >> 37) & 0xF)
+        year = Int(packed >> 41)
+    }
+
+    /// Nil if the day does not fit. Years are at least 1, so this is never 0.
+    var packed: UInt64? {
+        guard year >= 1, year <= Self.maxYear, (1...12).contains(month), (1...31).contains(day), let julianDay = Int32(exactly: julianDay) else {
+            return nil
+        }
+        return UInt64(UInt32(bitPattern: julianDay)) | UInt64(day) << 32 | UInt64(month) << 37 | UInt64(year) << 41
+    }
+}
+
 /// This class is a placeholder and work-in-progress to provide an implementation of the Gregorian calendar.
 package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
 
@@ -193,6 +228,9 @@ package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
 
     let inf_ti : TimeInterval = 4398046511104.0
 
+    /// The most recently converted day after the cutover year, as a packed `_GregorianDay`. Consecutive dates, such as log timestamps, usually fall on the same day, so this saves converting between julian days and year, month and day again.
+    private let _lastDay = Atomic<UInt64>(0)
+
     package init(identifier: Calendar.Identifier, timeZone: TimeZone?, locale: Locale?, firstWeekday: Int?, minimumDaysInFirstWeek: Int?, gregorianStartDate: Date?) {
 
         // ISO8601 has different default values locale, firstWeekday, and minimumDaysInFirstWeek
@@ -1826,9 +1864,19 @@ package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
             break
         }
 
-        var julianDay = try self.julianDay(usingJulianReference: useJulianReference, resolvedComponents: resolvedComponents)
-        if !useJulianReference && julianDay < julianCutoverDay { // Recalculate using julian reference if we're before cutover
-            julianDay = try self.julianDay(usingJulianReference: true, resolvedComponents: resolvedComponents)
+        var julianDay: Int
+        if case let .day(year, month, day, _) = resolvedComponents, let lastJulianDay = lastJulianDay(year: year, month: month, day: day ?? 1) {
+            julianDay = lastJulianDay
+        } else {
+            julianDay = try self.julianDay(usingJulianReference: useJulianReference, resolvedComponents: resolvedComponents)
+            if !useJulianReference && julianDay < julianCutoverDay { // Recalculate using julian reference if we're before cutover
+                julianDay = try self.julianDay(usingJulianReference: true, resolvedComponents: resolvedComponents)
+            } else if case let .day(year, month, day, _) = resolvedComponents {
+                let day = day ?? 1
+                if (1...12).contains(month) && day >= 1 && day <= numberOfDaysInMonth(month, year: year) {
+                    rememberDay(julianDay: julianDay, year: year, month: month, day: day)
+                }
+            }
         }
 
         let nano_coef = 1_000_000_000
@@ -1903,6 +1951,35 @@ package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
         return (year, month, day)
     }
 
+    /// Same as `yearMonthDayFromJulianDay(_:useJulianRef:)`, but reuses the result for the most recently converted day.
+    func yearMonthDay(fromJulianDay julianDay: Int, useJulianRef: Bool) -> (year: Int, month: Int, day: Int) {
+        if !useJulianRef, let last = _GregorianDay(packed: _lastDay.load(ordering: .relaxed)), last.julianDay == julianDay {
+            return (last.year, last.month, last.day)
+        }
+        let ymd = Self.yearMonthDayFromJulianDay(julianDay, useJulianRef: useJulianRef)
+        if !useJulianRef {
+            rememberDay(julianDay: julianDay, year: ymd.year, month: ymd.month, day: ymd.day)
+        }
+        return ymd
+    }
+
+    /// The julian day of the given Gregorian day, if it is the most recently converted day
+    func lastJulianDay(year: Int, month: Int, day: Int) -> Int? {
+        guard let last = _GregorianDay(packed: _lastDay.load(ordering: .relaxed)), last.year == year, last.month == month, last.day == day else {
+            return nil
+        }
+        return last.julianDay
+    }
+
+    /// `month` and `day` must be a valid day of the Gregorian calendar
+    func rememberDay(julianDay: Int, year: Int, month: Int, day: Int) {
+        // Days up to the end of the cutover year need its special cases
+        guard year > gregorianStartYear, let packed = _GregorianDay(julianDay: julianDay, year: year, month: month, day: day).packed else {
+            return
+        }
+        _lastDay.store(packed, ordering: .relaxed)
+    }
+
     // day and month are 1-based
     // throws if out of supported julian day range
     func julianDay(ofDay day: Int, month: Int, year: Int, useJulianReference: Bool = false) throws (GregorianCalendarError) -> Int {
@@ -1952,6 +2029,11 @@ package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
         let daysBeforeMonthNonLeap = [0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334]
         let daysBeforeMonthLeap =    [0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335]
 
+        if year > gregorianStartYear && year <= _GregorianDay.maxYear {
+            // Entirely in the Gregorian calendar, and too small to overflow
+            return (Self.isLeapYear(year) ? daysBeforeMonthLeap : daysBeforeMonthNonLeap)[month - 1] + day
+        }
+
         let julianDay = try julianDay(ofDay: day, month: month, year: year)
         let useJulianCalendar = julianDay < julianCutoverDay
         let isLeapYear = gregorianYearIsLeap(year)
@@ -2112,7 +2194,7 @@ package final class _CalendarGregorian: _CalendarProtocol, @unchecked Sendable {
         let date = Date(timeIntervalSinceReferenceDate: dateOffsetInSeconds) // Round down the given date to seconds
         let useJulianRef = useJulianReference(date)
         let julianDay = try date.julianDay()
-        let julianDayYMD = Self.yearMonthDayFromJulianDay(julianDay, useJulianRef: useJulianRef)
+        let julianDayYMD = yearMonthDay(fromJulianDay: julianDay, useJulianRef: useJulianRef)
 
         let year = julianDayYMD.year
         let month = julianDayYMD.month
@@ -50,12 +50,25 @@ package protocol _CalendarProtocol: AnyObject, Sendable, CustomDebugStringConver
     func date(byAdding components: DateComponents, to date: Date, wrappingComponents: Bool) -> Date?
     func dateComponents(_ components: Calendar.ComponentSet, from start: Date, to end: Date) -> DateComponents
 
+    /// Appends the components of each date to `columns`. The default implementation calls `dateComponents(_:from:in:)` for each date.
+    @available(FoundationPreview 6.5, *)
+    func dateComponents(_ components: Calendar.ComponentSet, from dates: UnsafeBufferPointer<Date>, in timeZone: TimeZone, appendingTo columns: inout Calendar.ComponentColumns)
+
     /// Optional fast path for `Calendar.nextDate(after:matching:)`. Nil means no more matches (not "unsupported pattern" — use `supportsNextDateFastPath(for:)` to check that).
     func nextDate(after date: Date, matching components: DateComponents, direction: Calendar.SearchDirection) -> Date?
 
     /// Whether this calendar can fast path the given pattern. Default returns false; calendar implementations override for patterns they handle.
     func supportsNextDateFastPath(for components: Calendar.ComponentSet) -> Bool
 
+    /// Optional fast path for `.strict` matching: the next exact match, found without stepping through candidate dates. Nil means the calendar can't answer for this pattern or date, and the caller steps through candidates instead.
+    func nextExactDate(after date: Date, matching components: DateComponents, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date?
+
+    /// Optional random access to `.strict` matches: the `n`th exact match after `date`. Nil means the calendar can't answer directly.
+    func exactDate(_ n: Int, matching components: DateComponents, after date: Date, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date?
+
+    /// Optional count of the `.strict` matches in `range`. Nil means the calendar can't answer directly.
+    func numberOfExactDates(matching components: DateComponents, in range: Range<Date>, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Int?
+
 #if FOUNDATION_FRAMEWORK
     func bridgeToNSCalendar() -> NSCalendar
 #endif
@@ -68,6 +81,18 @@ extension _CalendarProtocol {
 
     package func supportsNextDateFastPath(for components: Calendar.ComponentSet) -> Bool { false }
 
+    package func nextExactDate(after date: Date, matching components: DateComponents, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        nil
+    }
+
+    package func exactDate(_ n: Int, matching components: DateComponents, after date: Date, repeatedTimePolicy: Calendar.RepeatedTimePolicy, direction: Calendar.SearchDirection) -> Date? {
+        nil
+    }
+
+    package func numberOfExactDates(matching components: DateComponents, in range: Range<Date>, repeatedTimePolicy: Calendar.RepeatedTimePolicy) -> Int? {
+        nil
+    }
+
     package var preferredFirstWeekday: Int? { nil }
     package var preferredMinimumDaysInFirstweek: Int? { nil }
     
@@ -332,6 +332,69 @@ extension Calendar {
                     case .hourly:   40 * 366 * 24
                     case .minutely: 40 * 366 * 24 * 60
                 }
+
+                // Rather than skip through every period before the search
+                // range, start `baseRecurrence` in the period of `lowerBound`
+                if let baseRecurrenceLowerBound, baseRecurrenceLowerBound > start, let skip = Self._periodsToSkip(recurrence: recurrence, start: start, to: baseRecurrenceLowerBound, matching: componentsForEnumerating) {
+                    baseRecurrence = Calendar.DatesByMatching(calendar: recurrence.calendar,
+                                                              start: skip.periodStart - 1,
+                                                              range: nil,
+                                                              matchingComponents: componentsForEnumerating,
+                                                              matchingPolicy: recurrence.matchingPolicy,
+                                                              repeatedTimePolicy: recurrence.repeatedTimePolicy,
+                                                              direction: .forward).makeIterator()
+                    iterations = skip.periods
+                }
+            }
+
+            /// Whether `baseRecurrence` can start in any period, instead of
+            /// replaying every period since `start`. See `_periodsToSkip()`
+            var canSeek: Bool {
+                Self._canSeek(recurrence: recurrence, matching: baseRecurrence.matchingComponents)
+            }
+
+            /// Every period has an index in the base recurrence only if it
+            /// matches exactly once in every period: the matching policy can't
+            /// skip periods, an occurrence count needs every earlier result, and
+            /// a day of the month past the 28th would move some months' match
+            /// into the next month.
+            static func _canSeek(recurrence: RecurrenceRule, matching components: DateComponents) -> Bool {
+                guard recurrence._supportsSeeking else {
+                    return false
+                }
+                if recurrence.frequency == .monthly, let day = components.day, day > 28 {
+                    return false
+                }
+                return true
+            }
+
+            /// The number of frequency intervals between the period of `start`
+            /// and the first period at or after `date` whose index is a multiple
+            /// of the recurrence interval, and the start of that period.
+            ///
+            /// Returns `nil` when seeking isn't possible (see `_canSeek()`), or
+            /// the period of `date` comes first anyway.
+            static func _periodsToSkip(recurrence: RecurrenceRule, start: Date, to date: Date, matching components: DateComponents) -> (periods: Int, periodStart: Date)? {
+                guard _canSeek(recurrence: recurrence, matching: components) else {
+                    return nil
+                }
+                let calendar = recurrence.calendar
+
+                // Weeks are counted in days, as their periods start on `firstWeekday`
+                let (unit, unitsPerPeriod): (Calendar.Component, Int) = switch recurrence.frequency {
+                    case .weekly: (.day, 7)
+                    default:      (recurrence.frequency.component, 1)
+                }
+                guard let startPeriod = calendar.dateInterval(of: recurrence.frequency.component, for: start)?.start,
+                      let units = calendar.dateComponents([unit], from: startPeriod, to: date).value(for: unit) else {
+                    return nil
+                }
+                let interval = recurrence.interval
+                let periods = (units / unitsPerPeriod + interval - 1) / interval * interval
+                guard periods >= 1, let periodStart = calendar.date(byAdding: unit, value: periods * unitsPerPeriod, to: startPeriod) else {
+                    return nil
+                }
+                return (periods, periodStart)
             }
             
             /// A group of dates within the interval specified by the recurrence
@@ -562,6 +625,99 @@ extension Calendar {
 }
 
 extension Calendar.RecurrenceRule {
+    /// Whether enumeration can start at any period instead of replaying
+    /// every period since the start date. See `_periodsToSkip()`
+    internal var _supportsSeeking: Bool {
+        (calendar.identifier == .gregorian || calendar.identifier == .iso8601) &&
+        matchingPolicy != .strict &&
+        end.occurrences == nil
+    }
+
+    /// The approximate length of `interval` periods of the frequency
+    internal var _nominalPeriodLength: TimeInterval {
+        let seconds: TimeInterval = switch frequency {
+            case .minutely: 60
+            case .hourly:   3600
+            case .daily:    86400
+            case .weekly:   86400 * 7
+            case .monthly:  2629746
+            case .yearly:   31556952
+        }
+        return seconds * Double(interval)
+    }
+
+    /// Split `interval` into consecutive ranges to be enumerated concurrently.
+    /// Each range but the last excludes its upper bound. A single range is
+    /// returned if the recurrence can't seek from `start`, as every range
+    /// would then replay all periods since `start`, or the interval is too
+    /// short to be worth splitting
+    internal func _concurrentChunks(of interval: DateInterval, from start: Date) -> [(lowerBound: Date, upperBound: Date, inclusive: Bool)] {
+        // Every chunk should cover enough periods to amortize the cost of a task
+        let minimumChunkLength = _nominalPeriodLength * 64
+        var chunkCount = 1
+        if _supportsSeeking, minimumChunkLength > 0,
+           Calendar.DatesByRecurring.Iterator(start: start, matching: self, lowerBound: nil, upperBound: nil).canSeek {
+            chunkCount = max(1, min(ProcessInfo.processInfo.activeProcessorCount, Int(min(interval.duration / minimumChunkLength, 1024))))
+        }
+        guard chunkCount > 1 else {
+            return [(interval.start, interval.end, true)]
+        }
+        let chunkLength = interval.duration / Double(chunkCount)
+        return (0..<chunkCount).map { idx in
+            let lowerBound = interval.start + chunkLength * Double(idx)
+            if idx == chunkCount - 1 {
+                return (lowerBound, interval.end, true)
+            }
+            return (lowerBound, interval.start + chunkLength * Double(idx + 1), false)
+        }
+    }
+
+    internal func _occurrences(of start: Date, in interval: DateInterval) async -> [Date] {
+        let chunks = _concurrentChunks(of: interval, from: start)
+        @Sendable func occurrences(in chunk: (lowerBound: Date, upperBound: Date, inclusive: Bool)) -> [Date] {
+            let iterator = Calendar.DatesByRecurring.Iterator(start: start, matching: self, lowerBound: chunk.lowerBound, upperBound: (chunk.upperBound, chunk.inclusive))
+            return Array(IteratorSequence(iterator))
+        }
+        guard chunks.count > 1 else {
+            return occurrences(in: chunks[0])
+        }
+        return await withTaskGroup(of: (Int, [Date]).self) { group in
+            for (idx, chunk) in chunks.enumerated() {
+                group.addTask {
+                    (idx, occurrences(in: chunk))
+                }
+            }
+            var results = [[Date]](repeating: [], count: chunks.count)
+            for await (idx, dates) in group {
+                results[idx] = dates
+            }
+            return Array(results.joined())
+        }
+    }
+
+    internal func _count(of start: Date, in interval: DateInterval) async -> Int {
+        let chunks = _concurrentChunks(of: interval, from: start)
+        @Sendable func count(in chunk: (lowerBound: Date, upperBound: Date, inclusive: Bool)) -> Int {
+            var iterator = Calendar.DatesByRecurring.Iterator(start: start, matching: self, lowerBound: chunk.lowerBound, upperBound: (chunk.upperBound, chunk.inclusive))
+            var found = 0
+            while iterator.next() != nil {
+                found += 1
+            }
+            return found
+        }
+        guard chunks.count > 1 else {
+            return count(in: chunks[0])
+        }
+        return await withTaskGroup(of: Int.self) { group in
+            for chunk in chunks {
+                group.addTask {
+                    count(in: chunk)
+                }
+            }
+            return await group.reduce(0, +)
+        }
+    }
+
     internal func _limitMonths(dates: inout [Date], anchor: Date) {
         let months = calendar._normalizedMonths(Set(months), for: anchor)
         
@@ -343,6 +343,38 @@ extension Calendar {
         ) -> some (Sequence<Date> & Sendable) {
             DatesByRecurring(start: start, recurrence: self, range: range)
         }
+
+        /// Find all recurrences of the given date in a date interval
+        ///
+        /// Long intervals are split up and searched concurrently when the
+        /// recurrence allows starting the search from any date.
+        ///
+        /// - Parameter start: the date which defines the starting point for the
+        ///   recurrence rule.
+        /// - Parameter interval: the interval in which to search for
+        ///   recurrences, including its end date.
+        /// - Returns: the dates conforming to the recurrence rule in the given
+        ///   `interval`, sorted in ascending order.
+        @available(FoundationPreview 6.5, *)
+        public func occurrences(of start: Date, in interval: DateInterval) async -> [Date] {
+            await _occurrences(of: start, in: interval)
+        }
+
+        /// Count the recurrences of the given date in a date interval
+        ///
+        /// Long intervals are split up and searched concurrently when the
+        /// recurrence allows starting the search from any date.
+        ///
+        /// - Parameter start: the date which defines the starting point for the
+        ///   recurrence rule.
+        /// - Parameter interval: the interval in which to search for
+        ///   recurrences, including its end date.
+        /// - Returns: the number of dates conforming to the recurrence rule in
+        ///   the given `interval`.
+        @available(FoundationPreview 6.5, *)
+        public func count(of start: Date, in interval: DateInterval) async -> Int {
+            await _count(of: start, in: interval)
+        }
         
         /// A recurrence that repeats every `interval` minutes
         public static func minutely(calendar: Calendar, interval: Int = 1, end: End = .never, matchingPolicy: Calendar.MatchingPolicy = .nextTimePreservingSmallerComponents, repeatedTimePolicy: Calendar.RepeatedTimePolicy = .first, months: [Month] = [], daysOfTheYear: [Int] = [], daysOfTheMonth: [Int] = [], weekdays: [Weekday] = [], hours: [Int] = [], minutes: [Int] = [], seconds: [Int] = [], setPositions: [Int] = []) -> Self {
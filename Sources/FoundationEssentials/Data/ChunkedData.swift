@@ -0,0 +1,226 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+/// A byte buffer made of a sequence of `Data` values, which are shared rather than copied.
+///
+/// Appending a `Data` to a `ChunkedData` only stores a reference to its storage, so a large message can be assembled
+/// from headers and payload slices without copying any of them. The chunks are available through `regions`, and
+/// writing a `ChunkedData` to a file hands all of them to the system at once instead of joining them first.
+///
+/// When contiguous bytes are needed, `data` joins the chunks into a single `Data`. This happens at most once; later
+/// accesses return the joined value.
+///
+///     var response = ChunkedData()
+///     response.append(header)
+///     response.append(payload[range])
+///     try response.write(to: url)
+@available(FoundationPreview 6.5, *)
+public struct ChunkedData: Sendable {
+    /// The chunks, none of which is empty.
+    private var _chunks: [Data]
+    /// The offset of the end of each chunk.
+    private var _ends: [Int]
+
+    /// Appended bytes are copied into the last chunk instead of starting a new chunk as long as the result is no
+    /// longer than this. Copying a few bytes is cheaper than the bookkeeping and system call overhead of a tiny chunk.
+    private static var _coalescingLimit: Int { 512 }
+
+    /// Creates an empty buffer.
+    public init() {
+        _chunks = []
+        _ends = []
+    }
+
+    /// Creates a buffer holding the bytes of `data`, without copying them.
+    public init(_ data: Data) {
+        self.init()
+        append(data)
+    }
+
+    /// Creates a buffer holding the bytes of the given `Data` values in order, without copying them.
+    public init(_ chunks: some Sequence<Data>) {
+        self.init()
+        for chunk in chunks {
+            append(chunk)
+        }
+    }
+
+    /// Appends the bytes of `data`. Unless `data` is small, its storage is shared instead of copied.
+    public mutating func append(_ data: Data) {
+        guard !data.isEmpty else { return }
+        if let last = _chunks.last, last.count + data.count <= Self._coalescingLimit {
+            _chunks[_chunks.count - 1].append(data)
+            _ends[_ends.count - 1] += data.count
+        } else {
+            _ends.append(count + data.count)
+            _chunks.append(data)
+        }
+    }
+
+    /// Appends the chunks of `other`, without copying them.
+    public mutating func append(_ other: ChunkedData) {
+        for chunk in other._chunks {
+            append(chunk)
+        }
+    }
+
+    /// Appends the bytes of `bytes`. `Data` and `ChunkedData` values are shared; the bytes of other types are copied.
+    public mutating func append(contentsOf bytes: some DataProtocol) {
+        if let data = bytes as? Data {
+            append(data)
+        } else if let other = bytes as? ChunkedData {
+            append(other)
+        } else {
+            for region in bytes.regions {
+                append(Data(region))
+            }
+        }
+    }
+
+    /// The bytes of the buffer as a single contiguous `Data`.
+    ///
+    /// If the buffer has more than one chunk, they are copied into a new `Data` that replaces them, so the copy is only
+    /// made once.
+    public var data: Data {
+        mutating get {
+            if _chunks.count > 1 {
+                var joined = Data(capacity: count)
+                for chunk in _chunks {
+                    joined.append(chunk)
+                }
+                _chunks = [joined]
+                _ends = [joined.count]
+            }
+            return _chunks.first ?? Data()
+        }
+    }
+
+    /// Returns the index of the chunk containing the byte at `offset`.
+    private func _chunkIndex(containing offset: Int) -> Int {
+        var low = 0
+        var high = _ends.count - 1
+        while low < high {
+            let middle = low + (high - low) / 2
+            if _ends[middle] <= offset {
+                low = middle + 1
+            } else {
+                high = middle
+            }
+        }
+        return low
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension ChunkedData : DataProtocol {
+    public typealias Index = Int
+    public typealias Indices = Range<Int>
+
+    public var startIndex: Int { 0 }
+
+    public var endIndex: Int { count }
+
+    public var count: Int { _ends.last ?? 0 }
+
+    public var isEmpty: Bool { _chunks.isEmpty }
+
+    /// The chunks of the buffer in order. Use the `bytes` of each chunk to access it as a `RawSpan`.
+    public var regions: [Data] { _chunks }
+
+    public subscript(position: Int) -> UInt8 {
+        precondition(position >= 0 && position < count, "Index \(position) is out of bounds of range 0..<\(count)")
+        let chunkIndex = _chunkIndex(containing: position)
+        let chunk = _chunks[chunkIndex]
+        let chunkStart = chunkIndex == 0 ? 0 : _ends[chunkIndex - 1]
+        return chunk[chunk.startIndex + (position - chunkStart)]
+    }
+
+    public func withContiguousStorageIfAvailable<E, ResultType>(_ body: (UnsafeBufferPointer<UInt8>) throws(E) -> ResultType) throws(E) -> ResultType? {
+        switch _chunks.count {
+        case 0:
+            return try body(UnsafeBufferPointer(start: nil, count: 0))
+        case 1:
+            return try _chunks[0].withContiguousStorageIfAvailable(body)
+        default:
+            return nil
+        }
+    }
+
+    public struct Iterator : IteratorProtocol, Sendable {
+        private var _chunks: IndexingIterator<[Data]>
+        private var _current: Data.Iterator
+
+        fileprivate init(_ chunks: [Data]) {
+            _chunks = chunks.makeIterator()
+            _current = Data().makeIterator()
+        }
+
+        public mutating func next() -> UInt8? {
+            while true {
+                if let byte = _current.next() {
+                    return byte
+                }
+                guard let chunk = _chunks.next() else {
+                    return nil
+                }
+                _current = chunk.makeIterator()
+            }
+        }
+    }
+
+    public func makeIterator() -> Iterator {
+        Iterator(_chunks)
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension ChunkedData {
+    /// Writes the contents of the buffer to a location.
+    ///
+    /// Unless `options` contains `.atomic`, the chunks are written with gathering writes rather than being joined
+    /// into one buffer first.
+    ///
+    /// - parameter url: The location to write the data into.
+    /// - parameter options: Options for writing the data. Default value is `[]`.
+    /// - throws: An error in the Cocoa domain, if there is an error writing to the `URL`.
+    public func write(to url: URL, options: Data.WritingOptions = []) throws {
+        guard _chunks.count > 1 else {
+            try (_chunks.first ?? Data()).write(to: url, options: options)
+            return
+        }
+
+#if !os(WASI) && !os(Emscripten) // `.atomic` is unavailable on WASI/Emscripten
+        if options.contains(.withoutOverwriting) && options.contains(.atomic) {
+            fatalError("withoutOverwriting is not supported with atomic")
+        }
+#endif
+
+        guard url.isFileURL else {
+            throw CocoaError(.fileWriteUnsupportedScheme)
+        }
+
+#if !NO_FILESYSTEM
+        try writeToFile(path: url, chunks: _chunks, options: options)
+#else
+        throw CocoaError(.featureUnsupported)
+#endif
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// Creates a `Data` holding the bytes of a `ChunkedData`. If it has more than one chunk, the chunks are copied.
+    public init(_ chunked: ChunkedData) {
+        var chunked = chunked
+        self = chunked.data
+    }
+}
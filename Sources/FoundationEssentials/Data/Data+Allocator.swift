@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+internal import Synchronization
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// A source of memory for the bytes of `Data` values.
+    ///
+    /// A `Data` created with an allocator keeps its bytes in the memory the allocator provides as long as it is mutated
+    /// in place and fits in that memory. When it needs to grow beyond it, or when a copy is made because the value is
+    /// shared, the bytes move to memory from the system allocator, and the original memory is returned to the allocator.
+    public protocol Allocator: Sendable {
+        /// Allocates memory for at least `byteCount` bytes.
+        ///
+        /// - parameter byteCount: The number of bytes needed. Always greater than zero.
+        /// - returns: The allocated memory, which may be larger than `byteCount`.
+        func allocate(byteCount: Int) -> UnsafeMutableRawBufferPointer
+
+        /// Returns memory obtained from `allocate(byteCount:)` to the allocator.
+        ///
+        /// This may be called on any thread.
+        func deallocate(_ buffer: UnsafeMutableRawBufferPointer)
+    }
+
+    /// Creates an empty data whose storage for `capacity` bytes comes from `allocator`.
+    ///
+    /// - parameter capacity: The number of bytes the data can hold before it needs to move to other memory.
+    /// - parameter allocator: The allocator to take the memory from.
+    public init(capacity: Int, allocator: some Allocator) {
+        self.init(_allocatedCount: 0, capacity: capacity, allocator: allocator)
+    }
+
+    /// Creates a data of `count` zeroed bytes, stored in memory that comes from `allocator`.
+    ///
+    /// - parameter count: The number of bytes the data initially contains.
+    /// - parameter allocator: The allocator to take the memory from.
+    public init(count: Int, allocator: some Allocator) {
+        self.init(_allocatedCount: count, capacity: count, allocator: allocator)
+    }
+
+    private init(_allocatedCount count: Int, capacity: Int, allocator: some Allocator) {
+        precondition(capacity >= 0, "capacity must not be negative")
+        guard capacity > 0 else {
+            self.init()
+            return
+        }
+        let buffer = allocator.allocate(byteCount: capacity)
+        precondition(buffer.count >= capacity, "The allocator returned fewer bytes than requested")
+        if count > 0 {
+            buffer.baseAddress!.initializeMemory(as: UInt8.self, repeating: 0, count: count)
+        }
+        // The memory goes back to the allocator through the same path as any other custom deallocator.
+        let deallocator = Deallocator.custom { _, _ in
+            allocator.deallocate(buffer)
+        }
+        let storage = __DataStorage(offset: 0, bytes: buffer.baseAddress!, capacity: buffer.count, needToZero: true, length: count, deallocator: deallocator._deallocator)
+#if DATA_LEGACY_ABI
+        // `_Representation(_:count:)` would copy a small or empty data out of the storage into an inline or empty
+        // representation and release the allocator's memory right away, so always keep the storage.
+        if InlineSlice.canStore(count: capacity) {
+            self.init(representation: .slice(InlineSlice(storage, count: count)))
+        } else {
+            self.init(representation: .large(LargeSlice(storage, count: count)))
+        }
+#else
+        self.init(representation: _Representation(storage, count: count))
+#endif
+    }
+
+    /// An allocator that carves memory out of large blocks, for `Data` values that are created and discarded together,
+    /// such as the scratch buffers of a single request.
+    ///
+    /// Allocating from an arena is a pointer increment under a lock that only the users of the arena share, instead of a
+    /// call into the system allocator. Memory is not reused, except when the most recent allocation is returned, until the
+    /// arena and every `Data` created with it have been destroyed; then all of its blocks are freed at once.
+    ///
+    ///     let arena = Data.ArenaAllocator()
+    ///     var header = Data(capacity: 512, allocator: arena)
+    ///     var body = Data(capacity: 16 * 1024, allocator: arena)
+    public final class ArenaAllocator: Allocator {
+        private struct State {
+            var blocks: [UnsafeMutableRawPointer] = []
+            /// The address of the current block.
+            var current = 0
+            /// The address of the next free byte of the current block.
+            var next = 0
+            var remaining = 0
+        }
+
+        /// The size of the blocks the arena takes from the system allocator.
+        public let blockSize: Int
+
+        private let state = Mutex(State())
+
+        private static var alignment: Int { 16 }
+
+        /// Creates an arena.
+        ///
+        /// - parameter blockSize: The size of the blocks the arena takes from the system allocator. Allocations larger
+        ///   than a quarter of this get a block of their own. Default value is 64 KB.
+        public init(blockSize: Int = 64 * 1024) {
+            precondition(blockSize > 0, "blockSize must be positive")
+            self.blockSize = blockSize
+        }
+
+        public func allocate(byteCount: Int) -> UnsafeMutableRawBufferPointer {
+            let size = (byteCount + Self.alignment - 1) & ~(Self.alignment - 1)
+            let address = state.withLock { state in
+                if size > blockSize / 4 {
+                    let block = UnsafeMutableRawPointer.allocate(byteCount: size, alignment: Self.alignment)
+                    state.blocks.append(block)
+                    return Int(bitPattern: block)
+                }
+                if size > state.remaining {
+                    let block = UnsafeMutableRawPointer.allocate(byteCount: blockSize, alignment: Self.alignment)
+                    state.blocks.append(block)
+                    state.current = Int(bitPattern: block)
+                    state.next = state.current
+                    state.remaining = blockSize
+                }
+                let address = state.next
+                state.next += size
+                state.remaining -= size
+                return address
+            }
+            return UnsafeMutableRawBufferPointer(start: UnsafeMutableRawPointer(bitPattern: address), count: size)
+        }
+
+        public func deallocate(_ buffer: UnsafeMutableRawBufferPointer) {
+            let address = Int(bitPattern: buffer.baseAddress)
+            let count = buffer.count
+            state.withLock { state in
+                // Give back the most recent allocation, so a scratch buffer that is released right away can be reused.
+                if address >= state.current && address + count == state.next {
+                    state.next = address
+                    state.remaining += count
+                }
+            }
+        }
+
+        deinit {
+            state.withLock { state in
+                for block in state.blocks {
+                    block.deallocate()
+                }
+            }
+        }
+    }
+}
@@ -31,6 +31,8 @@ internal import _FoundationDarwinExtras
 import stdlib_h
 #endif
 
+internal import _FoundationCShims
+
 #if !FOUNDATION_FRAMEWORK
 extension Data {
     
@@ -151,6 +153,11 @@ extension Data {
 // https://github.com/client9/stringencoders/blob/master/src/modp_b64.c
 //
 // See NOTICE.txt for Licenses
+//
+// Inputs long enough to fill a vector register are handed to the SIMD kernels in
+// _FoundationCShims/base64_shims.c first. Those only process whole blocks of valid input, so the
+// scalar loops below finish the tail, handle padding and report errors. Passing
+// `useVectorKernels: false` runs the scalar implementation alone, which the tests use as oracle.
 
 enum Base64 {}
 
@@ -370,18 +377,25 @@ extension Base64 {
         return self.encodeToData(bytes: Array(bytes), options: options)
     }
 
-    static func _encode(input: UnsafeBufferPointer<UInt8>, buffer: UnsafeMutableBufferPointer<UInt8>, length: inout Int, options: Data.Base64EncodingOptions) {
+    static func _encode(
+        input: UnsafeBufferPointer<UInt8>,
+        buffer: UnsafeMutableBufferPointer<UInt8>,
+        length: inout Int,
+        options: Data.Base64EncodingOptions,
+        useVectorKernels: Bool = true
+    ) {
         if options.contains(.lineLength64Characters) || options.contains(.lineLength76Characters) {
-            return self._encodeWithLineBreaks(input: input, buffer: buffer, length: &length, options: options)
+            return self._encodeWithLineBreaks(input: input, buffer: buffer, length: &length, options: options, useVectorKernels: useVectorKernels)
         }
 
         let omitPaddingCharacter = options.contains(.omitPaddingCharacter)
+        let urlAlphabet = options.contains(.base64URLAlphabet)
 
         Self.withEncodingTables(options: options) { (e0, e1) throws(Never) -> Void in
             let to = input.count / 3 * 3
             var outIndex = 0
 
-            self.loopEncode(e0, e1, input: input, from: 0, to: to, output: buffer, outIndex: &outIndex)
+            self.loopEncode(e0, e1, input: input, from: 0, to: to, output: buffer, outIndex: &outIndex, urlAlphabet: urlAlphabet, useVectorKernels: useVectorKernels)
 
             if to < input.count {
                 let index = to
@@ -425,9 +439,11 @@ extension Base64 {
         input: UnsafeBufferPointer<UInt8>,
         buffer: UnsafeMutableBufferPointer<UInt8>,
         length: inout Int,
-        options: Data.Base64EncodingOptions
+        options: Data.Base64EncodingOptions,
+        useVectorKernels: Bool = true
     ) {
         let omitPaddingCharacter = options.contains(.omitPaddingCharacter)
+        let urlAlphabet = options.contains(.base64URLAlphabet)
 
         assert(options.contains(.lineLength64Characters) || options.contains(.lineLength76Characters))
 
@@ -463,7 +479,7 @@ extension Base64 {
 
             // first full line
             if input.count >= lineLength {
-                self.loopEncode(e0, e1, input: input, from: 0, to: lineLength, output: buffer, outIndex: &outIndex)
+                self.loopEncode(e0, e1, input: input, from: 0, to: lineLength, output: buffer, outIndex: &outIndex, urlAlphabet: urlAlphabet, useVectorKernels: useVectorKernels)
             }
 
             // following full lines
@@ -476,7 +492,7 @@ extension Base64 {
                     outIndex &+= 1
                 }
 
-                self.loopEncode(e0, e1, input: input, from: lineInputIndex, to: lineInputIndex + lineLength, output: buffer, outIndex: &outIndex)
+                self.loopEncode(e0, e1, input: input, from: lineInputIndex, to: lineInputIndex + lineLength, output: buffer, outIndex: &outIndex, urlAlphabet: urlAlphabet, useVectorKernels: useVectorKernels)
                 lineInputIndex &+= lineLength
             }
 
@@ -490,7 +506,7 @@ extension Base64 {
                 }
             }
             let to = input.count / 3 * 3
-            self.loopEncode(e0, e1, input: input, from: lines * lineLength, to: to, output: buffer, outIndex: &outIndex)
+            self.loopEncode(e0, e1, input: input, from: lines * lineLength, to: to, output: buffer, outIndex: &outIndex, urlAlphabet: urlAlphabet, useVectorKernels: useVectorKernels)
 
             // last 2-4 bytes
             if to < input.count {
@@ -537,12 +553,20 @@ extension Base64 {
         from: Int,
         to: Int,
         output: UnsafeMutableBufferPointer<UInt8>,
-        outIndex: inout Int
+        outIndex: inout Int,
+        urlAlphabet: Bool,
+        useVectorKernels: Bool
     ) {
         // Note: It's safe to use overflowing math here, as input and output are valid pointers
         //       with a length that is smaller than Int here. For this reason index and outIndex
         //       can never wrap.
         var index = from
+        if useVectorKernels && to &- from >= Self.vectorKernelMinimumLength {
+            // Full lines are 48 or 57 bytes long, so line broken output is vectorized line by line.
+            let consumed = _base64shims_encode(input.baseAddress! + from, to &- from, output.baseAddress! + outIndex, urlAlphabet)
+            index &+= consumed
+            outIndex &+= consumed / 3 &* 4
+        }
         while index < to {
             let i1 = input[index]
             let i2 = input[index &+ 1]
@@ -556,6 +580,10 @@ extension Base64 {
         }
     }
 
+    /// The shortest input for which calling into the vector kernels is worthwhile. None of the
+    /// kernels can process a block smaller than this.
+    static let vectorKernelMinimumLength = 24
+
     static func encodeComputeCapacity(bytes: Int, options: Data.Base64EncodingOptions) -> Int {
         let capacityWithoutBreaks = if options.contains(.omitPaddingCharacter) {
             switch bytes % 3 {
@@ -699,7 +727,8 @@ extension Base64 {
         from inBuffer: UnsafeBufferPointer<UInt8>,
         into outBuffer: UnsafeMutableBufferPointer<UInt8>,
         length: inout Int,
-        options: Data.Base64DecodingOptions
+        options: Data.Base64DecodingOptions,
+        useVectorKernels: Bool = true
     ) throws(DecodingError) {
         let bytesToParseLength: Int
         let fullchunks: Int
@@ -744,8 +773,16 @@ extension Base64 {
 
         try Self.withDecodingTables(options: options) { (d0, d1, d2, d3) throws(DecodingError) in
             var outIndex = 0
-            if fullchunks > 0 {
-                for chunk in 0 ..< fullchunks {
+            var firstChunk = 0
+            if useVectorKernels && fullchunks * 4 >= Self.vectorKernelMinimumLength {
+                // The kernel stops in front of the first block containing an invalid character. The
+                // scalar loop picks up from there, so errors are reported exactly as before.
+                let consumed = _base64shims_decode(inBuffer.baseAddress!, fullchunks * 4, outBuffer.baseAddress!, options.contains(.base64URLAlphabet))
+                firstChunk = consumed / 4
+                outIndex = firstChunk * 3
+            }
+            if fullchunks > firstChunk {
+                for chunk in firstChunk ..< fullchunks {
                     let inIndex = chunk * 4
                     let a0 = inBuffer[inIndex]
                     let a1 = inBuffer[inIndex + 1]
@@ -811,9 +848,11 @@ extension Base64 {
         from inBuffer: UnsafeBufferPointer<UInt8>,
         into outBuffer: UnsafeMutableBufferPointer<UInt8>,
         length: inout Int,
-        options: Data.Base64DecodingOptions
+        options: Data.Base64DecodingOptions,
+        useVectorKernels: Bool = true
     ) throws(DecodingError) {
         assert(options.contains(.ignoreUnknownCharacters))
+        let urlAlphabet = options.contains(.base64URLAlphabet)
 
         let outputLength = ((inBuffer.count + 3) / 4) * 3
         guard outBuffer.count >= outputLength else {
@@ -823,8 +862,30 @@ extension Base64 {
         try Self.withDecodingTables(options: options) { (d0, d1, d2, d3) throws(DecodingError) in
             var outIndex = 0
             var inIndex = 0
+            // The vector kernel is not called again before this index, so the scalar loop doesn't
+            // hand it the same block with an ignored character in it after every group of four.
+            var vectorResumeIndex = 0
 
             fastLoop: while inIndex + 3 < inBuffer.count {
+                // Every iteration starts on a fresh group of four valid characters, so runs of valid
+                // input between line breaks or other ignored characters can go to the vector kernel.
+                if useVectorKernels && inIndex >= vectorResumeIndex && inBuffer.count &- inIndex >= Self.vectorKernelMinimumLength {
+                    let consumed = _base64shims_decode(inBuffer.baseAddress! + inIndex, inBuffer.count &- inIndex, outBuffer.baseAddress! + outIndex, urlAlphabet)
+                    inIndex &+= consumed
+                    outIndex &+= consumed / 4 &* 3
+                    if inIndex + 3 >= inBuffer.count {
+                        break fastLoop
+                    }
+                    // The kernel stopped in front of a block with a character outside of the alphabet,
+                    // or one that is longer than the rest of the input. Stay scalar until past that
+                    // character, or to the end if there is none.
+                    var invalidIndex = inIndex
+                    while invalidIndex < inBuffer.count && self.isValidBase64Byte(inBuffer[invalidIndex], options: options) {
+                        invalidIndex &+= 1
+                    }
+                    vectorResumeIndex = invalidIndex &+ 1
+                }
+
                 let a0 = inBuffer[inIndex]
                 let a1 = inBuffer[inIndex &+ 1]
                 let a2 = inBuffer[inIndex &+ 2]
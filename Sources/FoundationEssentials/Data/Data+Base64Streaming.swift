@@ -0,0 +1,523 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+internal import _FoundationCShims
+
+// MARK: - Encoding -
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// An encoder that produces Base-64 incrementally from input that arrives in chunks.
+    ///
+    /// The encoder carries the bytes that do not yet form a complete group of three, and the
+    /// position within the current line, from one call to the next. Concatenating the results of
+    /// all `encode` calls and the final `finish` call produces the same bytes as calling
+    /// `base64EncodedData(options:)` on the concatenated input, while only ever holding one chunk.
+    ///
+    ///     var encoder = Data.Base64Encoder(options: .lineLength76Characters)
+    ///     for try await chunk in attachment {
+    ///         try output.write(contentsOf: encoder.encode(chunk))
+    ///     }
+    ///     try output.write(contentsOf: encoder.finish())
+    public struct Base64Encoder: Sendable {
+        /// The options used for encoding.
+        public let options: Base64EncodingOptions
+
+        /// Up to two bytes that did not complete a group of three with the previous input.
+        private var pending: (UInt8, UInt8) = (0, 0)
+        private var pendingCount = 0
+
+        /// The number of characters written to the current line.
+        private var column = 0
+
+        /// Creates an encoder.
+        ///
+        /// - parameter options: The options to use for the encoding. Default value is `[]`.
+        public init(options: Base64EncodingOptions = []) {
+            self.options = options
+        }
+
+        /// Returns the number of bytes that a buffer passed to `encode(_:into:)` for `count` bytes of
+        /// input, or to `finish(into:)` afterwards, needs to be able to hold.
+        public func maximumEncodedCount(forByteCount count: Int) -> Int {
+            // All complete groups, plus the padded group written by `finish`.
+            let characters = (pendingCount + count + 2) / 3 * 4
+            guard let lineLength = self.lineLength else {
+                return characters
+            }
+            return characters + ((column + characters) / lineLength + 1) * self.separatorCount
+        }
+
+        /// Encodes `bytes` into `output`, keeping up to two trailing bytes for the next call.
+        ///
+        /// - parameter bytes: The next chunk of input.
+        /// - parameter output: The buffer to write to. It must hold at least `maximumEncodedCount(forByteCount: bytes.count)` bytes.
+        /// - returns: The number of bytes written to `output`.
+        public mutating func encode(_ bytes: UnsafeRawBufferPointer, into output: UnsafeMutableRawBufferPointer) -> Int {
+            precondition(output.count >= self.maximumEncodedCount(forByteCount: bytes.count), "The output buffer is too small")
+            let input = bytes.assumingMemoryBound(to: UInt8.self)
+            let output = output.assumingMemoryBound(to: UInt8.self)
+            var inIndex = 0
+            var outIndex = 0
+
+            if pendingCount > 0 {
+                // Complete the group carried over from the previous call first.
+                let needed = 3 - pendingCount
+                guard input.count >= needed else {
+                    for byte in input {
+                        self.appendPending(byte)
+                    }
+                    return 0
+                }
+                let group = pendingCount == 1 ? (pending.0, input[0], input[1]) : (pending.0, pending.1, input[0])
+                withUnsafeBytes(of: group) { group in
+                    self.encodeGroups(group.assumingMemoryBound(to: UInt8.self), into: output, at: &outIndex)
+                }
+                pendingCount = 0
+                inIndex = needed
+            }
+
+            let end = inIndex + (input.count - inIndex) / 3 * 3
+            self.encodeGroups(UnsafeBufferPointer(rebasing: input[inIndex ..< end]), into: output, at: &outIndex)
+            for byte in input[end...] {
+                self.appendPending(byte)
+            }
+            return outIndex
+        }
+
+        /// Writes the final, possibly padded, group and resets the encoder so it can be reused.
+        ///
+        /// - parameter output: The buffer to write to. It must hold at least `maximumEncodedCount(forByteCount: 0)` bytes.
+        /// - returns: The number of bytes written to `output`.
+        public mutating func finish(into output: UnsafeMutableRawBufferPointer) -> Int {
+            defer {
+                pendingCount = 0
+                column = 0
+            }
+            guard pendingCount > 0 else {
+                return 0
+            }
+            precondition(output.count >= self.maximumEncodedCount(forByteCount: 0), "The output buffer is too small")
+            let output = output.assumingMemoryBound(to: UInt8.self)
+            var outIndex = 0
+            if let lineLength = self.lineLength, column == lineLength {
+                self.writeSeparator(into: output, at: &outIndex)
+            }
+            let count = pendingCount
+            let options = self.options.subtracting(Self.lineLengthOptions)
+            withUnsafeBytes(of: pending) { pending in
+                let input = UnsafeBufferPointer(rebasing: pending.assumingMemoryBound(to: UInt8.self)[..<count])
+                var length = 0
+                Base64._encode(input: input, buffer: UnsafeMutableBufferPointer(rebasing: output[outIndex...]), length: &length, options: options)
+                outIndex += length
+            }
+            return outIndex
+        }
+
+        /// Encodes the next chunk of input.
+        ///
+        /// - parameter bytes: The next chunk of input.
+        /// - returns: The Base-64 encoded data for all complete groups seen so far.
+        public mutating func encode(_ bytes: some DataProtocol) -> Data {
+            var data = Data(count: self.maximumEncodedCount(forByteCount: bytes.count))
+            let written = data.withUnsafeMutableBytes { output in
+                var written = 0
+                for region in bytes.regions {
+                    let count = region.withUnsafeBytes { region in
+                        self.encode(region, into: UnsafeMutableRawBufferPointer(rebasing: output[written...]))
+                    }
+                    written += count
+                }
+                return written
+            }
+            data.count = written
+            return data
+        }
+
+        /// Encodes the final, possibly padded, group and resets the encoder so it can be reused.
+        public mutating func finish() -> Data {
+            var data = Data(count: self.maximumEncodedCount(forByteCount: 0))
+            let written = data.withUnsafeMutableBytes { output in
+                self.finish(into: output)
+            }
+            data.count = written
+            return data
+        }
+
+        // MARK: Private
+
+        private static let lineLengthOptions: Base64EncodingOptions = [.lineLength64Characters, .lineLength76Characters]
+
+        private var lineLength: Int? {
+            if options.contains(.lineLength64Characters) {
+                64
+            } else if options.contains(.lineLength76Characters) {
+                76
+            } else {
+                nil
+            }
+        }
+
+        private var separatorCount: Int {
+            options.contains(.endLineWithCarriageReturn) != options.contains(.endLineWithLineFeed) ? 1 : 2
+        }
+
+        private mutating func appendPending(_ byte: UInt8) {
+            if pendingCount == 0 {
+                pending.0 = byte
+            } else {
+                pending.1 = byte
+            }
+            pendingCount += 1
+        }
+
+        private mutating func writeSeparator(into output: UnsafeMutableBufferPointer<UInt8>, at outIndex: inout Int) {
+            switch (options.contains(.endLineWithCarriageReturn), options.contains(.endLineWithLineFeed)) {
+            case (true, true), (false, false):
+                output[outIndex] = UInt8(ascii: "\r")
+                output[outIndex + 1] = UInt8(ascii: "\n")
+                outIndex += 2
+            case (true, false):
+                output[outIndex] = UInt8(ascii: "\r")
+                outIndex += 1
+            case (false, true):
+                output[outIndex] = UInt8(ascii: "\n")
+                outIndex += 1
+            }
+            column = 0
+        }
+
+        /// Encodes complete groups of three bytes, breaking lines where the options require it.
+        private mutating func encodeGroups(_ input: UnsafeBufferPointer<UInt8>, into output: UnsafeMutableBufferPointer<UInt8>, at outIndex: inout Int) {
+            assert(input.count % 3 == 0)
+            let options = self.options.subtracting(Self.lineLengthOptions)
+            guard let lineLength = self.lineLength else {
+                var length = 0
+                Base64._encode(input: input, buffer: UnsafeMutableBufferPointer(rebasing: output[outIndex...]), length: &length, options: options)
+                outIndex += length
+                return
+            }
+
+            // Line lengths are multiples of four, so a group never straddles a line break and every
+            // full line can be handed to the encoder in one piece.
+            var inIndex = 0
+            while inIndex < input.count {
+                if column == lineLength {
+                    self.writeSeparator(into: output, at: &outIndex)
+                }
+                let count = min((lineLength - column) / 4 * 3, input.count - inIndex)
+                var length = 0
+                Base64._encode(
+                    input: UnsafeBufferPointer(rebasing: input[inIndex ..< inIndex + count]),
+                    buffer: UnsafeMutableBufferPointer(rebasing: output[outIndex...]),
+                    length: &length,
+                    options: options
+                )
+                inIndex += count
+                outIndex += length
+                column += length
+            }
+        }
+    }
+}
+
+// MARK: - Decoding -
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// A decoder that consumes Base-64 incrementally from input that arrives in chunks.
+    ///
+    /// The decoder carries an incomplete group of up to three characters from one call to the
+    /// next, so chunk boundaries may fall anywhere in the input. It accepts the same input as
+    /// `init?(base64Encoded:options:)` does for the concatenated chunks, and throws where that
+    /// initializer would return `nil`.
+    public struct Base64Decoder: Sendable {
+        /// The options used for decoding.
+        public let options: Base64DecodingOptions
+
+        /// The 6 bit values of an incomplete group.
+        private var quantum: (UInt8, UInt8, UInt8) = (0, 0, 0)
+        private var quantumCount = 0
+        /// The number of padding characters seen in the final group.
+        private var paddingCount = 0
+        /// Whether a padded final group has been decoded. Only padding or ignored characters may follow.
+        private var isComplete = false
+
+        /// Creates a decoder.
+        ///
+        /// - parameter options: Decoding options. Default value is `[]`.
+        public init(options: Base64DecodingOptions = []) {
+            self.options = options
+        }
+
+        /// Returns the number of bytes that a buffer passed to `decode(_:into:)` for `count` bytes of
+        /// input, or to `finish(into:)` afterwards, needs to be able to hold.
+        public func maximumDecodedCount(forByteCount count: Int) -> Int {
+            (quantumCount + paddingCount + count + 3) / 4 * 3
+        }
+
+        /// Decodes `bytes` into `output`, keeping an incomplete trailing group for the next call.
+        ///
+        /// - parameter bytes: The next chunk of Base-64, UTF-8 encoded input.
+        /// - parameter output: The buffer to write to. It must hold at least `maximumDecodedCount(forByteCount: bytes.count)` bytes.
+        /// - returns: The number of bytes written to `output`.
+        /// - throws: `CocoaError.coderReadCorrupt` if the input is not valid Base-64.
+        public mutating func decode(_ bytes: UnsafeRawBufferPointer, into output: UnsafeMutableRawBufferPointer) throws -> Int {
+            precondition(output.count >= self.maximumDecodedCount(forByteCount: bytes.count), "The output buffer is too small")
+            let input = bytes.assumingMemoryBound(to: UInt8.self)
+            let output = output.assumingMemoryBound(to: UInt8.self)
+            let ignoreUnknownCharacters = options.contains(.ignoreUnknownCharacters)
+            let urlAlphabet = options.contains(.base64URLAlphabet)
+            var inIndex = 0
+            var outIndex = 0
+
+            while inIndex < input.count {
+                if quantumCount == 0 && paddingCount == 0 && !isComplete && input.count - inIndex >= Base64.vectorKernelMinimumLength {
+                    // At a group boundary, runs of valid characters can be decoded in bulk.
+                    let consumed = _base64shims_decode(input.baseAddress! + inIndex, input.count - inIndex, output.baseAddress! + outIndex, urlAlphabet)
+                    inIndex += consumed
+                    outIndex += consumed / 4 * 3
+                    if inIndex == input.count {
+                        break
+                    }
+                }
+
+                let character = input[inIndex]
+                inIndex += 1
+
+                if let value = Self.value(of: character, urlAlphabet: urlAlphabet) {
+                    guard paddingCount == 0 && !isComplete else {
+                        throw Self.corruptInputError("Unexpected character after padding")
+                    }
+                    switch quantumCount {
+                    case 0: quantum.0 = value
+                    case 1: quantum.1 = value
+                    case 2: quantum.2 = value
+                    default:
+                        output[outIndex] = (quantum.0 << 2) | (quantum.1 >> 4)
+                        output[outIndex + 1] = (quantum.1 << 4) | (quantum.2 >> 2)
+                        output[outIndex + 2] = (quantum.2 << 6) | value
+                        outIndex += 3
+                        quantumCount = 0
+                        continue
+                    }
+                    quantumCount += 1
+                } else if character == Base64.encodePaddingCharacter {
+                    if isComplete && ignoreUnknownCharacters {
+                        continue
+                    }
+                    guard !isComplete && (ignoreUnknownCharacters || !options.contains(.omitPaddingCharacter)) else {
+                        throw Self.corruptInputError("Unexpected padding character")
+                    }
+                    guard quantumCount >= 2 else {
+                        throw Self.corruptInputError("Unexpected padding character")
+                    }
+                    paddingCount += 1
+                    if quantumCount + paddingCount == 4 {
+                        outIndex += self.writeFinalQuantum(into: output, at: outIndex)
+                        isComplete = true
+                    }
+                } else if !ignoreUnknownCharacters {
+                    throw Self.corruptInputError("Invalid character \(character)")
+                }
+            }
+            return outIndex
+        }
+
+        /// Validates the end of the input, writes the bytes of an unpadded final group, and resets
+        /// the decoder so it can be reused.
+        ///
+        /// - parameter output: The buffer to write to. It must hold at least two bytes.
+        /// - returns: The number of bytes written to `output`.
+        /// - throws: `CocoaError.coderReadCorrupt` if the input ended in the middle of a group.
+        public mutating func finish(into output: UnsafeMutableRawBufferPointer) throws -> Int {
+            defer {
+                quantumCount = 0
+                paddingCount = 0
+                isComplete = false
+            }
+            if quantumCount == 0 && paddingCount == 0 {
+                return 0
+            }
+            // Unpadded final groups are only accepted when padding is explicitly optional.
+            guard paddingCount == 0 && quantumCount >= 2 && options.contains(.omitPaddingCharacter) && !options.contains(.ignoreUnknownCharacters) else {
+                throw Self.corruptInputError("Unexpected end of input")
+            }
+            precondition(output.count >= 2, "The output buffer is too small")
+            return self.writeFinalQuantum(into: output.assumingMemoryBound(to: UInt8.self), at: 0)
+        }
+
+        /// Decodes the next chunk of input.
+        ///
+        /// - parameter bytes: The next chunk of Base-64, UTF-8 encoded input.
+        /// - returns: The decoded data for all complete groups seen so far.
+        /// - throws: `CocoaError.coderReadCorrupt` if the input is not valid Base-64.
+        public mutating func decode(_ bytes: some DataProtocol) throws -> Data {
+            var data = Data(count: self.maximumDecodedCount(forByteCount: bytes.count))
+            let written = try data.withUnsafeMutableBytes { output in
+                var written = 0
+                for region in bytes.regions {
+                    let count = try region.withUnsafeBytes { region in
+                        try self.decode(region, into: UnsafeMutableRawBufferPointer(rebasing: output[written...]))
+                    }
+                    written += count
+                }
+                return written
+            }
+            data.count = written
+            return data
+        }
+
+        /// Validates the end of the input, decodes an unpadded final group, and resets the decoder
+        /// so it can be reused.
+        ///
+        /// - throws: `CocoaError.coderReadCorrupt` if the input ended in the middle of a group.
+        public mutating func finish() throws -> Data {
+            var data = Data(count: 2)
+            let written = try data.withUnsafeMutableBytes { output in
+                try self.finish(into: output)
+            }
+            data.count = written
+            return data
+        }
+
+        // MARK: Private
+
+        private static func value(of character: UInt8, urlAlphabet: Bool) -> UInt8? {
+            switch character {
+            case UInt8(ascii: "A")...UInt8(ascii: "Z"): character &- UInt8(ascii: "A")
+            case UInt8(ascii: "a")...UInt8(ascii: "z"): character &- UInt8(ascii: "a") &+ 26
+            case UInt8(ascii: "0")...UInt8(ascii: "9"): character &- UInt8(ascii: "0") &+ 52
+            case UInt8(ascii: "+") where !urlAlphabet, UInt8(ascii: "-") where urlAlphabet: 62
+            case UInt8(ascii: "/") where !urlAlphabet, UInt8(ascii: "_") where urlAlphabet: 63
+            default: nil
+            }
+        }
+
+        private static func corruptInputError(_ description: String) -> CocoaError {
+            CocoaError(.coderReadCorrupt, userInfo: [NSDebugDescriptionErrorKey: "Invalid Base-64 input: \(description)"])
+        }
+
+        /// Writes the bytes of a group that holds two or three characters.
+        private mutating func writeFinalQuantum(into output: UnsafeMutableBufferPointer<UInt8>, at outIndex: Int) -> Int {
+            assert(quantumCount == 2 || quantumCount == 3)
+            output[outIndex] = (quantum.0 << 2) | (quantum.1 >> 4)
+            let count = quantumCount - 1
+            if quantumCount == 3 {
+                output[outIndex + 1] = (quantum.1 << 4) | (quantum.2 >> 2)
+            }
+            quantumCount = 0
+            paddingCount = 0
+            return count
+        }
+    }
+}
+
+// MARK: - AsyncSequence -
+
+@available(FoundationPreview 6.5, *)
+extension AsyncSequence where Element == Data {
+    /// Returns an asynchronous sequence of the Base-64 encoded chunks of this sequence.
+    ///
+    /// Only one chunk is encoded at a time, so memory use does not depend on the total length.
+    ///
+    /// - parameter options: The options to use for the encoding. Default value is `[]`.
+    public func base64EncodedData(options: Data.Base64EncodingOptions = []) -> some AsyncSequence<Data, any Error> {
+        AsyncBase64EncodingSequence(base: self, options: options)
+    }
+
+    /// Returns an asynchronous sequence of the decoded chunks of this sequence of Base-64, UTF-8 encoded data.
+    ///
+    /// Only one chunk is decoded at a time, so memory use does not depend on the total length.
+    /// Iteration throws `CocoaError.coderReadCorrupt` once invalid input is encountered.
+    ///
+    /// - parameter options: Decoding options. Default value is `[]`.
+    public func base64DecodedData(options: Data.Base64DecodingOptions = []) -> some AsyncSequence<Data, any Error> {
+        AsyncBase64DecodingSequence(base: self, options: options)
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+private struct AsyncBase64EncodingSequence<Base: AsyncSequence>: AsyncSequence where Base.Element == Data {
+    typealias Element = Data
+
+    let base: Base
+    let options: Data.Base64EncodingOptions
+
+    func makeAsyncIterator() -> Iterator {
+        Iterator(base: base.makeAsyncIterator(), encoder: Data.Base64Encoder(options: options))
+    }
+
+    struct Iterator: AsyncIteratorProtocol {
+        typealias Failure = any Error
+
+        var base: Base.AsyncIterator
+        var encoder: Data.Base64Encoder
+        var isFinished = false
+
+        mutating func next() async throws -> Data? {
+            while !isFinished {
+                guard let chunk = try await base.next() else {
+                    isFinished = true
+                    let tail = encoder.finish()
+                    return tail.isEmpty ? nil : tail
+                }
+                let encoded = encoder.encode(chunk)
+                if !encoded.isEmpty {
+                    return encoded
+                }
+            }
+            return nil
+        }
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+private struct AsyncBase64DecodingSequence<Base: AsyncSequence>: AsyncSequence where Base.Element == Data {
+    typealias Element = Data
+
+    let base: Base
+    let options: Data.Base64DecodingOptions
+
+    func makeAsyncIterator() -> Iterator {
+        Iterator(base: base.makeAsyncIterator(), decoder: Data.Base64Decoder(options: options))
+    }
+
+    struct Iterator: AsyncIteratorProtocol {
+        typealias Failure = any Error
+
+        var base: Base.AsyncIterator
+        var decoder: Data.Base64Decoder
+        var isFinished = false
+
+        mutating func next() async throws -> Data? {
+            while !isFinished {
+                guard let chunk = try await base.next() else {
+                    isFinished = true
+                    let tail = try decoder.finish()
+                    return tail.isEmpty ? nil : tail
+                }
+                let decoded: Data
+                do {
+                    decoded = try decoder.decode(chunk)
+                } catch {
+                    isFinished = true
+                    throw error
+                }
+                if !decoded.isEmpty {
+                    return decoded
+                }
+            }
+            return nil
+        }
+    }
+}
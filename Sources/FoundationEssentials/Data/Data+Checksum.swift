@@ -0,0 +1,226 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+internal import _FoundationCShims
+
+extension UnsafeRawBufferPointer {
+    fileprivate var _checksumBytes: UnsafePointer<UInt8>? {
+        baseAddress?.assumingMemoryBound(to: UInt8.self)
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension DataProtocol {
+    /// Returns the CRC-32C (Castagnoli) checksum of the bytes.
+    ///
+    /// This is the checksum used by iSCSI, SCTP, ext4 and many storage and framing formats. It is computed with the
+    /// CRC instructions of the CPU when they are available.
+    public func crc32cChecksum() -> UInt32 {
+        var checksum = Data.CRC32C()
+        checksum.update(self)
+        return checksum.value
+    }
+
+    /// Returns the 64-bit XXH3 hash of the bytes.
+    ///
+    /// XXH3 is a fast non-cryptographic hash, suitable for detecting accidental changes and for deduplication, but not
+    /// for protecting against deliberate tampering. The result is stable across platforms and releases.
+    ///
+    /// - parameter seed: A value that selects a different hash function of the same family. Default value is `0`.
+    public func xxh3Hash(seed: UInt64 = 0) -> UInt64 {
+        let regions = self.regions
+        guard regions.count > 1 else {
+            guard let region = regions.first else {
+                return _checksumshims_xxh3_64(nil, 0, seed)
+            }
+            return region.withUnsafeBytes { _checksumshims_xxh3_64($0._checksumBytes, $0.count, seed) }
+        }
+        return Data.XXH3._withState(seed: seed, regions: regions) { _checksumshims_xxh3_digest64($0) }
+    }
+
+    /// Returns the 128-bit XXH3 hash of the bytes.
+    ///
+    /// Use this variant when collisions between a very large number of values must be improbable, such as for content
+    /// addressed storage.
+    ///
+    /// - parameter seed: A value that selects a different hash function of the same family. Default value is `0`.
+    public func xxh3Hash128(seed: UInt64 = 0) -> UInt128 {
+        var low: UInt64 = 0
+        var high: UInt64 = 0
+        let regions = self.regions
+        if regions.count > 1 {
+            Data.XXH3._withState(seed: seed, regions: regions) { _checksumshims_xxh3_digest128($0, &low, &high) }
+        } else if let region = regions.first {
+            region.withUnsafeBytes { _checksumshims_xxh3_128($0._checksumBytes, $0.count, seed, &low, &high) }
+        } else {
+            _checksumshims_xxh3_128(nil, 0, seed, &low, &high)
+        }
+        return UInt128(high) << 64 | UInt128(low)
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// A CRC-32C (Castagnoli) checksum computed incrementally from input that arrives in chunks.
+    ///
+    ///     var checksum = Data.CRC32C()
+    ///     for try await frame in frames {
+    ///         checksum.update(frame)
+    ///     }
+    ///     let isIntact = checksum.value == expectedChecksum
+    public struct CRC32C: Hashable, Sendable {
+        /// The checksum of the input so far.
+        public private(set) var value: UInt32
+
+        /// Creates a checksum of no input.
+        public init() {
+            value = 0
+        }
+
+        /// Adds `bytes` to the input.
+        public mutating func update(_ bytes: UnsafeRawBufferPointer) {
+            value = _checksumshims_crc32c(value, bytes._checksumBytes, bytes.count)
+        }
+
+        /// Adds the bytes of `data` to the input.
+        public mutating func update(_ data: some DataProtocol) {
+            for region in data.regions {
+                region.withUnsafeBytes { self.update($0) }
+            }
+        }
+    }
+
+    /// An XXH3 hash computed incrementally from input that arrives in chunks.
+    ///
+    /// Hashing the input in chunks produces the same result as `xxh3Hash(seed:)` or `xxh3Hash128(seed:)` on the
+    /// concatenated input. The hash can be read at any point, and more input added afterwards.
+    ///
+    ///     var hash = Data.XXH3()
+    ///     for try await chunk in upload {
+    ///         hash.update(chunk)
+    ///     }
+    ///     let key = hash.value128
+    public struct XXH3: Sendable {
+        /// The C state is large, so it lives on the heap and is copied when a copy of the hash is updated.
+        private final class State: @unchecked Sendable {
+            let pointer: UnsafeMutablePointer<_checksumshims_xxh3_state>
+
+            init(seed: UInt64) {
+                pointer = .allocate(capacity: 1)
+                _checksumshims_xxh3_reset(pointer, seed)
+            }
+
+            init(copying other: State) {
+                pointer = .allocate(capacity: 1)
+                pointer.initialize(to: other.pointer.pointee)
+            }
+
+            deinit {
+                pointer.deallocate()
+            }
+        }
+
+        private var state: State
+
+        /// The seed the hash was created with.
+        public let seed: UInt64
+
+        /// Creates a hash of no input.
+        ///
+        /// - parameter seed: A value that selects a different hash function of the same family. Default value is `0`.
+        public init(seed: UInt64 = 0) {
+            self.seed = seed
+            self.state = State(seed: seed)
+        }
+
+        /// Adds `bytes` to the input.
+        public mutating func update(_ bytes: UnsafeRawBufferPointer) {
+            guard bytes.count > 0 else {
+                return
+            }
+            if !isKnownUniquelyReferenced(&state) {
+                state = State(copying: state)
+            }
+            _checksumshims_xxh3_update(state.pointer, bytes._checksumBytes, bytes.count)
+        }
+
+        /// Adds the bytes of `data` to the input.
+        public mutating func update(_ data: some DataProtocol) {
+            for region in data.regions {
+                region.withUnsafeBytes { self.update($0) }
+            }
+        }
+
+        /// The 64-bit hash of the input so far.
+        public var value: UInt64 {
+            _checksumshims_xxh3_digest64(state.pointer)
+        }
+
+        /// The 128-bit hash of the input so far.
+        public var value128: UInt128 {
+            var low: UInt64 = 0
+            var high: UInt64 = 0
+            _checksumshims_xxh3_digest128(state.pointer, &low, &high)
+            return UInt128(high) << 64 | UInt128(low)
+        }
+
+        /// Hashes `regions` with a state on the stack, for the one-shot functions on `DataProtocol`.
+        static func _withState<Regions: Collection, R>(seed: UInt64, regions: Regions, _ digest: (UnsafePointer<_checksumshims_xxh3_state>) -> R) -> R where Regions.Element: ContiguousBytes {
+            withUnsafeTemporaryAllocation(of: _checksumshims_xxh3_state.self, capacity: 1) { buffer in
+                let state = buffer.baseAddress!
+                _checksumshims_xxh3_reset(state, seed)
+                for region in regions {
+                    region.withUnsafeBytes { _checksumshims_xxh3_update(state, $0._checksumBytes, $0.count) }
+                }
+                return digest(state)
+            }
+        }
+    }
+
+    /// A key for sets and dictionaries that hashes a large `Data` by its count and the bytes at either end.
+    ///
+    /// `Data` hashes all of its bytes, which makes using large values as keys expensive. This wrapper hashes at most
+    /// `2 * sampleLength` bytes, and compares all bytes only when two keys have the same hash. It is a good fit when
+    /// values of the same size usually differ near the start or the end, such as files with headers or serialized
+    /// messages with a trailing checksum. Values that only differ in the middle collide, which makes lookups among
+    /// many of them slow.
+    ///
+    ///     var seen = Set<Data.SampledHashKey>()
+    ///     if seen.insert(Data.SampledHashKey(payload)).inserted {
+    ///         store(payload)
+    ///     }
+    public struct SampledHashKey: Hashable, Sendable {
+        /// The number of bytes at the start and at the end of the data that are hashed.
+        public static var sampleLength: Int { 64 }
+
+        /// The wrapped data.
+        public let data: Data
+
+        /// Creates a key for `data`.
+        public init(_ data: Data) {
+            self.data = data
+        }
+
+        public func hash(into hasher: inout Hasher) {
+            hasher.combine(data.count)
+            data.withUnsafeBytes { bytes in
+                let sampleLength = Self.sampleLength
+                if bytes.count <= 2 * sampleLength {
+                    hasher.combine(bytes: bytes)
+                } else {
+                    hasher.combine(bytes: UnsafeRawBufferPointer(rebasing: bytes.prefix(sampleLength)))
+                    hasher.combine(bytes: UnsafeRawBufferPointer(rebasing: bytes.suffix(sampleLength)))
+                }
+            }
+        }
+    }
+}
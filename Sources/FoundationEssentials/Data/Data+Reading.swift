@@ -121,6 +121,66 @@ private func shouldMapFileDescriptor(_ fd: Int32, path: borrowing some FileSyste
     return false
 }
 
+#if !os(Windows)
+/// Passes the access pattern hints in `options` for the whole file on to the kernel. These are only hints, so failures are ignored.
+private func adviseFileDescriptor(_ fd: Int32, length: Int, options: Data.ReadingOptions) {
+#if os(Linux) || os(Android)
+    if options.contains(.sequentialAccess) {
+        _ = posix_fadvise(fd, 0, off_t(length), POSIX_FADV_SEQUENTIAL)
+    }
+    if options.contains(.prefetch) {
+        _ = posix_fadvise(fd, 0, off_t(length), POSIX_FADV_WILLNEED)
+    }
+#elseif canImport(Darwin)
+    if options.contains(.sequentialAccess) {
+        _ = fcntl(fd, F_RDAHEAD, 1)
+    }
+    if options.contains(.prefetch) {
+        var advisory = radvisory(ra_offset: 0, ra_count: Int32(clamping: length))
+        _ = fcntl(fd, F_RDADVISE, &advisory)
+    }
+#endif
+}
+
+#if !NO_FILESYSTEM
+/// Passes the access pattern hints in `options` for a mapped file on to the kernel. These are only hints, so failures are ignored.
+private func adviseMappedRegion(_ bytes: UnsafeMutableRawPointer, length: Int, options: Data.ReadingOptions) {
+#if canImport(Darwin) || os(Linux) || os(Android)
+    if options.contains(.sequentialAccess) {
+        _ = madvise(bytes, length, MADV_SEQUENTIAL)
+    }
+#if os(Linux) || os(Android)
+    // With `populateMapping` the pages were already faulted in by `mmap`.
+    let willNeed = options.contains(.prefetch) && !options.contains(.populateMapping)
+#else
+    // There is no `MAP_POPULATE`; starting readahead for the whole mapping is the closest equivalent.
+    let willNeed = options.contains(.prefetch) || options.contains(.populateMapping)
+#endif
+    if willNeed {
+        _ = madvise(bytes, length, MADV_WILLNEED)
+    }
+#endif
+}
+#endif
+
+/// Allocates the buffer that a file of `byteCount` bytes is read into. The result must be released with `free`.
+private func allocateReadBuffer(byteCount: Int, options: Data.ReadingOptions) -> UnsafeMutableRawPointer? {
+#if os(Linux)
+    // Transparent huge pages can only back 2 MB aligned ranges, which `malloc` does not provide. The advice has
+    // to be given before the buffer is first touched, so that the page faults during the read allocate huge pages.
+    let hugePageSize = 2 * 1024 * 1024
+    if options.contains(.preferHugePages) && byteCount >= hugePageSize {
+        var bytes: UnsafeMutableRawPointer? = nil
+        if posix_memalign(&bytes, hugePageSize, byteCount) == 0, let bytes {
+            _ = madvise(bytes, byteCount, MADV_HUGEPAGE)
+            return bytes
+        }
+    }
+#endif
+    return malloc(byteCount)
+}
+#endif
+
 // MARK: - Reading
 
 #if FOUNDATION_FRAMEWORK
@@ -364,6 +424,10 @@ internal func readBytesFromFile(path inPath: borrowing some FileSystemRepresenta
     }
 #endif
     
+    if fileSize > 0 {
+        adviseFileDescriptor(fd, length: fileSize, options: options)
+    }
+    
     let result: ReadBytesResult
     let localProgress = (reportProgress && Progress.current() != nil) ? Progress(totalUnitCount: Int64(fileSize)) : nil
     
@@ -393,13 +457,18 @@ internal func readBytesFromFile(path inPath: borrowing some FileSystemRepresenta
         localProgress?.completedUnitCount = 1
     } else if shouldMap {
 #if !NO_FILESYSTEM
+#if os(Linux) || os(Android)
+        let mapFlags = MAP_PRIVATE | (options.contains(.populateMapping) ? MAP_POPULATE : 0)
+#else
+        let mapFlags = MAP_PRIVATE
+#endif
 #if canImport(Android)
-        let bytes = mmap(nil, Int(fileSize), PROT_READ, MAP_PRIVATE, fd, 0)
+        let bytes = mmap(nil, Int(fileSize), PROT_READ, mapFlags, fd, 0)
         if bytes == UnsafeMutableRawPointer(bitPattern: -1) {
             throw CocoaError.errorWithFilePath(inPath, errno: errno, reading: true)
         }
 #else
-        guard let bytes = mmap(nil, Int(fileSize), PROT_READ, MAP_PRIVATE, fd, 0) else {
+        guard let bytes = mmap(nil, Int(fileSize), PROT_READ, mapFlags, fd, 0) else {
             throw CocoaError.errorWithFilePath(inPath, errno: errno, reading: true)
         }
         
@@ -408,6 +477,8 @@ internal func readBytesFromFile(path inPath: borrowing some FileSystemRepresenta
         }
 #endif
         
+        adviseMappedRegion(bytes, length: Int(fileSize), options: options)
+        
         // Using bytes as the unit in this case doesn't really make any sense, since the amount of work required for mmap isn't meanginfully proportional to the size being mapped.
         localProgress?.totalUnitCount = 1
         localProgress?.completedUnitCount = 1
@@ -419,7 +490,7 @@ internal func readBytesFromFile(path inPath: borrowing some FileSystemRepresenta
 #endif
     } else {
         // We've verified above that fileSize will fit in `Int`
-        guard let bytes = malloc(Int(fileSize)) else {
+        guard let bytes = allocateReadBuffer(byteCount: Int(fileSize), options: options) else {
             throw CocoaError.errorWithFilePath(inPath, errno: ENOMEM, reading: true)
         }
         let buffer = UnsafeMutableRawBufferPointer(start: bytes, count: Int(fileSize))
@@ -456,10 +527,16 @@ private func readBytesFromFileDescriptor(_ fd: Int32, path: borrowing some FileS
     let localProgress: Progress?
     let length = inBuffer.freeCapacity
     
+    // Chunks are multiples of this size, so that every read after the first one starts at an aligned offset in
+    // the file and in the buffer.
+    let chunkAlignment = 64 * 1024
+    // The largest aligned chunk below Int32.max. Some platforms return an error for larger requests.
+    let maximumChunkSize = 1 << 30
+    
     if Progress.current() != nil && reportProgress {
         localProgress = Progress(totalUnitCount: Int64(inBuffer.freeCapacity))
         // To report progress, we have to try reading in smaller chunks than the whole file. Aim for about 1% increments.
-        preferredChunkSize = max(inBuffer.freeCapacity / 100, 1024 * 4)
+        preferredChunkSize = (max(inBuffer.freeCapacity / 100, 1) + chunkAlignment - 1) / chunkAlignment * chunkAlignment
     } else {
         localProgress = nil
         // Get it all in one go, if possible
@@ -471,12 +548,11 @@ private func readBytesFromFileDescriptor(_ fd: Int32, path: borrowing some FileS
             throw CocoaError(.userCancelled)
         }
         
-        // We will only request a max of Int32.max bytes. Some platforms will return an error over that amount.
-        var numBytesRequested = CUnsignedInt(clamping: min(preferredChunkSize, Int(CInt.max)))
+        var numBytesRequested = CUnsignedInt(clamping: min(preferredChunkSize, maximumChunkSize))
         
         // Furthermore, don't request more than the number of bytes remaining
         if numBytesRequested > inBuffer.freeCapacity {
-            numBytesRequested = CUnsignedInt(clamping: min(inBuffer.freeCapacity, Int(CInt.max)))
+            numBytesRequested = CUnsignedInt(clamping: min(inBuffer.freeCapacity, maximumChunkSize))
         }
 
         var numBytesRead: CInt = 0
@@ -571,3 +647,27 @@ extension Data {
         self = try readDataFromFile(path: path, reportProgress: reportProgress, maxLength: nil, options: options)
     }
 }
+
+extension Data.ReadingOptions {
+    /// A hint that the file will be read from start to end, so the system can read ahead more aggressively
+    /// and drop pages behind the read.
+    @available(FoundationPreview 6.5, *)
+    public static let sequentialAccess = Self(rawValue: 1 << 8)
+
+    /// A hint to start reading the whole file into the file system cache right away. This is most useful
+    /// for mapped files, whose pages would otherwise be read one page fault at a time on first access.
+    @available(FoundationPreview 6.5, *)
+    public static let prefetch = Self(rawValue: 1 << 9)
+
+    /// Fault in all pages of a mapped file before returning, instead of on first access.
+    ///
+    /// This moves the cost of reading the file to `init(contentsOf:options:)`. It has no effect unless the
+    /// file is mapped. On platforms that cannot populate a mapping eagerly it behaves like `prefetch`.
+    @available(FoundationPreview 6.5, *)
+    public static let populateMapping = Self(rawValue: 1 << 10)
+
+    /// Back the buffer of a large file that is read, rather than mapped, with huge pages where the system
+    /// supports them, which reduces page faults and TLB misses when the data is used.
+    @available(FoundationPreview 6.5, *)
+    public static let preferHugePages = Self(rawValue: 1 << 11)
+}
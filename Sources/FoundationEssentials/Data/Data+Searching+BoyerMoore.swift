@@ -13,7 +13,6 @@
 @available(macOS 10.10, iOS 8.0, watchOS 2.0, tvOS 9.0, *)
 extension Data {
     func _searchBoyerMoore(_ needle: Span<UInt8>, in searchRange: Range<Index>, backwards: Bool) -> Range<Index>? {
-        let haystack = span.extracting(_rangeRelativeToStartIndex(searchRange))
         let needleLength = needle.count
 
         var badCharacterShift: InlineArray<256, Int> = .init(repeating: needleLength)
@@ -37,66 +36,99 @@ extension Data {
                     suffixLengths: &suffixLengthsSpan
                 )
 
-                if backwards {
-                    var scanNeedle = 0
-                    var scanHaystack = haystack.count - needleLength
-
-                    while scanHaystack >= 0, scanNeedle < needleLength {
-                        // Use unchecked accesses in this descending search loop to avoid bounds checks that are not
-                        // currently eliminated. scanNeedle is guarded by the loop condition. scanHaystack starts at
-                        // the last possible match position; matches advance it in lockstep with scanNeedle, and
-                        // mismatches are revalidated by the loop condition.
-                        let haystackByte = haystack[unchecked: scanHaystack]
-                        if haystackByte == needle[unchecked: scanNeedle] {
-                            scanHaystack += 1
-                            scanNeedle += 1
-                        } else {
-                            let shift = Swift.max(
-                                badCharacterShift[Int(haystackByte)],
-                                goodSubstringShiftSpan[unchecked: scanNeedle]
-                            )
-                            scanHaystack -= shift
-                            scanNeedle = 0
-                        }
-                    }
+                return _searchBoyerMoore(
+                    needle,
+                    badCharacterShift: badCharacterShift.span,
+                    goodSubstringShift: goodSubstringShift.span,
+                    in: searchRange,
+                    backwards: backwards
+                )
+            }
+        }
+    }
 
-                    guard scanNeedle == needleLength else {
-                        return nil
-                    }
+    func _searchBoyerMoore(_ needle: Span<UInt8>, tables: _BoyerMooreTables, in searchRange: Range<Index>, backwards: Bool) -> Range<Index>? {
+        tables.badCharacterShift.withUnsafeBufferPointer { badCharacterShift in
+            tables.goodSubstringShift.withUnsafeBufferPointer { goodSubstringShift in
+                _searchBoyerMoore(
+                    needle,
+                    badCharacterShift: badCharacterShift.span,
+                    goodSubstringShift: goodSubstringShift.span,
+                    in: searchRange,
+                    backwards: backwards
+                )
+            }
+        }
+    }
 
-                    let lowerBound = searchRange.lowerBound + scanHaystack - needleLength
-                    return lowerBound..<(lowerBound + needleLength)
+    private func _searchBoyerMoore(
+        _ needle: Span<UInt8>,
+        badCharacterShift: Span<Int>,
+        goodSubstringShift: Span<Int>,
+        in searchRange: Range<Index>,
+        backwards: Bool
+    ) -> Range<Index>? {
+        let haystack = span.extracting(_rangeRelativeToStartIndex(searchRange))
+        let needleLength = needle.count
+
+        if backwards {
+            var scanNeedle = 0
+            var scanHaystack = haystack.count - needleLength
+
+            while scanHaystack >= 0, scanNeedle < needleLength {
+                // Use unchecked accesses in this descending search loop to avoid bounds checks that are not
+                // currently eliminated. scanNeedle is guarded by the loop condition. scanHaystack starts at
+                // the last possible match position; matches advance it in lockstep with scanNeedle, and
+                // mismatches are revalidated by the loop condition.
+                let haystackByte = haystack[unchecked: scanHaystack]
+                if haystackByte == needle[unchecked: scanNeedle] {
+                    scanHaystack += 1
+                    scanNeedle += 1
                 } else {
-                    var scanNeedle = needleLength - 1
-                    var scanHaystack = needleLength - 1
-
-                    while scanHaystack < haystack.count, scanNeedle >= 0 {
-                        if haystack[scanHaystack] == needle[scanNeedle] {
-                            scanHaystack -= 1
-                            scanNeedle -= 1
-                        } else {
-                            let shift = Swift.max(
-                                badCharacterShift[Int(haystack[scanHaystack])],
-                                goodSubstringShift[scanNeedle]
-                            )
-                            scanHaystack += shift
-                            scanNeedle = needleLength - 1
-                        }
-                    }
+                    let shift = Swift.max(
+                        badCharacterShift[Int(haystackByte)],
+                        goodSubstringShift[unchecked: scanNeedle]
+                    )
+                    scanHaystack -= shift
+                    scanNeedle = 0
+                }
+            }
 
-                    guard scanNeedle < 0 else {
-                        return nil
-                    }
+            guard scanNeedle == needleLength else {
+                return nil
+            }
+
+            let lowerBound = searchRange.lowerBound + scanHaystack - needleLength
+            return lowerBound..<(lowerBound + needleLength)
+        } else {
+            var scanNeedle = needleLength - 1
+            var scanHaystack = needleLength - 1
 
-                    let lowerBound = searchRange.lowerBound + scanHaystack + 1
-                    return lowerBound..<(lowerBound + needleLength)
+            while scanHaystack < haystack.count, scanNeedle >= 0 {
+                if haystack[scanHaystack] == needle[scanNeedle] {
+                    scanHaystack -= 1
+                    scanNeedle -= 1
+                } else {
+                    let shift = Swift.max(
+                        badCharacterShift[Int(haystack[scanHaystack])],
+                        goodSubstringShift[scanNeedle]
+                    )
+                    scanHaystack += shift
+                    scanNeedle = needleLength - 1
                 }
             }
+
+            guard scanNeedle < 0 else {
+                return nil
+            }
+
+            let lowerBound = searchRange.lowerBound + scanHaystack + 1
+            return lowerBound..<(lowerBound + needleLength)
         }
     }
 
     @_lifetime(badCharacterShift: copy badCharacterShift)
-    private static func _computeBadCharacterShift(
+    static func _computeBadCharacterShift(
         for needle: Span<UInt8>,
         backwards: Bool,
         into badCharacterShift: inout MutableSpan<Int>
@@ -115,7 +147,7 @@ extension Data {
 
     @_lifetime(shift: copy shift)
     @_lifetime(suffixLengths: copy suffixLengths)
-    private static func _computeGoodSubstringShift(
+    static func _computeGoodSubstringShift(
         for needle: Span<UInt8>,
         backwards: Bool,
         shift: inout MutableSpan<Int>,
@@ -227,3 +259,38 @@ extension Data {
         }
     }
 }
+
+/// The shift tables for a Boyer-Moore search, kept by `Data.Searcher` so that they are computed only once per pattern.
+struct _BoyerMooreTables: Sendable {
+    let badCharacterShift: [Int]
+    let goodSubstringShift: [Int]
+
+    init(for needle: Span<UInt8>, backwards: Bool) {
+        let needleLength = needle.count
+
+        var badCharacterShift = [Int](repeating: needleLength, count: 256)
+        badCharacterShift.withUnsafeMutableBufferPointer { buffer in
+            var span = buffer.mutableSpan
+            Data._computeBadCharacterShift(for: needle, backwards: backwards, into: &span)
+        }
+
+        var goodSubstringShift = [Int](repeating: needleLength, count: needleLength)
+        goodSubstringShift.withUnsafeMutableBufferPointer { buffer in
+            withUnsafeTemporaryAllocation(of: Int.self, capacity: needleLength) { suffixLengths in
+                suffixLengths.initialize(repeating: 0)
+
+                var shiftSpan = buffer.mutableSpan
+                var suffixLengthsSpan = suffixLengths.mutableSpan
+                Data._computeGoodSubstringShift(
+                    for: needle,
+                    backwards: backwards,
+                    shift: &shiftSpan,
+                    suffixLengths: &suffixLengthsSpan
+                )
+            }
+        }
+
+        self.badCharacterShift = badCharacterShift
+        self.goodSubstringShift = goodSubstringShift
+    }
+}
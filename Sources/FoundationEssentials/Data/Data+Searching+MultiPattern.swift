@@ -0,0 +1,193 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// A search for the first occurrence of any of several byte patterns, prepared once and reused
+    /// for many searches.
+    ///
+    /// The patterns are compiled into an Aho-Corasick automaton, so a search looks at every byte of
+    /// the data at most once, no matter how many patterns there are.
+    ///
+    /// Of all matches, the one that starts first is reported. If several patterns match at the same
+    /// position, the one that comes first in `patterns` is reported.
+    ///
+    ///     let levels = Data.MultiPatternSearcher(patterns: ["ERROR", "FATAL"].map { Data($0.utf8) })
+    ///     if let match = log.firstMatch(of: levels) {
+    ///         print("Found \(levels.patterns[match.patternIndex]) at \(match.range)")
+    ///     }
+    public struct MultiPatternSearcher: Sendable {
+        /// The patterns to search for.
+        public let patterns: [Data]
+
+        /// Maps each byte to its column in `transitions`. Bytes that do not occur in any pattern share a column.
+        private let byteClasses: [UInt8]
+        private let classCount: Int
+        /// The next state for each state and byte class, one row per state. State 0 is the root.
+        private let transitions: [Int32]
+        /// The index of the longest pattern that ends in each state, or -1.
+        private let matchPatterns: [Int32]
+        /// The length of the pattern in `matchPatterns`, or 0.
+        private let matchLengths: [Int32]
+        private let maximumPatternLength: Int
+        /// The first byte shared by all patterns, if there is one. From the root state the search can
+        /// skip directly to the next occurrence of it.
+        private let commonFirstByte: UInt8?
+
+        /// Creates a searcher for the given patterns.
+        ///
+        /// - parameter patterns: The byte patterns to search for. Empty patterns never match.
+        public init(patterns: [Data]) {
+            self.patterns = patterns
+
+            // Byte classes keep the rows short: only bytes that occur in a pattern need their own column.
+            var occurs = [Bool](repeating: false, count: 256)
+            for pattern in patterns {
+                for byte in pattern {
+                    occurs[Int(byte)] = true
+                }
+            }
+            var byteClasses = [UInt8](repeating: 0, count: 256)
+            var classCount = 0
+            for byte in 0 ..< 256 where occurs[byte] {
+                byteClasses[byte] = UInt8(truncatingIfNeeded: classCount)
+                classCount += 1
+            }
+            if classCount < 256 {
+                for byte in 0 ..< 256 where !occurs[byte] {
+                    byteClasses[byte] = UInt8(truncatingIfNeeded: classCount)
+                }
+                classCount += 1
+            }
+
+            // Build the trie. Missing transitions are -1 until they are filled in below.
+            var transitions = [Int32](repeating: -1, count: classCount)
+            var matchPatterns: [Int32] = [-1]
+            var matchLengths: [Int32] = [0]
+            for (index, pattern) in patterns.enumerated() where !pattern.isEmpty {
+                var state = 0
+                for byte in pattern {
+                    let slot = state * classCount + Int(byteClasses[Int(byte)])
+                    if transitions[slot] < 0 {
+                        transitions[slot] = Int32(matchPatterns.count)
+                        transitions.append(contentsOf: repeatElement(-1, count: classCount))
+                        matchPatterns.append(-1)
+                        matchLengths.append(0)
+                    }
+                    state = Int(transitions[slot])
+                }
+                // For duplicate patterns, the first one wins.
+                if matchPatterns[state] < 0 {
+                    matchPatterns[state] = Int32(index)
+                    matchLengths[state] = Int32(pattern.count)
+                }
+            }
+
+            // Visit the states in breadth-first order, so the failure state of every state (the longest
+            // proper suffix that is also in the trie) is complete before the state itself. Missing
+            // transitions are replaced by those of the failure state, which turns the trie into a DFA.
+            var failures = [Int32](repeating: 0, count: matchPatterns.count)
+            var queue: [Int] = []
+            queue.reserveCapacity(matchPatterns.count)
+            for byteClass in 0 ..< classCount {
+                if transitions[byteClass] < 0 {
+                    transitions[byteClass] = 0
+                } else {
+                    queue.append(Int(transitions[byteClass]))
+                }
+            }
+            var head = 0
+            while head < queue.count {
+                let state = queue[head]
+                head += 1
+                let failure = Int(failures[state])
+                // A pattern ending in the state itself is longer than any ending in its failure state.
+                if matchPatterns[state] < 0 {
+                    matchPatterns[state] = matchPatterns[failure]
+                    matchLengths[state] = matchLengths[failure]
+                }
+                for byteClass in 0 ..< classCount {
+                    let slot = state * classCount + byteClass
+                    let fallback = transitions[failure * classCount + byteClass]
+                    let child = transitions[slot]
+                    if child < 0 {
+                        transitions[slot] = fallback
+                    } else {
+                        failures[Int(child)] = fallback
+                        queue.append(Int(child))
+                    }
+                }
+            }
+
+            let firstBytes = Set(patterns.lazy.compactMap(\.first))
+
+            self.byteClasses = byteClasses
+            self.classCount = classCount
+            self.transitions = transitions
+            self.matchPatterns = matchPatterns
+            self.matchLengths = matchLengths
+            self.maximumPatternLength = patterns.lazy.map(\.count).max() ?? 0
+            self.commonFirstByte = firstBytes.count == 1 ? firstBytes.first : nil
+        }
+
+        /// Returns the offset and pattern index of the first match in `haystack`.
+        func _firstMatch(in haystack: Span<UInt8>) -> (offset: Int, patternIndex: Int)? {
+            transitions.withUnsafeBufferPointer { transitions in
+                byteClasses.withUnsafeBufferPointer { byteClasses in
+                    var state = 0
+                    var best: (offset: Int, patternIndex: Int)? = nil
+                    var end = haystack.count
+                    var i = 0
+                    while i < end {
+                        if state == 0, let commonFirstByte {
+                            guard let next = haystack.extracting(i ..< end).firstIndex(of: commonFirstByte) else {
+                                break
+                            }
+                            i += next
+                        }
+                        state = Int(transitions[state &* classCount &+ Int(byteClasses[Int(haystack[i])])])
+                        let length = Int(matchLengths[state])
+                        if length > 0 {
+                            let candidate = (offset: i - length + 1, patternIndex: Int(matchPatterns[state]))
+                            if best.map({ candidate.offset < $0.offset || (candidate.offset == $0.offset && candidate.patternIndex < $0.patternIndex) }) ?? true {
+                                best = candidate
+                                // A match that starts at or before this one must end within the longest pattern length.
+                                end = Swift.min(end, candidate.offset + maximumPatternLength)
+                            }
+                        }
+                        i += 1
+                    }
+                    return best
+                }
+            }
+        }
+    }
+
+    /// Find the first occurrence of any of the patterns of the given searcher in the content of this `Data`.
+    ///
+    /// - parameter searcher: The searcher for the patterns to be searched for.
+    /// - parameter range: The range of this data in which to perform the search. Default value is `nil`, which means the entire content of this data.
+    /// - returns: The location of the first match and the index of the matching pattern in `searcher.patterns`, or nil if none of the patterns could be found.
+    /// - precondition: `range` must be in the bounds of the Data.
+    public func firstMatch(of searcher: MultiPatternSearcher, in range: Range<Index>? = nil) -> (range: Range<Index>, patternIndex: Int)? {
+        let searchRange = range ?? startIndex..<endIndex
+
+        precondition(searchRange.lowerBound >= startIndex && searchRange.upperBound <= endIndex, "Range out of bounds")
+
+        let haystack = span.extracting(_rangeRelativeToStartIndex(searchRange))
+        guard let match = searcher._firstMatch(in: haystack) else {
+            return nil
+        }
+        let lowerBound = searchRange.lowerBound + match.offset
+        return (lowerBound..<(lowerBound + searcher.patterns[match.patternIndex].count), match.patternIndex)
+    }
+}
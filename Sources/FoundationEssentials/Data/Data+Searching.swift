@@ -10,6 +10,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+internal import _FoundationCShims
+
 @available(macOS 10.10, iOS 8.0, watchOS 2.0, tvOS 9.0, *)
 extension Data {
 #if FOUNDATION_FRAMEWORK
@@ -38,6 +40,12 @@ extension Data {
     /// - returns: A `Range` specifying the location of the found data, or nil if a match could not be found.
     /// - precondition: `range` must be in the bounds of the Data.
     public func range(of dataToFind: Data, options: Data.SearchOptions = [], in range: Range<Index>? = nil) -> Range<Index>? {
+        _range(of: dataToFind, tables: nil, options: options, in: range)
+    }
+
+    /// The implementation of the `range(of:options:in:)` variants. `tables` holds Boyer-Moore tables for the
+    /// search direction that were computed ahead of time, if any.
+    func _range(of dataToFind: Data, tables: _BoyerMooreTables?, options: Data.SearchOptions, in range: Range<Index>?) -> Range<Index>? {
         let needleLength = dataToFind.count
         guard needleLength > 0, count > 0 else {
             return nil
@@ -72,9 +80,41 @@ extension Data {
             return _searchSingleByte(dataToFind[0], in: searchRange, backwards: searchBackwards)
         }
 
+        if needleLength <= Self._vectorSearchMaximumNeedleLength {
+            return _searchVectorized(dataToFind.span, in: searchRange, backwards: searchBackwards)
+        }
+
+        if let tables {
+            return _searchBoyerMoore(dataToFind.span, tables: tables, in: searchRange, backwards: searchBackwards)
+        }
         return _searchBoyerMoore(dataToFind.span, in: searchRange, backwards: searchBackwards)
     }
 
+    /// Needles up to this length are found with the vectorized first/last byte filter. Verifying a
+    /// candidate costs up to one comparison per needle byte, so for longer needles the skips of
+    /// Boyer-Moore win out, in particular on repetitive input.
+    static let _vectorSearchMaximumNeedleLength = 32
+
+    private func _searchVectorized(_ needle: Span<UInt8>, in searchRange: Range<Index>, backwards: Bool) -> Range<Index>? {
+        let haystack = span.extracting(_rangeRelativeToStartIndex(searchRange))
+        let haystackLength = haystack.count
+        // The caller guarantees that the haystack is longer than the needle, which has at least 2 bytes.
+        let offset = haystack.withUnsafeBufferPointer { haystack in
+            needle.withUnsafeBufferPointer { needle in
+                if backwards {
+                    _bytesearchshims_last(haystack.baseAddress!, haystack.count, needle.baseAddress!, needle.count)
+                } else {
+                    _bytesearchshims_first(haystack.baseAddress!, haystack.count, needle.baseAddress!, needle.count)
+                }
+            }
+        }
+        guard offset < haystackLength else {
+            return nil
+        }
+        let lowerBound = searchRange.lowerBound + offset
+        return lowerBound..<(lowerBound + needle.count)
+    }
+
     private func _searchSingleByte(_ byte: UInt8, in searchRange: Range<Index>, backwards: Bool) -> Range<Index>? {
         let haystack = span.extracting(_rangeRelativeToStartIndex(searchRange))
         let offset = backwards ? haystack.lastIndex(of: byte) : haystack.firstIndex(of: byte)
@@ -88,3 +128,54 @@ extension Data {
         (range.lowerBound - startIndex)..<(range.upperBound - startIndex)
     }
 }
+
+@available(FoundationPreview 6.5, *)
+extension Data {
+    /// A search for one byte pattern, prepared once and reused for many searches.
+    ///
+    /// `range(of:options:in:)` derives its search tables from the needle on every call. When the same
+    /// pattern is searched for repeatedly, for example a multipart boundary, a `Searcher` computes
+    /// them once up front.
+    ///
+    ///     let boundary = Data.Searcher(pattern: Data("\r\n--\(boundaryString)".utf8))
+    ///     while let range = body.range(of: boundary, in: position..<body.endIndex) {
+    ///         ...
+    ///     }
+    public struct Searcher: Sendable {
+        /// The bytes to search for.
+        public let pattern: Data
+
+        private let forwardTables: _BoyerMooreTables?
+        private let backwardTables: _BoyerMooreTables?
+
+        /// Creates a searcher for the given bytes.
+        ///
+        /// - parameter pattern: The bytes to search for. A searcher for an empty pattern never finds a match.
+        public init(pattern: some DataProtocol) {
+            self.pattern = Data(pattern)
+            if self.pattern.count > Data._vectorSearchMaximumNeedleLength {
+                forwardTables = _BoyerMooreTables(for: self.pattern.span, backwards: false)
+                backwardTables = _BoyerMooreTables(for: self.pattern.span, backwards: true)
+            } else {
+                // Short patterns use the vectorized search, which has nothing to precompute.
+                forwardTables = nil
+                backwardTables = nil
+            }
+        }
+
+        func tables(backwards: Bool) -> _BoyerMooreTables? {
+            backwards ? backwardTables : forwardTables
+        }
+    }
+
+    /// Find the pattern of the given searcher in the content of this `Data`.
+    ///
+    /// - parameter searcher: The searcher for the data to be searched for.
+    /// - parameter options: Options for the search. Default value is `[]`.
+    /// - parameter range: The range of this data in which to perform the search. Default value is `nil`, which means the entire content of this data.
+    /// - returns: A `Range` specifying the location of the found data, or nil if a match could not be found.
+    /// - precondition: `range` must be in the bounds of the Data.
+    public func range(of searcher: Searcher, options: Data.SearchOptions = [], in range: Range<Index>? = nil) -> Range<Index>? {
+        _range(of: searcher.pattern, tables: searcher.tables(backwards: options.contains(.backwards)), options: options, in: range)
+    }
+}
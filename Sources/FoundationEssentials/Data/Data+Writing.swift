@@ -370,7 +370,8 @@ private func createProtectedTemporaryFile(destDirfd: Int32, destinationPath: Str
 #endif // os(WASI)
 }
 
-private func write(buffer: RawSpan, toFileDescriptor fd: Int32, path: borrowing some FileSystemRepresentable & ~Copyable, parentProgress: Progress?) throws {
+/// If `synchronizeDataOnly` is `true`, only the contents and the metadata needed to read them back are flushed to storage.
+private func write(buffer: RawSpan, toFileDescriptor fd: Int32, path: borrowing some FileSystemRepresentable & ~Copyable, parentProgress: Progress?, synchronizeDataOnly: Bool = false) throws {
     let count = buffer.byteCount
     parentProgress?.becomeCurrent(withPendingUnitCount: Int64(count))
     defer {
@@ -394,6 +395,8 @@ private func write(buffer: RawSpan, toFileDescriptor fd: Int32, path: borrowing
         } else {
             0
         }
+#elseif os(Linux)
+        let res = synchronizeDataOnly ? fdatasync(fd) : fsync(fd)
 #else
         let res = fsync(fd)
 #endif
@@ -412,6 +415,94 @@ private func write(buffer: RawSpan, toFileDescriptor fd: Int32, path: borrowing
     }
 }
 
+#if os(Linux)
+/// Atomically writes `buffer` to `basename` in `destDirfd` through an unnamed temporary file (`O_TMPFILE`), which is only
+/// linked into the directory once it is complete. Unlike a named temporary file this needs no name probing, leaves nothing
+/// to clean up if the write fails, and never shows a temporary name to directory watchers when creating a new file.
+///
+/// Returns `false` without writing anything if the kernel or file system does not support unnamed temporary files or linking
+/// them, in which case the caller falls back to a named temporary file. Once the data is written, this either puts it in
+/// place or throws.
+private func writeToUnnamedTemporaryFile(destDirfd: Int32, basename basenameRep: UnsafePointer<CChar>, inPath: borrowing some FileSystemRepresentable & ~Copyable, buffer: RawSpan, mode: mode_t?, attributes: [String : Data], reportProgress: Bool) throws -> Bool {
+    // As with named temporary files, a replacement starts out writable only by us until it has the mode of the original.
+    let fd = _ioshims_open_tmpfile(destDirfd, (mode != nil) ? 0o200 : 0o666)
+    guard fd >= 0 else {
+        return false
+    }
+    defer { close(fd) }
+    // Find out whether the file can be linked before writing it, since the caller would have to write it all over again
+    guard _ioshims_access_tmpfile(fd) == 0 else {
+        return false
+    }
+
+    // Reserving the final size up front lets the file system allocate the file in one go. For small files it is not
+    // worth the extra system call.
+    if buffer.byteCount >= 1024 * 1024 {
+        _ = _ioshims_fallocate(fd, off_t(buffer.byteCount))
+    }
+
+    let parentProgress = (reportProgress && Progress.current() != nil) ? Progress(totalUnitCount: Int64(buffer.byteCount)) : nil
+
+    do {
+        // The file only becomes reachable through the link below, so its data is all that needs to be durable.
+        try write(buffer: buffer, toFileDescriptor: fd, path: inPath, parentProgress: parentProgress, synchronizeDataOnly: true)
+    } catch {
+        // Closing the descriptor discards the unnamed file, so there is nothing to clean up.
+        let savedError = errno
+        if parentProgress?.isCancelled ?? false {
+            throw CocoaError(.userCancelled)
+        } else {
+            throw CocoaError.errorWithFilePath(inPath, errno: savedError, reading: false)
+        }
+    }
+
+    if let mode {
+        fchmod(fd, mode)
+    }
+
+    writeExtendedAttributes(fd: fd, attributes: attributes)
+
+    // A new file can be linked into place directly. linkat does not replace an existing file though, so in that case
+    // (or if the file appeared in the meantime) the file is linked under a temporary name and renamed over the original.
+    if mode == nil {
+        if _ioshims_link_tmpfile(fd, destDirfd, basenameRep) == 0 {
+            return true
+        }
+        guard errno == EEXIST else {
+            throw CocoaError.errorWithFilePath(inPath, errno: errno, reading: false)
+        }
+    }
+
+    let pidString = String(ProcessInfo.processInfo.processIdentifier, radix: 16, uppercase: true)
+    for _ in 0 ..< 7 {
+        let auxName = ".dat.nosync" + pidString + "." + String(UInt32.random(in: .min ... .max), radix: 36)
+        let linkErrno: Int32? = try auxName.withFileSystemRepresentation { auxNameRep in
+            guard let auxNameRep else {
+                throw CocoaError(.fileWriteInvalidFileName)
+            }
+            guard _ioshims_link_tmpfile(fd, destDirfd, auxNameRep) == 0 else {
+                return errno
+            }
+            if renameat(destDirfd, auxNameRep, destDirfd, basenameRep) != 0 {
+                let savedErrno = errno
+                _ = unlinkat(destDirfd, auxNameRep, 0)
+                throw CocoaError.errorWithFilePath(inPath, errno: savedErrno, reading: false)
+            }
+            return nil
+        }
+        guard let linkErrno else {
+            return true
+        }
+        // Try another name if this one is taken
+        guard linkErrno == EEXIST else {
+            throw CocoaError.errorWithFilePath(inPath, errno: linkErrno, reading: false)
+        }
+    }
+    // As with named temporary files, give up rather than probe names forever
+    throw CocoaError(.fileWriteUnknown)
+}
+#endif
+
 // MARK: - Entry points
 
 #if FOUNDATION_FRAMEWORK
@@ -614,6 +705,12 @@ private func writeToFileAux(path inPath: borrowing some FileSystemRepresentable
         // If we captured an existing file's mode, open the temp at the most restrictive mode that still lets us write to it (0o200) so other users' processes can't read or modify the half-written contents; fchmod restores the real mode after rename. For a brand-new file, use 0666 (subject to umask) so open(2)'s usual semantics apply.
         let tempOpenMode: TemporaryFilePermissions = (mode != nil) ? 0o200 : 0o666
 
+#if os(Linux)
+        if try writeToUnnamedTemporaryFile(destDirfd: destDirfd, basename: basenameRep, inPath: inPath, buffer: buffer, mode: mode, attributes: attributes, reportProgress: reportProgress) {
+            return
+        }
+#endif
+
         // tempDirfd is the file descriptor of the temporary file's parent directory, which COULD be the same exact file descriptor as destDirfd.
         let (fd, auxName, tempDirfd, temporaryDirectoryPath) = try createProtectedTemporaryFile(destDirfd: destDirfd, destinationPath: newPath, inPath: inPath, options: options, permissions: tempOpenMode, variant: "Folder")
 
@@ -790,6 +887,121 @@ private func writeToFileNoAux(path inPath: borrowing some FileSystemRepresentabl
 #endif
 }
 
+#if !os(Windows) && !os(WASI) && !os(Emscripten)
+/// Calls `body` with `iovecs` extended by one entry for each of `chunks`. The entries are only valid during the call.
+private func withIOVecs(for chunks: ArraySlice<Data>, appendingTo iovecs: inout [iovec], _ body: (UnsafeMutableBufferPointer<iovec>) -> Bool) -> Bool {
+    guard let chunk = chunks.first else {
+        return iovecs.withUnsafeMutableBufferPointer { body($0) }
+    }
+    return chunk.withUnsafeBytes { buffer in
+        iovecs.append(iovec(iov_base: UnsafeMutableRawPointer(mutating: buffer.baseAddress), iov_len: buffer.count))
+        return withIOVecs(for: chunks.dropFirst(), appendingTo: &iovecs, body)
+    }
+}
+
+/// Writes `chunks` to `fd` with gathering writes. Returns `false` and sets `errno` if a write fails.
+private func writeChunksToFileDescriptor(_ fd: Int32, chunks: [Data]) -> Bool {
+    // Every chunk of a batch takes a stack frame in withIOVecs, so batches are kept well below IOV_MAX.
+    let maximumChunksPerWrite = 64
+    var iovecs: [iovec] = []
+    iovecs.reserveCapacity(min(chunks.count, maximumChunksPerWrite))
+
+    var start = chunks.startIndex
+    while start < chunks.endIndex {
+        let batch = chunks[start ..< min(start + maximumChunksPerWrite, chunks.endIndex)]
+        start = batch.endIndex
+        iovecs.removeAll(keepingCapacity: true)
+
+        let succeeded = withIOVecs(for: batch, appendingTo: &iovecs) { iovecs in
+            var first = 0
+            while first < iovecs.count {
+                let written = writev(fd, iovecs.baseAddress! + first, CInt(iovecs.count - first))
+                if written < 0 {
+                    let savedErrno = errno
+                    if savedErrno == EINTR {
+                        continue
+                    }
+                    logFileIOErrno(savedErrno, at: "writev")
+                    errno = savedErrno
+                    return false
+                } else if written == 0 {
+                    errno = EIO
+                    return false
+                }
+
+                // Skip the entries that were written completely, and trim the one that was written partially.
+                var remaining = written
+                while first < iovecs.count && remaining >= iovecs[first].iov_len {
+                    remaining -= iovecs[first].iov_len
+                    first += 1
+                }
+                if remaining > 0 {
+                    iovecs[first].iov_base = iovecs[first].iov_base! + remaining
+                    iovecs[first].iov_len -= remaining
+                }
+            }
+            return true
+        }
+        guard succeeded else {
+            return false
+        }
+    }
+    return true
+}
+#endif
+
+/// Create a new file at a path out of the concatenation of `chunks`.
+///
+/// Unless the write is atomic, the chunks are written with gathering writes instead of being joined into one buffer first.
+internal func writeToFile(path inPath: borrowing some FileSystemRepresentable & ~Copyable, chunks: [Data], options: Data.WritingOptions) throws {
+#if !os(Windows) && !os(WASI) && !os(Emscripten)
+    if !options.contains(.atomic) {
+        try inPath.withFileSystemRepresentation { pathFileSystemRep in
+            guard let pathFileSystemRep else {
+                throw CocoaError(.fileWriteInvalidFileName)
+            }
+
+            var flags: Int32 = O_WRONLY | O_CREAT | O_TRUNC
+            if options.contains(.withoutOverwriting) {
+                flags = flags | O_EXCL
+            }
+
+            let fd = openFileDescriptorProtected(path: pathFileSystemRep, flags: flags, options: options)
+            guard fd >= 0 else {
+                let savedErrno = errno
+                throw CocoaError.errorWithFilePath(inPath, errno: savedErrno, reading: false)
+            }
+            defer { close(fd) }
+
+            guard writeChunksToFileDescriptor(fd, chunks: chunks) else {
+                let savedErrno = errno
+                throw CocoaError.errorWithFilePath(inPath, errno: savedErrno, reading: false)
+            }
+
+            if fsync(fd) < 0 {
+                let savedErrno = errno
+                #if os(Linux)
+                // Linux returns -1 and errno == EINVAL if trying to sync a special file, eg a fifo, character device etc which can be ignored.
+                guard savedErrno == EINVAL else {
+                    throw CocoaError.errorWithFilePath(inPath, errno: savedErrno, reading: false)
+                }
+                #else
+                throw CocoaError.errorWithFilePath(inPath, errno: savedErrno, reading: false)
+                #endif
+            }
+        }
+        return
+    }
+#endif
+
+    // Atomic writes go through a temporary file, which is written from a single buffer.
+    var contents = Data(capacity: chunks.reduce(0) { $0 + $1.count })
+    for chunk in chunks {
+        contents.append(chunk)
+    }
+    try writeToFile(path: inPath, buffer: contents.bytes, options: options, reportProgress: true)
+}
+
 private func writeExtendedAttributes(fd: Int32, attributes: [String : Data]) {
     // Write extended attributes
     for (key, value) in attributes {
@@ -30,6 +30,10 @@ internal import _FoundationDarwinExtras
 import stdlib_h
 #endif
 
+#if os(Linux) || os(Android)
+internal import _FoundationCShims
+#endif
+
 // Underlying storage representation for medium and large data.
 // Inlinability strategy: methods from here should not inline into InlineSlice or LargeSlice unless trivial.
 // NOTE: older overlays called this class _DataStorage. The two must
@@ -72,6 +76,34 @@ internal final class __DataStorage : @unchecked Sendable {
         return realloc(ptr, newSize)
 #endif
     }
+
+#if os(Linux) || os(Android)
+    // Allocations of at least this size are anonymous mappings of their own rather than malloc blocks. Growing a mapping
+    // moves its pages with mremap(2) instead of copying the bytes, and the pages it gains are already zero-filled, so
+    // growing a buffer of hundreds of megabytes neither copies it nor needs twice its memory in the meantime.
+    static let mappingThreshold = 32 * 1024 * 1024
+
+    static func allocateMapping(_ size: Int) -> UnsafeMutableRawPointer? {
+        let bytes = mmap(nil, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+        guard let bytes, bytes != MAP_FAILED else {
+            return nil
+        }
+        return bytes
+    }
+#endif
+
+    /// Allocates the bytes of a new storage of at least `size` bytes, returning the capacity actually allocated.
+    static func allocateStorage(_ size: Int, _ clear: Bool) -> (bytes: UnsafeMutableRawPointer?, capacity: Int, isMapping: Bool) {
+#if os(Linux) || os(Android)
+        if __DataStorage.mappingThreshold <= size {
+            let capacity = Platform.roundUpToMultipleOfPageSize(size)
+            if let bytes = allocateMapping(capacity) {
+                return (bytes, capacity, true)
+            }
+        }
+#endif
+        return (allocate(size, clear), size, false)
+    }
     
     @usableFromInline // This is not @inlinable as it is a non-trivial, non-generic function.
     static func move(_ dest_: UnsafeMutableRawPointer, _ source_: UnsafeRawPointer?, _ num_: Int) {
@@ -165,6 +197,12 @@ internal final class __DataStorage : @unchecked Sendable {
     #endif
     @usableFromInline var _needToZero: Bool
 
+    /// Whether the byte allocation is an anonymous mapping rather than a malloc block. Only used on Linux.
+    #if !DEBUG
+    @exclusivity(unchecked)
+    #endif
+    var _isMapping: Bool = false
+
     /// A pointer to the referenced byte allocation, relative to the slice offsets
     ///
     /// This is a pointer to the start of the symbolic allocation range that begins at index 0. This
@@ -324,6 +362,17 @@ internal final class __DataStorage : @unchecked Sendable {
                 additionalCapacity = 0
             }
             var newCapacity = malloc_good_size(Swift.max(cap, newLength + additionalCapacity))
+#if os(Linux) || os(Android)
+            if _deallocator == nil && (_isMapping || __DataStorage.mappingThreshold <= newCapacity) {
+                if growMapping(to: Platform.roundUpToMultipleOfPageSize(newCapacity), clear: clear) {
+                    return
+                }
+                // A mapping cannot be handed to realloc or free, so there is nothing to fall back to
+                if _isMapping {
+                    fatalError("unable to allocate memory for length (\(newLength))")
+                }
+            }
+#endif
             let origLength = _length
             var allocateCleared = clear && __DataStorage.shouldAllocateCleared(newCapacity)
             var newBytes: UnsafeMutableRawPointer? = nil
@@ -393,15 +442,53 @@ internal final class __DataStorage : @unchecked Sendable {
         }
     }
     
+#if os(Linux) || os(Android)
+    /// Moves the bytes into a mapping of `newCapacity` bytes, a multiple of the page size. If they already are in a
+    /// mapping, it is resized in place or its pages are moved; otherwise the bytes are copied into a new mapping once.
+    /// Returns `false` without changing anything if the mapping cannot be created.
+    private func growMapping(to newCapacity: Int, clear: Bool) -> Bool {
+        let origLength = _length
+        if _isMapping, let bytes = _bytes {
+            guard let newBytes = _ioshims_mremap(bytes, _capacity, newCapacity) else {
+                return false
+            }
+            // The pages added by mremap are zero-filled, but the old capacity beyond the length may not be
+            if clear && _needToZero {
+                _ = memset(newBytes.advanced(by: origLength), 0, _capacity - origLength)
+            }
+            _bytes = newBytes
+        } else {
+            guard let newBytes = __DataStorage.allocateMapping(newCapacity) else {
+                return false
+            }
+            if let bytes = _bytes {
+                __DataStorage.move(newBytes, bytes, origLength)
+                free(bytes)
+            }
+            _bytes = newBytes
+            _isMapping = true
+            _needToZero = false
+        }
+        /* _length set by caller */
+        _capacity = newCapacity
+        return true
+    }
+#endif
+
     func _freeBytes() {
         if let bytes = _bytes {
             if let dealloc = _deallocator {
                 dealloc(bytes, length)
+            } else if _isMapping {
+#if os(Linux) || os(Android)
+                _ = munmap(bytes, _capacity)
+#endif
             } else {
                 free(bytes)
             }
         }
         _deallocator = nil
+        _isMapping = false
     }
     
     @inlinable // This is @inlinable despite escaping the _DataStorage boundary layer because it is trivially computed.
@@ -608,9 +695,11 @@ internal final class __DataStorage : @unchecked Sendable {
         }
         
         let clear = __DataStorage.shouldAllocateCleared(length)
-        _bytes = __DataStorage.allocate(capacity, clear)!
-        _capacity = capacity
-        _needToZero = !clear
+        let allocation = __DataStorage.allocateStorage(capacity, clear)
+        _bytes = allocation.bytes!
+        _capacity = allocation.capacity
+        _isMapping = allocation.isMapping
+        _needToZero = !(clear || allocation.isMapping)
         _length = 0
         _offset = 0
         setLength(length)
@@ -624,9 +713,11 @@ internal final class __DataStorage : @unchecked Sendable {
             capacity = Platform.roundUpToMultipleOfPageSize(capacity)
         }
         _length = 0
-        _bytes = __DataStorage.allocate(capacity, false)!
-        _capacity = capacity
-        _needToZero = true
+        let allocation = __DataStorage.allocateStorage(capacity, false)
+        _bytes = allocation.bytes!
+        _capacity = allocation.capacity
+        _isMapping = allocation.isMapping
+        _needToZero = !allocation.isMapping
         _offset = 0
     }
     
@@ -640,10 +731,12 @@ internal final class __DataStorage : @unchecked Sendable {
             _needToZero = false
             _bytes = nil
         } else if __DataStorage.vmOpsThreshold <= length {
-            _capacity = length
+            let allocation = __DataStorage.allocateStorage(length, false)
+            _capacity = allocation.capacity
             _length = length
-            _needToZero = true
-            _bytes = __DataStorage.allocate(length, false)!
+            _needToZero = !allocation.isMapping
+            _bytes = allocation.bytes!
+            _isMapping = allocation.isMapping
             __DataStorage.move(_bytes!, bytes, length)
         } else {
             var capacity = length
@@ -678,10 +771,12 @@ internal final class __DataStorage : @unchecked Sendable {
             _bytes = bytes
             _deallocator = deallocator
         } else if __DataStorage.vmOpsThreshold <= length {
-            _capacity = length
+            let allocation = __DataStorage.allocateStorage(length, false)
+            _capacity = allocation.capacity
             _length = length
-            _needToZero = true
-            _bytes = __DataStorage.allocate(length, false)!
+            _needToZero = !allocation.isMapping
+            _bytes = allocation.bytes!
+            _isMapping = allocation.isMapping
             __DataStorage.move(_bytes!, bytes, length)
             if let dealloc = deallocator {
                 dealloc(bytes!, length)
@@ -215,29 +215,15 @@ extension _FileManagerImpl {
                 throw CocoaError.errorWithFilePath(.fileNoSuchFile, path)
             }
             
-            let subpaths = _FTSSequence(fileSystemRep, FTS_PHYSICAL | FTS_NOCHDIR | FTS_NOSTAT).subpaths
-            var realFirstPath: String?
+            let subpaths = _FTSSequence(fileSystemRep, FTS_PHYSICAL | FTS_NOCHDIR | FTS_NOSTAT).subpaths(relativeTo: fileSystemRep)
             
             var results: [String] = []
             for item in subpaths {
-                var subpath: String
                 switch item {
                 case .error(let errNum, let p):
                     throw CocoaError.errorWithFilePath(p, errno: errNum, reading: true)
-                case .entry(let path):
-                    subpath = path
-                }
-                
-                guard let realFirstPath else {
-                    realFirstPath = subpath
-                    continue
-                }
-                
-                let trueSubpath = subpath.trimmingPrefix(realFirstPath)
-                if trueSubpath.first == "/" {
-                    results.append(String(trueSubpath.dropFirst()))
-                } else if !trueSubpath.isEmpty {
-                    results.append(String(trueSubpath))
+                case .entry(let subpath):
+                    results.append(subpath)
                 }
             }
             return results
@@ -308,8 +308,15 @@ enum SubpathElement {
 }
 
 extension Sequence<_FTSSequence.Element> {
-    var subpaths: some Sequence<SubpathElement> {
-        self.lazy.compactMap {
+    /// The paths of the entries relative to `root`, the path the sequence was opened with, not including `root` itself.
+    func subpaths(relativeTo root: UnsafePointer<CChar>) -> some Sequence<SubpathElement> {
+        // As in _linkOrCopyFile, don't count the trailing separators of the root, which fts implementations treat differently, and skip the separators that follow the root below.
+        let pathSeparator = CChar(UInt8(ascii: "/"))
+        var rootLength = strlen(root)
+        while rootLength > 0, root[rootLength - 1] == pathSeparator {
+            rootLength -= 1
+        }
+        return self.lazy.compactMap {
             switch $0 {
             case .error(let error, let path): return .error(error, path)
             case .entry(let ent):
@@ -321,7 +328,16 @@ extension Sequence<_FTSSequence.Element> {
                 case FTS_NSOK: fallthrough      // No stat(2) information was requested, but that's OK.
                 case FTS_SL: fallthrough        // Symlink.
                 case FTS_SLNONE:                // Symlink with no target.
-                    return .entry(String(cString: ent.ftsEnt.fts_path!))
+                    // Create the string from the relative part of the path only, rather than from the full path and then trimming it
+                    var relativePath = ent.ftsEnt.fts_path!.advanced(by: rootLength)
+                    while relativePath.pointee == pathSeparator {
+                        relativePath += 1
+                    }
+                    guard relativePath.pointee != 0 else {
+                        // The root itself
+                        return nil
+                    }
+                    return .entry(String(cString: relativePath))
                     
                 // Error returns
                 case FTS_DNR: fallthrough   // Directory cannot be read.
@@ -400,8 +416,15 @@ struct _POSIXDirectoryContentsSequence: Sequence {
                         // We need to do an additional stat on this to see if it's really a directory or not.
                         // This path should be uncommon.
                         var statBuf: stat = stat()
-                        let statDir = directoryPath + "/" + fileName
-                        if stat(statDir, &statBuf) == 0 {
+                        directoryPath.truncate(to: directoryPathLength)
+                        #if os(WASI)
+                        directoryPath.appendComponent(_platform_shims_dirent_d_name(dent))
+                        #else
+                        withUnsafeBytes(of: &dent.pointee.d_name) { buf in
+                            directoryPath.appendComponent(buf.baseAddress!.assumingMemoryBound(to: CChar.self))
+                        }
+                        #endif
+                        if directoryPath.withFileSystemRepresentation({ stat($0!, &statBuf) }) == 0 {
                             // #define S_ISDIR(m)      (((m) & S_IFMT) == S_IFDIR)
                             if (mode_t(statBuf.st_mode) & S_IFMT) == S_IFDIR {
                                 isDirectory = true
@@ -429,19 +452,18 @@ struct _POSIXDirectoryContentsSequence: Sequence {
         }
 
         private var dirp: DirectoryEntryPtr?
-        private let directoryPath: String
+        // The directory's path, followed by the name of the entry being examined, if any
+        private var directoryPath: _PathBuilder
+        private let directoryPathLength: Int
         private let prefix: String
         private let appendSlash: Bool
         
         var error: CocoaError?
 
         init(path: String, appendSlashForDirectory: Bool = false, prefix: [String] = []) {
-            let dirp = path.withFileSystemRepresentation { ptr -> DirectoryEntryPtr? in
-                guard let ptr else { return nil }
-                return opendir(ptr)
-            }
-            if let dirp {
-                directoryPath = path
+            if let directoryPath = _PathBuilder(fileSystemRepresentationOf: path), let dirp = directoryPath.withFileSystemRepresentation({ opendir($0!) }) {
+                directoryPathLength = directoryPath.count
+                self.directoryPath = directoryPath
                 self.dirp = dirp
                 self.appendSlash = appendSlashForDirectory
 
@@ -462,7 +484,8 @@ struct _POSIXDirectoryContentsSequence: Sequence {
                 self.prefix = prefixes.joined()
             } else {
                 // It would be nice to propagate an error from here, but for now the best we can do is return nil from `next`.
-                directoryPath = ""
+                directoryPath = _PathBuilder()
+                directoryPathLength = 0
                 self.prefix = ""
                 appendSlash = false
                 error = CocoaError.errorWithFilePath(path, errno: errno, reading: true, variant: "Folder")
@@ -1116,16 +1116,16 @@ enum _FileOperations {
         // Emscripten doesn't have fts.h; recursive copy/link is not yet supported.
         throw CocoaError.errorWithFilePath(.featureUnsupported, String(cString: srcPtr))
         #else
-        try withUnsafeTemporaryAllocation(of: CChar.self, capacity: FileManager.MAX_PATH_SIZE) { buffer in
-            let dstLen = Platform.copyCString(dst: buffer.baseAddress!, src: dstPtr, size: FileManager.MAX_PATH_SIZE)
+        do {
+            // The destination path of each item is built in place, after the destination path itself
+            var dst = _PathBuilder(fileSystemRepresentation: dstPtr)
+            let dstLen = dst.count
             // fts builds the path of a descendant by appending a separator and its name to the source path, but implementations disagree about how the trailing separators of the source path are treated: some drop one of them beforehand and some keep all of them. Ignore them entirely when determining the length of the prefix that the destination path replaces, and re-insert a single separator below.
             let pathSeparator = CChar(UInt8(ascii: "/"))
             var srcLen = strlen(srcPtr)
             while srcLen > 0, srcPtr[srcLen - 1] == pathSeparator {
                 srcLen -= 1
             }
-            let dstAppendPtr = buffer.baseAddress!.advanced(by: dstLen)
-            let remainingBuffer = FileManager.MAX_PATH_SIZE - dstLen
             
             let seq = _FTSSequence(srcPtr, .init(FTS_PHYSICAL | FTS_NOCHDIR))
             let iterator = seq.makeIterator()
@@ -1141,91 +1141,92 @@ enum _FileOperations {
                     while trimmedPathPtr.pointee == pathSeparator {
                         trimmedPathPtr += 1
                     }
-                    if trimmedPathPtr.pointee == 0 {
-                        // The source itself is copied to the destination path as-is
-                        dstAppendPtr.pointee = 0
-                    } else {
-                        dstAppendPtr.pointee = pathSeparator
-                        Platform.copyCString(dst: dstAppendPtr + 1, src: trimmedPathPtr, size: remainingBuffer - 1)
+                    // The source itself is copied to the destination path as-is
+                    dst.truncate(to: dstLen)
+                    if trimmedPathPtr.pointee != 0 {
+                        dst.appendComponent(trimmedPathPtr)
                     }
                     
-                    // we don't want to ask the delegate on the way back -up- the hierarchy if they want to copy a directory they've already seen and therefore already said "YES" to.
-                    guard entry.ftsEnt.fts_info == FTS_DP || delegate.shouldPerformOnItemAtPath(String(cString: fts_path), to: String(cString: buffer.baseAddress!)) else {
-                        if entry.ftsEnt.fts_info == FTS_D {
-                            iterator.skipDescendants(of: entry, skipPostProcessing: true)
+                    try dst.withFileSystemRepresentation { dstItemRep in
+                        let dstItemPtr = dstItemRep!
+                        // we don't want to ask the delegate on the way back -up- the hierarchy if they want to copy a directory they've already seen and therefore already said "YES" to.
+                        guard entry.ftsEnt.fts_info == FTS_DP || delegate.shouldPerformOnItemAtPath(String(cString: fts_path), to: String(cString: dstItemPtr)) else {
+                            if entry.ftsEnt.fts_info == FTS_D {
+                                iterator.skipDescendants(of: entry, skipPostProcessing: true)
+                            }
+                            return
                         }
-                        continue
-                    }
                     
-                    let extraFlags = entry.ftsEnt.fts_level == 0 ? delegate.extraCopyFileFlags : 0
+                        let extraFlags = entry.ftsEnt.fts_level == 0 ? delegate.extraCopyFileFlags : 0
                     
-                    switch Int32(entry.ftsEnt.fts_info) {
-                    case FTS_D:
-                        // Directory being visited in pre-order - create it with whatever default perms will be on the destination.
-                        #if canImport(Darwin)
-                        if copyfile(fts_path, buffer.baseAddress!, nil, copyfile_flags_t(COPYFILE_DATA | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags)) != 0 {
-                            try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
-                        }
-                        #else
-                        do {
-                            try fileManager.createDirectory(atPath: String(cString: buffer.baseAddress!), withIntermediateDirectories: true)
-                        } catch {
-                            try delegate.throwIfNecessary(error, String(cString: fts_path), String(cString: buffer.baseAddress!))
-                        }
-                        #endif
-                        
-                    case FTS_DP:
-                        // Directory being visited in post-order - copy the permissions over.
-                        try Self._safeCopyDirectoryMetadata(src: fts_path, dst: buffer.baseAddress!, delegate: delegate, extraFlags: extraFlags)
-                        
-                    case FTS_SL: fallthrough    // Symlink.
-                    case FTS_SLNONE:            // Symlink with no target.
-                        // Do what the documentation says (and what linkPath:toPath:handler: does) - copy the symlink, instead of creating a hard link.
-                        #if canImport(Darwin)
-                        var flags: Int32
-                        if delegate.copyData {
-                            flags = COPYFILE_CLONE | COPYFILE_ALL | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags
-                        } else {
-                            flags = COPYFILE_DATA | COPYFILE_METADATA | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags
-                        }
-                        if copyfile(fts_path, buffer.baseAddress!, nil, copyfile_flags_t(flags)) != 0 {
-                            try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
-                        }
-                        #else
-                        try withUnsafeTemporaryAllocation(of: CChar.self, capacity: FileManager.MAX_PATH_SIZE) { tempBuff in
-                            tempBuff.initialize(repeating: 0)
-                            defer { tempBuff.deinitialize() }
-                            let len = readlink(fts_path, tempBuff.baseAddress!, FileManager.MAX_PATH_SIZE - 1)
-                            if len >= 0, symlink(tempBuff.baseAddress!, buffer.baseAddress!) != -1 {
-                                return
+                        switch Int32(entry.ftsEnt.fts_info) {
+                        case FTS_D:
+                            // Directory being visited in pre-order - create it with whatever default perms will be on the destination.
+                            #if canImport(Darwin)
+                            if copyfile(fts_path, dstItemPtr, nil, copyfile_flags_t(COPYFILE_DATA | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags)) != 0 {
+                                try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: dstItemPtr))
                             }
-                            try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
-                        }
-                        #endif
+                            #else
+                            do {
+                                try fileManager.createDirectory(atPath: String(cString: dstItemPtr), withIntermediateDirectories: true)
+                            } catch {
+                                try delegate.throwIfNecessary(error, String(cString: fts_path), String(cString: dstItemPtr))
+                            }
+                            #endif
+                        
+                        case FTS_DP:
+                            // Directory being visited in post-order - copy the permissions over.
+                            try Self._safeCopyDirectoryMetadata(src: fts_path, dst: dstItemPtr, delegate: delegate, extraFlags: extraFlags)
                         
-                    case FTS_DEFAULT: fallthrough   // Something not defined anywhere else.
-                    case FTS_F:                     // Regular file.
-                        if delegate.copyData {
+                        case FTS_SL: fallthrough    // Symlink.
+                        case FTS_SLNONE:            // Symlink with no target.
+                            // Do what the documentation says (and what linkPath:toPath:handler: does) - copy the symlink, instead of creating a hard link.
                             #if canImport(Darwin)
-                            if copyfile(fts_path, buffer.baseAddress!, nil, copyfile_flags_t(COPYFILE_CLONE | COPYFILE_ALL | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags)) != 0 {
-                                try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
+                            var flags: Int32
+                            if delegate.copyData {
+                                flags = COPYFILE_CLONE | COPYFILE_ALL | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags
+                            } else {
+                                flags = COPYFILE_DATA | COPYFILE_METADATA | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags
+                            }
+                            if copyfile(fts_path, dstItemPtr, nil, copyfile_flags_t(flags)) != 0 {
+                                try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: dstItemPtr))
                             }
                             #else
-                            try Self._copyRegularFile(fts_path, buffer.baseAddress!, delegate: delegate)
+                            try withUnsafeTemporaryAllocation(of: CChar.self, capacity: FileManager.MAX_PATH_SIZE) { tempBuff in
+                                tempBuff.initialize(repeating: 0)
+                                defer { tempBuff.deinitialize() }
+                                let len = readlink(fts_path, tempBuff.baseAddress!, FileManager.MAX_PATH_SIZE - 1)
+                                if len >= 0, symlink(tempBuff.baseAddress!, dstItemPtr) != -1 {
+                                    return
+                                }
+                                try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: dstItemPtr))
+                            }
                             #endif
-                        } else {
-                            if link(fts_path, buffer.baseAddress!) != 0 {
-                                try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
+                        
+                        case FTS_DEFAULT: fallthrough   // Something not defined anywhere else.
+                        case FTS_F:                     // Regular file.
+                            if delegate.copyData {
+                                #if canImport(Darwin)
+                                if copyfile(fts_path, dstItemPtr, nil, copyfile_flags_t(COPYFILE_CLONE | COPYFILE_ALL | COPYFILE_EXCL | COPYFILE_NOFOLLOW | extraFlags)) != 0 {
+                                    try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: dstItemPtr))
+                                }
+                                #else
+                                try Self._copyRegularFile(fts_path, dstItemPtr, delegate: delegate)
+                                #endif
+                            } else {
+                                if link(fts_path, dstItemPtr) != 0 {
+                                    try delegate.throwIfNecessary(errno, String(cString: fts_path), String(cString: dstItemPtr))
+                                }
                             }
-                        }
                         
-                        // Error returns
-                    case FTS_DNR: fallthrough   // Directory cannot be read.
-                    case FTS_ERR: fallthrough   // Some error occurred, but we don't know what.
-                    case FTS_NS:                // No stat(2) information is available.
-                        try delegate.throwIfNecessary(entry.ftsEnt.fts_errno, String(cString: fts_path), String(cString: buffer.baseAddress!))
+                            // Error returns
+                        case FTS_DNR: fallthrough   // Directory cannot be read.
+                        case FTS_ERR: fallthrough   // Some error occurred, but we don't know what.
+                        case FTS_NS:                // No stat(2) information is available.
+                            try delegate.throwIfNecessary(entry.ftsEnt.fts_errno, String(cString: fts_path), String(cString: dstItemPtr))
                         
-                    default: break
+                        default: break
+                        }
                     }
                 }
             }
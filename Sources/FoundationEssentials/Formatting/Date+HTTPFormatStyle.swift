@@ -10,6 +10,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+internal import Synchronization
+
 @available(FoundationPreview 6.2, *)
 public extension FormatStyle where Self == Date.HTTPFormatStyle {
     static var http: Self {
@@ -47,6 +49,12 @@ extension Date {
         public init(from decoder: any Decoder) throws {}
         
         public func format(_ date: Date) -> String {
+            if let second = _HTTPDate.second(of: date) {
+                return String(unsafeUninitializedCapacity: _HTTPDate.length) { buffer in
+                    _HTTPDateCache.cache.format(second, into: buffer)
+                    return _HTTPDate.length
+                }
+            }
             // <day-name>, <day> <month> <year> <hour>:<minute>:<second> GMT
             let components = Calendar(identifier: .gregorian)._dateComponents([.weekday, .day, .month, .year, .hour, .minute, .second], from: date, in: .gmt)
             return componentsStyle.format(components)
@@ -66,6 +74,10 @@ extension Date {
             }
             
             let result = v.withUTF8 { buffer -> (Int, Date)? in
+                if let date = _HTTPDate.parse(buffer) {
+                    return (_HTTPDate.length, date)
+                }
+
                 let view = BufferView(unsafeBufferPointer: buffer)!
 
                 guard let comps = try? componentsStyle.components(from: value, in: view) else {
@@ -452,3 +464,210 @@ extension DateComponents {
     }
 }
 
+
+// MARK: - Fixed-length dates
+
+@available(FoundationPreview 6.5, *)
+extension Date.HTTPFormatStyle {
+    /// The number of bytes in an HTTP date for a date between the years 1900 and 9999, such as "Sun, 06 Nov 1994 08:49:37 GMT".
+    public static var fixedLength: Int { _HTTPDate.length }
+
+    /// Formats `date` into the beginning of `buffer` without allocating, for example to write a `Date` header for every response of a server.
+    ///
+    /// The most recently formatted second is cached, so formatting the current time again during the same second copies the cached bytes.
+    ///
+    /// - Parameter date: The date to format. Dates before 1900 or after 9999 are formatted through `format(_:)`, and may need more than `fixedLength` bytes.
+    /// - Parameter buffer: The buffer to write the UTF-8 bytes of the HTTP date into.
+    /// - Returns: The number of bytes written, or `nil` if `buffer` is too small, in which case its contents are unspecified.
+    public func format(_ date: Date, into buffer: UnsafeMutableBufferPointer<UInt8>) -> Int? {
+        guard let second = _HTTPDate.second(of: date) else {
+            var string = format(date)
+            return string.withUTF8 { utf8 in
+                guard utf8.count <= buffer.count else { return nil }
+                _ = buffer.initialize(fromContentsOf: utf8)
+                return utf8.count
+            }
+        }
+        guard buffer.count >= _HTTPDate.length else {
+            return nil
+        }
+        _HTTPDateCache.cache.format(second, into: buffer)
+        return _HTTPDate.length
+    }
+}
+
+/// Formats and parses HTTP dates between the years 1900 and 9999 with integer arithmetic, which is much faster than going through `Calendar`. In that range, the Gregorian calendar's Julian cutover does not apply, and every HTTP date has the same length.
+enum _HTTPDate {
+    static let length = 29
+
+    // 1900-01-01T00:00:00Z and 10000-01-01T00:00:00Z
+    private static let supportedSeconds: Range<Int64> = -2208988800 ..< 253402300800
+
+    private static let dayNames = Array("SunMonTueWedThuFriSat".utf8)
+    private static let monthNames = Array("JanFebMarAprMayJunJulAugSepOctNovDec".utf8)
+
+    /// The whole second containing `date`, since 1970, or `nil` if `date` is outside of the supported range.
+    static func second(of date: Date) -> Int64? {
+        let seconds = date.timeIntervalSince1970.rounded(.down)
+        guard seconds >= Double(supportedSeconds.lowerBound), seconds < Double(supportedSeconds.upperBound) else {
+            return nil
+        }
+        return Int64(seconds)
+    }
+
+    /// Writes the HTTP date of `second` into the first `length` bytes of `buffer`.
+    static func write(_ second: Int64, into buffer: UnsafeMutableBufferPointer<UInt8>) {
+        precondition(supportedSeconds.contains(second) && buffer.count >= length)
+        let days = (second >= 0 ? second : second - 86399) / 86400
+        let secondInDay = Int(second - days * 86400)
+        let (year, month, day) = _CalendarUtility.civilDate(daysSince1970: days)
+        // 1970-01-01 was a Thursday
+        let weekday = Int(((days + 4) % 7 + 7) % 7)
+
+        func writeName(_ names: [UInt8], _ index: Int, at offset: Int) {
+            buffer[offset] = names[index * 3]
+            buffer[offset + 1] = names[index * 3 + 1]
+            buffer[offset + 2] = names[index * 3 + 2]
+        }
+        func writeDigits(_ value: Int, count: Int, at offset: Int) {
+            var value = value
+            for i in (0 ..< count).reversed() {
+                buffer[offset + i] = UInt8(ascii: "0") + UInt8(value % 10)
+                value /= 10
+            }
+        }
+
+        // <day-name>, <day> <month> <year> <hour>:<minute>:<second> GMT
+        writeName(dayNames, weekday, at: 0)
+        buffer[3] = UInt8(ascii: ",")
+        buffer[4] = UInt8(ascii: " ")
+        writeDigits(Int(day), count: 2, at: 5)
+        buffer[7] = UInt8(ascii: " ")
+        writeName(monthNames, Int(month) - 1, at: 8)
+        buffer[11] = UInt8(ascii: " ")
+        writeDigits(Int(year), count: 4, at: 12)
+        buffer[16] = UInt8(ascii: " ")
+        writeDigits(secondInDay / 3600, count: 2, at: 17)
+        buffer[19] = UInt8(ascii: ":")
+        writeDigits(secondInDay / 60 % 60, count: 2, at: 20)
+        buffer[22] = UInt8(ascii: ":")
+        writeDigits(secondInDay % 60, count: 2, at: 23)
+        buffer[25] = UInt8(ascii: " ")
+        buffer[26] = UInt8(ascii: "G")
+        buffer[27] = UInt8(ascii: "M")
+        buffer[28] = UInt8(ascii: "T")
+    }
+
+    /// Parses an HTTP date with a day name at the start of `buffer`, such as "Sun, 06 Nov 1994 08:49:37 GMT". Returns `nil` for anything else, including the forms that `DateComponents.HTTPFormatStyle` also accepts, so they can be parsed there instead.
+    static func parse(_ buffer: UnsafeBufferPointer<UInt8>) -> Date? {
+        guard buffer.count >= length,
+              buffer[3] == UInt8(ascii: ","), buffer[4] == UInt8(ascii: " "), buffer[7] == UInt8(ascii: " "),
+              buffer[11] == UInt8(ascii: " "), buffer[16] == UInt8(ascii: " "),
+              buffer[19] == UInt8(ascii: ":"), buffer[22] == UInt8(ascii: ":"), buffer[25] == UInt8(ascii: " "),
+              buffer[26] == UInt8(ascii: "G"), buffer[27] == UInt8(ascii: "M"), buffer[28] == UInt8(ascii: "T") else {
+            return nil
+        }
+
+        func nameIndex(_ names: [UInt8], at offset: Int) -> Int? {
+            for index in 0 ..< names.count / 3 where names[index * 3] == buffer[offset] && names[index * 3 + 1] == buffer[offset + 1] && names[index * 3 + 2] == buffer[offset + 2] {
+                return index
+            }
+            return nil
+        }
+        func digits(count: Int, at offset: Int) -> Int64? {
+            var value: Int64 = 0
+            for i in offset ..< offset + count {
+                let digit = buffer[i] &- UInt8(ascii: "0")
+                guard digit < 10 else { return nil }
+                value = value * 10 + Int64(digit)
+            }
+            return value
+        }
+
+        // As in `DateComponents.HTTPFormatStyle`, the day name must be valid but does not have to match the date, and a day past the end of the month rolls over into the next one
+        guard nameIndex(dayNames, at: 0) != nil,
+              let day = digits(count: 2, at: 5), (1 ... 31).contains(day),
+              let month = nameIndex(monthNames, at: 8),
+              let year = digits(count: 4, at: 12), year >= 1900,
+              let hour = digits(count: 2, at: 17), hour < 24,
+              let minute = digits(count: 2, at: 20), minute < 60,
+              var second = digits(count: 2, at: 23), second <= 60 else {
+            return nil
+        }
+        // Foundation does not support leap seconds
+        if second == 60 {
+            second = 59
+        }
+        let days = _CalendarUtility.daysSince1970(year: year, month: Int64(month) + 1, day: day)
+        return Date(timeIntervalSince1970: Double(days * 86400 + hour * 3600 + minute * 60 + second))
+    }
+}
+
+/// The HTTP date of the most recently formatted second, shared by the whole process.
+///
+/// The cache is a sequence lock over atomic words: `_sequence` is odd while a writer updates the other fields, and a reader that sees it change discards what it read. Readers never wait, and a writer that finds another one in progress skips updating the cache.
+struct _HTTPDateCache: Sendable, ~Copyable {
+    static let cache = _HTTPDateCache()
+
+    private let _sequence = Atomic<UInt64>(0)
+    private let _second = Atomic<Int64>(.min)
+    // The `_HTTPDate.length` bytes of the HTTP date, eight to a word
+    private let _word0 = Atomic<UInt64>(0)
+    private let _word1 = Atomic<UInt64>(0)
+    private let _word2 = Atomic<UInt64>(0)
+    private let _word3 = Atomic<UInt64>(0)
+
+    /// Writes the HTTP date of `second` into the first `_HTTPDate.length` bytes of `buffer`.
+    func format(_ second: Int64, into buffer: UnsafeMutableBufferPointer<UInt8>) {
+        if _load(second, into: buffer) {
+            return
+        }
+        _HTTPDate.write(second, into: buffer)
+        _store(second, from: UnsafeBufferPointer(buffer))
+    }
+
+    private func _load(_ second: Int64, into buffer: UnsafeMutableBufferPointer<UInt8>) -> Bool {
+        let sequence = _sequence.load(ordering: .acquiring)
+        guard sequence & 1 == 0, _second.load(ordering: .relaxed) == second else {
+            return false
+        }
+        let words = (_word0.load(ordering: .relaxed), _word1.load(ordering: .relaxed), _word2.load(ordering: .relaxed), _word3.load(ordering: .relaxed))
+        atomicMemoryFence(ordering: .acquiring)
+        guard _sequence.load(ordering: .relaxed) == sequence else {
+            return false
+        }
+        Self.unpack(words.0, into: buffer, at: 0)
+        Self.unpack(words.1, into: buffer, at: 8)
+        Self.unpack(words.2, into: buffer, at: 16)
+        Self.unpack(words.3, into: buffer, at: 24)
+        return true
+    }
+
+    private func _store(_ second: Int64, from buffer: UnsafeBufferPointer<UInt8>) {
+        let sequence = _sequence.load(ordering: .relaxed)
+        guard sequence & 1 == 0, _sequence.compareExchange(expected: sequence, desired: sequence + 1, ordering: .relaxed).exchanged else {
+            return
+        }
+        atomicMemoryFence(ordering: .releasing)
+        _second.store(second, ordering: .relaxed)
+        _word0.store(Self.pack(buffer, at: 0), ordering: .relaxed)
+        _word1.store(Self.pack(buffer, at: 8), ordering: .relaxed)
+        _word2.store(Self.pack(buffer, at: 16), ordering: .relaxed)
+        _word3.store(Self.pack(buffer, at: 24), ordering: .relaxed)
+        _sequence.store(sequence + 2, ordering: .releasing)
+    }
+
+    private static func pack(_ buffer: UnsafeBufferPointer<UInt8>, at offset: Int) -> UInt64 {
+        var word: UInt64 = 0
+        for i in 0 ..< Swift.min(8, _HTTPDate.length - offset) {
+            word |= UInt64(buffer[offset + i]) << (8 * i)
+        }
+        return word
+    }
+
+    private static func unpack(_ word: UInt64, into buffer: UnsafeMutableBufferPointer<UInt8>, at offset: Int) {
+        for i in 0 ..< Swift.min(8, _HTTPDate.length - offset) {
+            buffer[offset + i] = UInt8(truncatingIfNeeded: word >> (8 * i))
+        }
+    }
+}
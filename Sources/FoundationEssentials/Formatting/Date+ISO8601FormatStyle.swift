@@ -323,6 +323,10 @@ extension Date.ISO8601FormatStyle : FormatStyle {
     /// - Parameter value: The date to format.
     /// - Returns: A string ISO 8601 representation of the date.
     public func format(_ value: Date) -> String {
+        if _hasFixedLayout, timeZone.fixedOffsetFromGMT == 0, let string = _ISO8601FixedLayout.string(from: value, includingFractionalSeconds: includingFractionalSeconds) {
+            return string
+        }
+
         var whichComponents = Calendar.ComponentSet()
         let fields = componentsFormatStyle.formatFields
 
@@ -379,6 +383,11 @@ extension Date.ISO8601FormatStyle : FormatStyle {
     func format(_ components: DateComponents, appendingTimeZoneOffset timeZoneOffset: Int?) -> String {
         componentsFormatStyle.format(components, appendingTimeZoneOffset: timeZoneOffset)
     }
+
+    /// Whether this style writes and reads the `yyyy-MM-ddTHH:mm:ss(.SSS)Z` layout handled by `_ISO8601FixedLayout`. Formatting also requires the time zone to be GMT.
+    fileprivate var _hasFixedLayout: Bool {
+        componentsFormatStyle.formatFields == [.year, .month, .day, .time, .timeZone] && dateSeparator == .dash && dateTimeSeparator == .standard && timeSeparator == .colon
+    }
 }
 
 // MARK: `FormatStyle` protocol membership
@@ -448,6 +457,16 @@ extension Date.ISO8601FormatStyle : ParseStrategy {
             return nil
         }
         
+        if _hasFixedLayout {
+            var v = v
+            let result = v.withUTF8 { buffer in
+                _ISO8601FixedLayout.parse(buffer.span)
+            }
+            if let result {
+                return (value.utf8.index(v.startIndex, offsetBy: result.consumed), result.date)
+            }
+        }
+
         // Date parsing needs missing units filled out, so that we can calculate a date. Instead of filling them here, we do it inside the parse because it calculates which ones are truly needed.
         guard let (idx, comps) = componentsFormatStyle.parse(value, fillMissingUnits: true, in: range) else {
             return nil
@@ -469,6 +488,89 @@ extension Date.ISO8601FormatStyle: ParseableFormatStyle {
     }
 }
 
+// MARK: - Bytes and batches
+
+@available(FoundationPreview 6.5, *)
+extension Date.ISO8601FormatStyle {
+    /// Appends the ISO 8601 representation of `date` to `output`.
+    ///
+    /// Dates between the years 1600 and 9999 formatted in GMT with the default fields and separators, like `2024-04-01T12:34:56.789Z`, are written directly without allocating.
+    ///
+    /// - Parameter date: The date to format.
+    /// - Parameter output: The span to append the UTF-8 bytes of the formatted date to.
+    /// - Returns: `false` if `output` does not have room for the formatted date, in which case nothing is appended.
+    public func format(_ date: Date, into output: inout OutputSpan<UInt8>) -> Bool {
+        if _hasFixedLayout, timeZone.fixedOffsetFromGMT == 0, let second = _ISO8601FixedLayout.second(of: date) {
+            guard output.freeCapacity >= _ISO8601FixedLayout.length(includingFractionalSeconds: includingFractionalSeconds) else {
+                return false
+            }
+            _ISO8601FixedLayout.write(date, second: second, includingFractionalSeconds: includingFractionalSeconds, into: &output)
+            return true
+        }
+
+        let string = format(date)
+        guard string.utf8.count <= output.freeCapacity else {
+            return false
+        }
+        for byte in string.utf8 {
+            output.append(byte)
+        }
+        return true
+    }
+
+    /// Parses a date from the beginning of `bytes`.
+    ///
+    /// Like parsing a string, this ignores anything that follows the date.
+    ///
+    /// - Parameter bytes: UTF-8 bytes starting with an ISO 8601 date.
+    /// - Returns: The parsed date and the number of bytes it took up, or `nil` if `bytes` does not start with a date in this style.
+    public func parse(_ bytes: Span<UInt8>) -> (date: Date, consumed: Int)? {
+        if _hasFixedLayout, let result = _ISO8601FixedLayout.parse(bytes) {
+            return result
+        }
+
+        guard let string = bytes.withUnsafeBufferPointer({ String._tryFromUTF8($0) }),
+              let (end, date) = parse(string, in: string.startIndex..<string.endIndex) else {
+            return nil
+        }
+        return (date, string.utf8.distance(from: string.startIndex, to: end))
+    }
+
+    /// Creates the ISO 8601 representation of each of `dates`.
+    ///
+    /// - Parameter dates: The dates to format.
+    /// - Returns: The formatted dates, in the same order.
+    public func format(_ dates: [Date]) -> [String] {
+        guard _hasFixedLayout, timeZone.fixedOffsetFromGMT == 0 else {
+            return dates.map { format($0) }
+        }
+        let includingFractionalSeconds = includingFractionalSeconds
+        return dates.map {
+            _ISO8601FixedLayout.string(from: $0, includingFractionalSeconds: includingFractionalSeconds) ?? format($0)
+        }
+    }
+
+    /// Parses each of `strings` into a date.
+    ///
+    /// - Parameter strings: The strings to parse.
+    /// - Returns: The parsed dates, in the same order.
+    /// - Throws: The error of the first string that cannot be parsed.
+    public func parse(_ strings: [String]) throws -> [Date] {
+        guard _hasFixedLayout else {
+            return try strings.map { try parse($0) }
+        }
+        var dates = [Date]()
+        dates.reserveCapacity(strings.count)
+        for var string in strings {
+            let date = string.withUTF8 { buffer in
+                _ISO8601FixedLayout.parse(buffer.span)?.date
+            }
+            dates.append(try date ?? parse(string))
+        }
+        return dates
+    }
+}
+
 // MARK: - Regex
 
 @available(macOS 13.0, iOS 16.0, tvOS 16.0, watchOS 9.0, *)
@@ -535,3 +637,136 @@ extension RegexComponent where Self == Date.ISO8601FormatStyle {
         return Date.ISO8601FormatStyle(dateSeparator: dateSeparator, timeZone: timeZone).year().month().day()
     }
 }
+
+// MARK: - Fixed layout
+
+/// Formats and parses `yyyy-MM-ddTHH:mm:ssZ` and `yyyy-MM-ddTHH:mm:ss.SSSZ` for dates between the years 1600 and 9999 with integer arithmetic, which is much faster than going through `Calendar`. In that range, the Gregorian calendar's Julian cutover does not apply, and the results are identical to the calendar's.
+enum _ISO8601FixedLayout {
+    /// The number of bytes in `yyyy-MM-ddTHH:mm:ss.SSSZ`.
+    static let maximumLength = 24
+
+    // 1600-01-01T00:00:00Z and 10000-01-01T00:00:00Z
+    private static let supportedSeconds: Range<Int64> = -12654403200..<252423993600
+
+    // Days from 1970-01-01 to 2001-01-01
+    private static let daysAtDateReference: Int64 = 11323
+
+    static func length(includingFractionalSeconds: Bool) -> Int {
+        includingFractionalSeconds ? 24 : 20
+    }
+
+    /// The whole second containing `date`, since the reference date, or `nil` if `date` is outside of the supported range.
+    static func second(of date: Date) -> Int64? {
+        let seconds = date.timeIntervalSinceReferenceDate.rounded(.down)
+        guard seconds >= Double(supportedSeconds.lowerBound), seconds < Double(supportedSeconds.upperBound) else {
+            return nil
+        }
+        return Int64(seconds)
+    }
+
+    /// The representation of `date` in GMT, or `nil` if `date` is outside of the supported range.
+    static func string(from date: Date, includingFractionalSeconds: Bool) -> String? {
+        guard let second = second(of: date) else {
+            return nil
+        }
+        return String(_capacity: maximumLength) { output in
+            write(date, second: second, includingFractionalSeconds: includingFractionalSeconds, into: &output)
+        }
+    }
+
+    /// Appends the representation of `date` in GMT to `output`. `second` is `second(of: date)`.
+    static func write(_ date: Date, second: Int64, includingFractionalSeconds: Bool, into output: inout OutputSpan<UInt8>) {
+        precondition(supportedSeconds.contains(second) && output.freeCapacity >= length(includingFractionalSeconds: includingFractionalSeconds))
+        let days = _CalendarUtility.floorDiv(second, 86400)
+        let secondInDay = Int(second - days * 86400)
+        let (year, month, day) = _CalendarUtility.civilDate(daysSince1970: days + daysAtDateReference)
+
+        output.append(Int(year), zeroPad: 4)
+        output.append(UInt8(ascii: "-"))
+        output.append(Int(month), zeroPad: 2)
+        output.append(UInt8(ascii: "-"))
+        output.append(Int(day), zeroPad: 2)
+        output.append(UInt8(ascii: "T"))
+        output.append(secondInDay / 3600, zeroPad: 2)
+        output.append(UInt8(ascii: ":"))
+        output.append(secondInDay / 60 % 60, zeroPad: 2)
+        output.append(UInt8(ascii: ":"))
+        output.append(secondInDay % 60, zeroPad: 2)
+        if includingFractionalSeconds {
+            // The same nanosecond the calendar computes, rounded to milliseconds like `Date.ISO8601FormatStyle.format(_:)` does
+            let nanosecond = Int((date.timeIntervalSinceReferenceDate - Double(second)) * 1_000_000_000)
+            let millisecond = min(Int((Double(nanosecond) / 1_000_000.0).rounded()), 999)
+            output.append(UInt8(ascii: "."))
+            output.append(millisecond, zeroPad: 3)
+        }
+        output.append(UInt8(ascii: "Z"))
+    }
+
+    private static func digits(_ bytes: Span<UInt8>, at offset: Int, count: Int) -> Int? {
+        var value = 0
+        for i in offset..<offset + count {
+            let digit = bytes[i] &- UInt8(ascii: "0")
+            guard digit < 10 else {
+                return nil
+            }
+            value = value * 10 + Int(digit)
+        }
+        return value
+    }
+
+    /// Parses a date in GMT from the beginning of `bytes`, and returns it with the number of bytes it took up.
+    ///
+    /// Returns `nil` for anything `DateComponents.ISO8601FormatStyle` might parse differently, such as a different number of digits, a time zone offset, or a year before 1600, so that the caller can fall back to it.
+    static func parse(_ bytes: Span<UInt8>) -> (date: Date, consumed: Int)? {
+        guard bytes.count >= 20,
+              let year = digits(bytes, at: 0, count: 4), bytes[4] == UInt8(ascii: "-"),
+              let month = digits(bytes, at: 5, count: 2), bytes[7] == UInt8(ascii: "-"),
+              let day = digits(bytes, at: 8, count: 2), bytes[10] == UInt8(ascii: "T"),
+              let hour = digits(bytes, at: 11, count: 2), bytes[13] == UInt8(ascii: ":"),
+              let minute = digits(bytes, at: 14, count: 2), bytes[16] == UInt8(ascii: ":"),
+              var second = digits(bytes, at: 17, count: 2) else {
+            return nil
+        }
+        guard year >= 1600, (1...12).contains(month), (1...31).contains(day), hour <= 24, minute < 60, second <= 60 else {
+            return nil
+        }
+        // Foundation doesn't support leap seconds, so we round 60 to 59
+        if second == 60 {
+            second = 59
+        }
+
+        var offset = 19
+        var nanosecond = 0
+        if bytes[offset] == UInt8(ascii: ".") {
+            offset += 1
+            let start = offset
+            while offset < bytes.count, offset - start < 9 {
+                let digit = bytes[offset] &- UInt8(ascii: "0")
+                guard digit < 10 else {
+                    break
+                }
+                nanosecond = nanosecond * 10 + Int(digit)
+                offset += 1
+            }
+            guard offset > start else {
+                return nil
+            }
+            for _ in offset - start..<9 {
+                nanosecond *= 10
+            }
+        }
+
+        // A tenth fractional digit ends up here too, and is rejected by the general parser as well
+        guard offset < bytes.count, bytes[offset] == UInt8(ascii: "Z") || bytes[offset] == UInt8(ascii: "z") else {
+            return nil
+        }
+        if hour == 24, minute != 0 || second != 0 || nanosecond != 0 {
+            return nil
+        }
+
+        // Days past the end of the month, and an hour of 24, roll over into the following days as they do in the calendar
+        let days = _CalendarUtility.daysSince1970(year: Int64(year), month: Int64(month), day: Int64(day)) - daysAtDateReference
+        let secondsInDay = Double(hour * 3600 + minute * 60 + second) + Double(nanosecond) / 1_000_000_000
+        return (Date(timeIntervalSinceReferenceDate: Double(days * 86400) + secondsInDay), offset + 1)
+    }
+}
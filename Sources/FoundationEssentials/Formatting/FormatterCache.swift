@@ -12,45 +12,97 @@
 
 internal import Synchronization
 
+/// Formatters keyed by their configuration, which are expensive to create and safe to share.
+///
+/// The formatters are kept in a `_ShardedLRUCache`, so lookups of different configurations rarely contend. A formatter
+/// is created outside of the cache's locks, and lookups of the same configuration that arrive while it is being created
+/// wait for it rather than creating their own.
 package struct FormatterCache<Format : Hashable & Sendable, FormattingType: Sendable>: Sendable, ~Copyable {
-    let countLimit = 100
+    /// The lookups served by a cache since it was created.
+    package struct Metrics: Sendable, Equatable {
+        /// Lookups that found the formatter created or being created.
+        package var hits = 0
+        /// Lookups that created the formatter.
+        package var misses = 0
+        /// Formatters removed to make room for others. Does not include `removeAllObjects()`.
+        package var evictions = 0
+    }
 
-    private let _lock: Mutex<[Format: FormattingType]>
-    package func formatter(for config: Format, creator: () throws -> FormattingType) rethrows -> FormattingType {
-        let existed = _lock.withLock { cache in
-            return cache [config]
-        }
+    /// A formatter that is being created. Its lock is held by the creating thread until the formatter is stored.
+    private final class Pending: Sendable {
+        let value = Mutex<FormattingType?>(nil)
+    }
 
-        if let existed {
-            return existed
-        }
+    private enum Slot: Sendable {
+        case ready(FormattingType)
+        case pending(Pending)
+    }
+
+    let countLimit: Int
+
+    private let _slots: _ShardedLRUCache<Format, Slot>
+
+    private let _hits = Atomic<Int>(0)
+    private let _misses = Atomic<Int>(0)
+
+    /// Creates a cache holding about `countLimit` formatters, spread over `shardCount` shards.
+    package init(countLimit: Int = 100, shardCount: Int = 8) {
+        self.countLimit = countLimit
+        _slots = _ShardedLRUCache(countLimit: countLimit, shardCount: shardCount)
+    }
 
-        // Call `creator()` outside of the cache's lock to avoid blocking
-        let df = try creator()
+    package var metrics: Metrics {
+        Metrics(hits: _hits.load(ordering: .relaxed), misses: _misses.load(ordering: .relaxed), evictions: _slots.evictions)
+    }
 
-        _lock.withLockExtendingLifetimeOfState { cache in
-            if cache.count > countLimit {
-                cache.removeAll()
+    /// Returns the formatter for `config`, calling `creator` to create it if the cache has none.
+    ///
+    /// Other lookups of `config` wait while `creator` runs, so `creator` must not look up `config` in this cache itself:
+    /// that lookup would wait for `creator` to return, which never happens.
+    package func formatter<E: Error>(for config: Format, creator: () throws(E) -> FormattingType) throws(E) -> FormattingType {
+        let pending: Pending
+        switch _slots.value(for: config, addingIfAbsent: { .pending(Pending()) }).value {
+        case .ready(let formatter):
+            _hits.add(1, ordering: .relaxed)
+            return formatter
+        case .pending(let p):
+            pending = p
+        }
+
+        let (formatter, created) = try pending.value.withLock { value throws(E) -> (FormattingType, Bool) in
+            if let value {
+                return (value, false)
             }
-            cache[config] = df
+            // If `creator()` throws, the entry stays empty and the next lookup tries again
+            let formatter = try creator()
+            value = formatter
+            return (formatter, true)
         }
 
-        return df
+        if created {
+            _misses.add(1, ordering: .relaxed)
+            // Later lookups can skip the pending entry's lock, unless the entry has been evicted in the meantime
+            _slots.replaceValue(for: config, with: .ready(formatter)) {
+                if case .pending(let p) = $0 { p === pending } else { false }
+            }
+        } else {
+            _hits.add(1, ordering: .relaxed)
+        }
+        return formatter
     }
 
     package func removeAllObjects() {
-        _lock.withLockExtendingLifetimeOfState { cache in
-            cache.removeAll()
-        }
+        _slots.removeAll()
     }
 
     package subscript(key: Format) -> FormattingType? {
-        _lock.withLockExtendingLifetimeOfState {
-            $0[key]
+        switch _slots[key] {
+        case .ready(let formatter):
+            return formatter
+        case .pending(let pending):
+            return pending.value.withLock { $0 }
+        case nil:
+            return nil
         }
     }
-
-    package init() {
-        _lock = Mutex([Format: FormattingType]())
-    }
 }
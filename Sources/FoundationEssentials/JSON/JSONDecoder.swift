@@ -703,6 +703,12 @@ extension JSONDecoderImpl: Decoder {
             let double = try self.unwrapFloatingPoint(from: mapValue, as: Double.self, for: codingPathNode, additionalKey)
             return Date(timeIntervalSince1970: double / 1000.0)
         case .iso8601:
+            // Most dates are simple strings in the fixed layout, which can be parsed in place without creating a `String`
+            if case .string(let region, isSimple: true) = mapValue, let date = withBuffer(for: region, perform: { stringBuffer, _ in
+                _ISO8601FixedLayout.parse(stringBuffer.span)?.date
+            }) {
+                return date
+            }
             let string = try self.unwrapString(from: mapValue, for: codingPathNode, additionalKey)
             guard let date = try? Date.ISO8601FormatStyle().parse(string) else {
                 throw DecodingError.dataCorrupted(DecodingError.Context(codingPath: self.codingPath, debugDescription: "Expected date string to be ISO8601-formatted."))
@@ -1205,6 +1205,9 @@ private extension __JSONEncoder {
             return try .number(from: 1000.0 * date.timeIntervalSince1970, with: .throw, encoder: self, additionalKey)
 
         case .iso8601:
+            if let string = _ISO8601FixedLayout.string(from: date, includingFractionalSeconds: false) {
+                return self.wrap(string)
+            }
             return self.wrap(date.formatted(.iso8601))
 
 #if FOUNDATION_FRAMEWORK && !NO_FORMATTERS
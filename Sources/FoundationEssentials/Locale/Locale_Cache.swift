@@ -120,7 +120,8 @@ struct LocaleCache : Sendable, ~Copyable {
     let lock: Mutex<State>
 
     static let cache = LocaleCache()
-    private let _currentCache = Mutex<(any _LocaleProtocol)?>(nil)
+    // Read on every access to `Locale.current` and the autoupdating locale, so reading it does not lock
+    private let _currentCache = _PublishedSnapshot<any _LocaleProtocol>()
 
 #if FOUNDATION_FRAMEWORK
     private let _currentNSCache = Mutex<_NSSwiftLocale?>(nil)
@@ -136,16 +137,14 @@ struct LocaleCache : Sendable, ~Copyable {
     func resetCurrent(to preferences: LocalePreferences) {
         // Disable bundle matching so we can emulate a non-English main bundle during test
         let newLocale = _localeICUClass().init(name: nil, prefs: preferences, disableBundleMatching: true)
-        _currentCache.withLock {
-            $0 = newLocale
-        }
+        _currentCache.publish(newLocale)
 #if FOUNDATION_FRAMEWORK
         _currentNSCache.withLock { $0 = nil }
 #endif
     }
 
     func reset() {
-        _currentCache.withLock { $0 = nil }
+        _currentCache.publish(nil)
 #if FOUNDATION_FRAMEWORK
         _currentNSCache.withLock { $0 = nil }
 #endif
@@ -156,7 +155,7 @@ struct LocaleCache : Sendable, ~Copyable {
     }
 
     fileprivate var _currentAndCache: (locale: any _LocaleProtocol, doCache: Bool) {
-        if let result = _currentCache.withLock({ $0 }) {
+        if let result = _currentCache.value {
             return (result, true)
         }
 
@@ -166,15 +165,8 @@ struct LocaleCache : Sendable, ~Copyable {
 
         // It's possible this was an 'incomplete locale', in which case we will want to calculate it again later.
         if doCache {
-            return _currentCache.withLock {
-                if let current = $0 {
-                    // Someone beat us to setting it - use existing one
-                    return (current, true)
-                } else {
-                    $0 = locale
-                    return (locale, true)
-                }
-            }
+            // If someone beat us to setting it, use the existing one
+            return (_currentCache.publishIfAbsent(locale), true)
         } else {
             return (locale, false)
         }
@@ -73,7 +73,7 @@ extension PredicateExpressions {
         public init(from decoder: any Decoder) throws {
             let container = try decoder.singleValueContainer()
             self.stringRepresentation = try container.decode(String.self)
-            self._storage = _Storage(regex: try Regex<AnyRegexOutput>(self.stringRepresentation))
+            self._storage = _Storage(regex: try RegexPatternCache.cache.regex(for: self.stringRepresentation, flavor: .pattern))
         }
         
         public func encode(to encoder: any Encoder) throws {
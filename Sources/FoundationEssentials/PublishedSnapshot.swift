@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import Synchronization
+
+/// A value that is read far more often than it changes, such as the current locale or time zone.
+///
+/// Reading is a single atomic load of the most recently published snapshot and never takes a lock. Publishing is serialized on a mutex.
+///
+/// A reader may still be using a snapshot it loaded just before a new one was published, so replaced snapshots are retired rather than released, and stay alive until the snapshot itself is destroyed. Knowing when no reader can still hold one would take a shared store on every read, which is the cross-core traffic this type exists to avoid. Instead, the retained memory is bounded by the number of replacements: one snapshot for each time a value is published over another, which only happens when preferences change or caches are reset. Clearing an empty snapshot and publishing into one retire nothing.
+struct _PublishedSnapshot<Value: Sendable>: Sendable, ~Copyable {
+    private final class Snapshot: Sendable {
+        let value: Value
+
+        init(_ value: Value) {
+            self.value = value
+        }
+    }
+
+    private let _published = Atomic<Unmanaged<Snapshot>?>(nil)
+    private let _retired = Mutex<[Snapshot]>([])
+
+    init() {}
+
+    deinit {
+        _published.load(ordering: .relaxed)?.release()
+    }
+
+    /// The most recently published value, or `nil` if the snapshot was cleared and nothing has been published since.
+    var value: Value? {
+        guard let snapshot = _published.load(ordering: .acquiring) else {
+            return nil
+        }
+        return snapshot._withUnsafeGuaranteedRef { $0.value }
+    }
+
+    /// Publishes `newValue`, or clears the snapshot if it is `nil`.
+    func publish(_ newValue: Value?) {
+        _retired.withLock { retired in
+            _replace(with: newValue.map(Snapshot.init), retiringInto: &retired)
+        }
+    }
+
+    /// Publishes `newValue` unless another value was published first, and returns whichever value is now published.
+    func publishIfAbsent(_ newValue: Value) -> Value {
+        _retired.withLock { retired in
+            if let existing = _published.load(ordering: .acquiring) {
+                return existing._withUnsafeGuaranteedRef { $0.value }
+            }
+            _replace(with: Snapshot(newValue), retiringInto: &retired)
+            return newValue
+        }
+    }
+
+    private func _replace(with snapshot: Snapshot?, retiringInto retired: inout [Snapshot]) {
+        let new = snapshot.map { Unmanaged.passRetained($0) }
+        guard let old = _published.exchange(new, ordering: .acquiringAndReleasing) else {
+            return
+        }
+        // Keep the old snapshot alive for readers that loaded it before the exchange
+        retired.append(old.takeRetainedValue())
+    }
+}
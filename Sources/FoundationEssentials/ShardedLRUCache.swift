@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+
+internal import Synchronization
+
+/// A cache that holds about `countLimit` values and is looked up from many threads at once.
+///
+/// Keys are spread over shards by hash, each behind its own lock, so lookups of different keys rarely contend. The count limit applies to the whole cache rather than to each shard, so keys that happen to hash to the same shard do not evict each other while the cache has room. Once it is full, adding a value evicts the least recently used value of the same shard.
+struct _ShardedLRUCache<Key: Hashable & Sendable, Value: Sendable>: Sendable, ~Copyable {
+    private struct Shard: Sendable {
+        var entries: [Key: (value: Value, lastUse: UInt64)] = [:]
+        var clock: UInt64 = 0
+    }
+
+    private final class ShardBox: Sendable {
+        let shard = Mutex(Shard())
+    }
+
+    let countLimit: Int
+
+    private let shards: [ShardBox]
+    // Only changed while holding the lock of the shard that gains or loses values, so it is exact once all shards are unlocked
+    private let count = Atomic<Int>(0)
+    private let _evictions = Atomic<Int>(0)
+
+    /// Creates a cache holding about `countLimit` values, spread over `shardCount` shards.
+    init(countLimit: Int, shardCount: Int) {
+        precondition(countLimit > 0 && shardCount > 0, "Cache count limit and shard count must be positive")
+        self.countLimit = countLimit
+        shards = (0 ..< shardCount).map { _ in ShardBox() }
+    }
+
+    /// The number of values removed to make room for others. Does not include `removeAll()`.
+    var evictions: Int {
+        _evictions.load(ordering: .relaxed)
+    }
+
+    private func shard(for key: Key) -> ShardBox {
+        shards[Int(UInt(bitPattern: key.hashValue) % UInt(shards.count))]
+    }
+
+    /// Returns the value for `key` and marks it as the most recently used one, or adds the value returned by `makeValue` if there is none.
+    ///
+    /// `makeValue` is called while the shard is locked, so it should only create a placeholder that the caller completes afterwards.
+    func value(for key: Key, addingIfAbsent makeValue: () -> Value) -> (value: Value, added: Bool) {
+        // Anything evicted is released when this goes out of scope, outside of the shard's lock
+        let (result, evicted) = shard(for: key).shard.withLock { shard -> ((value: Value, added: Bool), Value?) in
+            shard.clock += 1
+            if let existing = shard.entries[key]?.value {
+                shard.entries[key]!.lastUse = shard.clock
+                return ((existing, false), nil)
+            }
+            var evicted: Value?
+            if count.load(ordering: .relaxed) >= countLimit, let leastRecent = shard.entries.min(by: { $0.value.lastUse < $1.value.lastUse })?.key {
+                evicted = shard.entries.removeValue(forKey: leastRecent)?.value
+                _evictions.add(1, ordering: .relaxed)
+            } else {
+                count.add(1, ordering: .relaxed)
+            }
+            let value = makeValue()
+            shard.entries[key] = (value, shard.clock)
+            return ((value, true), evicted)
+        }
+        _ = evicted
+        return result
+    }
+
+    /// Replaces the value for `key` with `newValue` if `shouldReplace` returns `true` for the current one. This does not count as a use of `key`.
+    func replaceValue(for key: Key, with newValue: Value, if shouldReplace: (Value) -> Bool) {
+        shard(for: key).shard.withLockExtendingLifetimeOfState { shard in
+            if let existing = shard.entries[key]?.value, shouldReplace(existing) {
+                shard.entries[key]!.value = newValue
+            }
+        }
+    }
+
+    /// The value for `key`, if there is one. This does not count as a use of `key`.
+    subscript(key: Key) -> Value? {
+        shard(for: key).shard.withLock {
+            $0.entries[key]?.value
+        }
+    }
+
+    func removeAll() {
+        for box in shards {
+            box.shard.withLockExtendingLifetimeOfState { shard in
+                count.subtract(shard.entries.count, ordering: .relaxed)
+                shard.entries.removeAll()
+            }
+        }
+    }
+}
@@ -0,0 +1,282 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#if !os(Windows)
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Android)
+import Android
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif os(WASI)
+import WASILibc
+#endif
+
+/// A file system path that is edited in place.
+///
+/// The builder owns a growable buffer holding the file system representation of the path, which is always
+/// null-terminated, so it can be handed to system calls without creating a `String` or copying the path. Loops that
+/// visit many files under one directory can append a name, make a call and truncate back to the directory:
+///
+///     var path = _PathBuilder(fileSystemRepresentation: directory)
+///     let directoryLength = path.count
+///     for name in names {
+///         path.truncate(to: directoryLength)
+///         path.appendComponent(name)
+///         path.withFileSystemRepresentation { unlink($0!) }
+///     }
+///
+/// The editing operations follow their counterparts on `String`: `appendComponent` follows `appendingPathComponent`,
+/// `removeLastComponent` matches `deletingLastPathComponent`, `compressSlashes` matches `_compressingSlashes` and
+/// `removeDotSegments` matches `removingDotSegments`. `appendComponent` never changes the existing path, so that
+/// truncating back to its length restores it. Its result therefore equals `appendingPathComponent` only when the
+/// existing path has no runs of slashes and no trailing slash other than a lone root; call `compressSlashes` and
+/// `removeTrailingSlashes` first to get the same result for any path.
+struct _PathBuilder: ~Copyable {
+    private var storage: UnsafeMutableBufferPointer<UInt8>
+
+    /// The length of the path in bytes, not including the null terminator.
+    private(set) var count: Int
+
+    /// Creates an empty path with room for `capacity` bytes before it needs to grow.
+    init(capacity: Int = 256) {
+        storage = .allocate(capacity: Swift.max(capacity, 0) + 1)
+        storage[0] = 0
+        count = 0
+    }
+
+    /// Creates a path from a null-terminated file system representation, such as one returned by `readdir` or `fts_read`.
+    init(fileSystemRepresentation: UnsafePointer<CChar>) {
+        let length = strlen(fileSystemRepresentation)
+        storage = .allocate(capacity: length + 1)
+        fileSystemRepresentation.withMemoryRebound(to: UInt8.self, capacity: length + 1) {
+            _ = storage.initialize(fromContentsOf: UnsafeBufferPointer(start: $0, count: length + 1))
+        }
+        count = length
+    }
+
+    /// Creates a path from the file system representation of `path`, or returns `nil` if `path` has none.
+    init?(fileSystemRepresentationOf path: String) {
+        let storage: UnsafeMutableBufferPointer<UInt8>
+        #if canImport(Darwin) || FOUNDATION_FRAMEWORK
+        storage = .allocate(capacity: path.maxFileSystemRepresentationSize)
+        guard path._decomposed(.hfsPlus, into: storage, nullTerminated: true) != nil else {
+            storage.deallocate()
+            return nil
+        }
+        #else
+        storage = .allocate(capacity: path.utf8.count + 1)
+        storage[storage.initialize(fromContentsOf: path.utf8)] = 0
+        #endif
+        self.storage = storage
+        // Embedded null bytes end the file system representation
+        self.count = storage.firstIndex(of: 0)!
+    }
+
+    deinit {
+        storage.deallocate()
+    }
+
+    var isEmpty: Bool {
+        count == 0
+    }
+
+    /// The bytes of the path, not including the null terminator.
+    var span: Span<UInt8> {
+        @_lifetime(borrow self)
+        get {
+            let span = Span(_unsafeElements: UnsafeBufferPointer(rebasing: storage[..<count]))
+            return _overrideLifetime(span, borrowing: self)
+        }
+    }
+
+    private mutating func _reserveCapacity(_ minimumCount: Int) {
+        // Leave room for the null terminator
+        guard minimumCount >= storage.count else {
+            return
+        }
+        let newStorage = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: Swift.max(minimumCount + 1, storage.count * 2))
+        _ = newStorage.initialize(fromContentsOf: storage[...count])
+        storage.deallocate()
+        storage = newStorage
+    }
+
+    private mutating func _setCount(_ newCount: Int) {
+        count = newCount
+        storage[count] = 0
+    }
+
+    /// Shortens the path to its first `newCount` bytes, typically to return to a length saved before appending.
+    mutating func truncate(to newCount: Int) {
+        precondition(newCount >= 0 && newCount <= count, "Path length out of range")
+        _setCount(newCount)
+    }
+
+    /// Appends the bytes of `bytes` to the path as they are, without inserting a separator.
+    mutating func append(_ bytes: UnsafeBufferPointer<UInt8>) {
+        _reserveCapacity(count + bytes.count)
+        _ = UnsafeMutableBufferPointer(rebasing: storage[count...]).initialize(fromContentsOf: bytes)
+        _setCount(count + bytes.count)
+    }
+
+    /// Appends `component` to the path, separated by a single slash.
+    ///
+    /// Like `appendingPathComponent`, runs of slashes at the join and within `component` are compressed, and trailing
+    /// slashes of `component` are dropped. Unlike it, the existing path is kept as it is, including its slashes.
+    mutating func appendComponent(_ component: UnsafeBufferPointer<UInt8>) {
+        // Standardize only the appended bytes, so truncating back to `start` restores the existing path
+        let start = count
+        _reserveCapacity(count + component.count + 1)
+        let endsWithSlash = count > 0 && storage[count - 1] == ._slash
+        if count > 0 && !endsWithSlash {
+            storage[count] = ._slash
+            count += 1
+        }
+        append(component)
+
+        var end = start
+        var previousWasSlash = endsWithSlash
+        for i in start ..< count {
+            let byte = storage[i]
+            if byte == ._slash && previousWasSlash {
+                continue
+            }
+            previousWasSlash = byte == ._slash
+            storage[end] = byte
+            end += 1
+        }
+        while end > Swift.max(start, 1) && storage[end - 1] == ._slash {
+            end -= 1
+        }
+        _setCount(end)
+    }
+
+    /// Appends a null-terminated file system representation, such as the name of a directory entry, to the path.
+    mutating func appendComponent(_ component: UnsafePointer<CChar>) {
+        let length = strlen(component)
+        component.withMemoryRebound(to: UInt8.self, capacity: length) {
+            appendComponent(UnsafeBufferPointer(start: $0, count: length))
+        }
+    }
+
+    /// Appends the file system representation of `component` to the path.
+    mutating func appendComponent(_ component: String) {
+        #if canImport(Darwin) || FOUNDATION_FRAMEWORK
+        component.withFileSystemRepresentation {
+            guard let rep = $0 else { return }
+            appendComponent(rep)
+        }
+        #else
+        var component = component
+        component.withUTF8 {
+            appendComponent($0)
+        }
+        #endif
+    }
+
+    /// Removes the last component of the path along with the slashes before it, leaving `/` for an absolute path with
+    /// a single component and an empty path for a relative one.
+    mutating func removeLastComponent() {
+        guard let lastSlash = _lastIndex(before: count, where: { $0 == ._slash }) else {
+            // No slash, the entire path is deleted
+            _setCount(0)
+            return
+        }
+        // Skip past consecutive slashes, if any
+        guard let lastNonSlash = _lastIndex(before: lastSlash, where: { $0 != ._slash }) else {
+            // The path is entirely slashes, or a single component after them
+            _setCount(1)
+            return
+        }
+        guard lastSlash == count - 1 else {
+            // No trailing slash, keep up to (including) the last non-slash byte
+            _setCount(lastNonSlash + 1)
+            return
+        }
+        // We have a trailing slash, find the slash before the last component
+        guard let previousSlash = _lastIndex(before: lastNonSlash, where: { $0 == ._slash }) else {
+            _setCount(0)
+            return
+        }
+        guard let previousNonSlash = _lastIndex(before: previousSlash, where: { $0 != ._slash }) else {
+            _setCount(1)
+            return
+        }
+        _setCount(previousNonSlash + 1)
+    }
+
+    private func _lastIndex(before end: Int, where predicate: (UInt8) -> Bool) -> Int? {
+        var i = end
+        while i > 0 {
+            i -= 1
+            if predicate(storage[i]) {
+                return i
+            }
+        }
+        return nil
+    }
+
+    /// Replaces each run of slashes in the path with a single slash.
+    mutating func compressSlashes() {
+        guard count > 1 else {
+            return
+        }
+        var end = 1
+        for i in 1 ..< count where storage[i] != ._slash || storage[end - 1] != ._slash {
+            storage[end] = storage[i]
+            end += 1
+        }
+        _setCount(end)
+    }
+
+    /// Removes the trailing slashes of the path, except for the slash of the root directory.
+    mutating func removeTrailingSlashes() {
+        var end = count
+        while end > 1 && storage[end - 1] == ._slash {
+            end -= 1
+        }
+        _setCount(end)
+    }
+
+    /// Resolves `.` and `..` components in the path without consulting the file system.
+    mutating func removeDotSegments() {
+        guard count > 0 else {
+            return
+        }
+        let length = resolveDotSegmentsInPlace(buffer: UnsafeMutableBufferPointer(rebasing: storage[..<count]))
+        // resolveDotSegmentsInPlace returns "." instead of "" for compatibility with CFURL, but removingDotSegments
+        // returns "", so match that here.
+        _setCount(length == 1 && storage[0] == ._dot ? 0 : length)
+    }
+}
+
+extension _PathBuilder: FileSystemRepresentable {
+    func withFileSystemRepresentation<R>(_ block: (UnsafePointer<CChar>?) throws -> R) rethrows -> R {
+        try storage.withMemoryRebound(to: CChar.self) {
+            try block($0.baseAddress!)
+        }
+    }
+
+    var path: String {
+        String(decoding: UnsafeBufferPointer(rebasing: storage[..<count]), as: UTF8.self)
+    }
+
+    var urlForError: URL? {
+        // use path
+        nil
+    }
+}
+
+#endif // !os(Windows)
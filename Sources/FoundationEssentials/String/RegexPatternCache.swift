@@ -12,35 +12,84 @@
 
 internal import Synchronization
 
+/// Regular expressions compiled from patterns given as strings, shared by the whole process.
+///
+/// The compiled patterns are kept in a `_ShardedLRUCache`, so lookups of different patterns rarely contend. A pattern
+/// is compiled outside of the cache's locks, and lookups that arrive while it is compiling wait for that compile
+/// rather than starting their own.
 struct RegexPatternCache: Sendable, ~Copyable {
-    private struct Key : Sendable, Hashable {
+    /// How a pattern is compiled.
+    enum Flavor: Sendable, Hashable {
+        /// As written, such as a `PredicateRegex` decoded from its string representation.
+        case pattern
+        /// For the `regularExpression` string compare option, with simple word boundaries.
+        case stringSearch(caseInsensitive: Bool)
+    }
+
+    /// The lookups served by a cache since it was created.
+    struct Metrics: Sendable, Equatable {
+        /// Lookups that found the pattern compiled or compiling.
+        var hits = 0
+        /// Lookups that compiled the pattern.
+        var misses = 0
+        /// Patterns removed to make room for others.
+        var evictions = 0
+    }
+
+    private struct Key: Sendable, Hashable {
         var pattern: String
-        var caseInsensitive: Bool
+        var flavor: Flavor
+    }
+
+    /// The result of compiling one pattern. Its lock is held while compiling, which makes later lookups of the same
+    /// pattern wait for the result. Failures are kept too, so an invalid pattern is not compiled again on each lookup.
+    private final class Entry: Sendable {
+        let result = Mutex<Result<Regex<AnyRegexOutput>, any Error>?>(nil)
     }
 
-    private let _lock: Mutex<[Key: Regex<AnyRegexOutput>]>
+    private let entries: _ShardedLRUCache<Key, Entry>
+
+    private let hits = Atomic<Int>(0)
+    private let misses = Atomic<Int>(0)
 
     static let cache = RegexPatternCache()
 
-    fileprivate init() {
-        _lock = Mutex(.init())
+    /// Creates a cache holding about `capacity` patterns, spread over `shardCount` shards.
+    init(capacity: Int = 256, shardCount: Int = 8) {
+        entries = _ShardedLRUCache(countLimit: capacity, shardCount: shardCount)
     }
 
-    func regex(for pattern: String, caseInsensitive: Bool) throws -> Regex<AnyRegexOutput>? {
-
-        let key = Key(pattern: pattern, caseInsensitive: caseInsensitive)
+    var metrics: Metrics {
+        Metrics(hits: hits.load(ordering: .relaxed), misses: misses.load(ordering: .relaxed), evictions: entries.evictions)
+    }
 
-        return try _lock.withLock { cache in
+    func regex(for pattern: String, caseInsensitive: Bool) throws -> Regex<AnyRegexOutput> {
+        try regex(for: pattern, flavor: .stringSearch(caseInsensitive: caseInsensitive))
+    }
 
-            if let cached = cache[key] {
-                return cached
+    func regex(for pattern: String, flavor: Flavor) throws -> Regex<AnyRegexOutput> {
+        let entry = entries.value(for: Key(pattern: pattern, flavor: flavor), addingIfAbsent: { Entry() }).value
+        return try entry.result.withLock { result in
+            if let result {
+                hits.add(1, ordering: .relaxed)
+                return result
             }
+            misses.add(1, ordering: .relaxed)
+            let compiled: Result<Regex<AnyRegexOutput>, any Error> = Result { try Self.compile(pattern, flavor: flavor) }
+            result = compiled
+            return compiled
+        }.get()
+    }
 
+    private static func compile(_ pattern: String, flavor: Flavor) throws -> Regex<AnyRegexOutput> {
+        switch flavor {
+        case .pattern:
+            return try Regex(pattern)
+        case .stringSearch(let caseInsensitive):
             var r = try Regex(pattern).wordBoundaryKind(.simple)
             if caseInsensitive {
                 r = r.ignoresCase()
             }
-            cache[key] = r
             return r
         }
     }
@@ -10,6 +10,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+internal import _FoundationCShims
+
 package extension UTF8.CodeUnit {
     static let newline: Self = 0x0A
     static let carriageReturn: Self = 0x0D
@@ -570,12 +572,26 @@ extension Substring {
         let numeric = options.contains(.numeric)
         let forceOrdering = options.contains(.forcedOrdering)
 
+        var string1 = self
+        var string2 = other
+        if options.isSubset(of: Self._asciiFastPathOptions) {
+            switch _compareASCIIPrefix(with: other, caseFold: caseFold, literal: options.contains(.literal)) {
+            case .decided(let result):
+                return result
+            case .resume(let offset):
+                string1 = self[utf8.index(startIndex, offsetBy: offset)...]
+                string2 = other[other.utf8.index(other.startIndex, offsetBy: offset)...]
+            case nil:
+                break
+            }
+        }
+
         var result: ComparisonResult
         if options.contains(.literal) {
             // Per documentation, literal means "Performs a byte-for-byte comparison. Differing literal sequences (such as composed character sequences) that would otherwise be considered equivalent are considered not to match." Therefore we're comparing the scalars rather than characters
-            result = unicodeScalars._compare(other.unicodeScalars, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticInsensitive, caseFold: caseFold, numeric: numeric, forceOrdering: forceOrdering)
+            result = string1.unicodeScalars._compare(string2.unicodeScalars, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticInsensitive, caseFold: caseFold, numeric: numeric, forceOrdering: forceOrdering)
         } else {
-            result = _compare(other, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticInsensitive, caseFold: caseFold, numeric: numeric, forceOrdering: forceOrdering)
+            result = string1._compare(string2, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticInsensitive, caseFold: caseFold, numeric: numeric, forceOrdering: forceOrdering)
         }
 
         if result == .orderedSame && forceOrdering {
@@ -602,9 +618,7 @@ extension Substring {
     func _range(of strToFind: Substring, options: String.CompareOptions) throws -> Range<Index>? {
         #if !NO_REGEX
         if options.contains(.regularExpression) {
-            guard let regex = try RegexPatternCache.cache.regex(for: String(strToFind), caseInsensitive: options.contains(.caseInsensitive)) else {
-                return nil
-            }
+            let regex = try RegexPatternCache.cache.regex(for: String(strToFind), caseInsensitive: options.contains(.caseInsensitive))
 
             if options.contains(.anchored) {
                 guard let match = prefixMatch(of: regex) else { return nil }
@@ -615,7 +629,13 @@ extension Substring {
             }
         }
         #endif
-        
+
+        return _range(of: strToFind, options: options, asciiShifts: nil)
+    }
+
+    /// Searches for `strToFind` without regular expressions. A `String.Searcher` passes the shift table it prepared for
+    /// its pattern as `asciiShifts`, which also lets case-sensitive searches take the ASCII fast path.
+    func _range(of strToFind: Substring, options: String.CompareOptions, asciiShifts: _ASCIIShiftTable?) -> Range<Index>? {
         guard !isEmpty, !strToFind.isEmpty else {
             return nil
         }
@@ -626,11 +646,25 @@ extension Substring {
         let anchored = options.contains(.anchored)
         let backwards = options.contains(.backwards)
 
+        var haystack = self
+        if options.isSubset(of: Self._asciiFastPathOptions.union([.anchored, .backwards])) && (toHalfWidth || diacriticsInsensitive || caseFold || asciiShifts != nil) {
+            switch _rangeOfASCII(strToFind, caseFold: caseFold, literal: options.contains(.literal), anchored: anchored, backwards: backwards, shifts: asciiShifts) {
+            case .found(let range):
+                return utf8.index(startIndex, offsetBy: range.lowerBound) ..< utf8.index(startIndex, offsetBy: range.upperBound)
+            case .notFound:
+                return nil
+            case .searchFrom(let offset):
+                haystack = self[utf8.index(startIndex, offsetBy: offset)...]
+            case nil:
+                break
+            }
+        }
+
         let result: Range<Index>?
         if options.contains(.literal) {
-            result = unicodeScalars._range(of: strToFind.unicodeScalars, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticsInsensitive, caseFold: caseFold, anchored: anchored, backwards: backwards)
+            result = haystack.unicodeScalars._range(of: strToFind.unicodeScalars, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticsInsensitive, caseFold: caseFold, anchored: anchored, backwards: backwards)
         } else {
-            result = _range(of: strToFind, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticsInsensitive, caseFold: caseFold, anchored: anchored, backwards: backwards)
+            result = haystack._range(of: strToFind, toHalfWidth: toHalfWidth, diacriticsInsensitive: diacriticsInsensitive, caseFold: caseFold, anchored: anchored, backwards: backwards)
         }
 
         return result
@@ -646,9 +680,11 @@ extension Substring {
 
     // Only throws when using `.regularExpression` option
     package func _enumerateComponents(separatedBy separator: Substring, options: String.CompareOptions, withBlock block: (_ component: Substring, _ isLastComponent: Bool) -> ()) throws {
+        // Prepare the separator once rather than for every component
+        let searcher = options.contains(.regularExpression) ? nil : _StringSearch(pattern: separator, options: options)
         var searchStart = startIndex
         while searchStart < endIndex {
-            let r = try self[searchStart...]._range(of: separator, options: options)
+            let r = try searcher.map { $0.range(in: self[searchStart...]) } ?? self[searchStart...]._range(of: separator, options: options)
             guard let r, !r.isEmpty else {
                 break
             }
@@ -661,6 +697,164 @@ extension Substring {
     }
 }
 
+// MARK: - ASCII Fast Paths
+
+// For ASCII text, width and diacritic insensitivity have no effect and case insensitivity only maps 'A'...'Z' to
+// 'a'...'z', so comparing and searching reduce to comparing bytes, which the `_asciishims` kernels do a vector at a
+// time. These paths handle as much of the input as they can that way, without transforming any characters into
+// temporary strings, and leave the rest, starting at a character boundary, to the general algorithms above.
+
+internal enum _ASCIIPrefixComparison {
+    /// The result of the comparison.
+    case decided(ComparisonResult)
+    /// Both inputs start with the same characters up to this UTF-8 offset, and the rest needs the general algorithm.
+    case resume(Int)
+}
+
+internal enum _ASCIISearchResult {
+    /// The UTF-8 offsets of the match.
+    case found(Range<Int>)
+    case notFound
+    /// No match starts before this UTF-8 offset, and the rest needs the general algorithm.
+    case searchFrom(Int)
+}
+
+extension Substring {
+    /// The options that the ASCII fast paths implement.
+    static var _asciiFastPathOptions: String.CompareOptions {
+        [.caseInsensitive, .diacriticInsensitive, .widthInsensitive, .literal]
+    }
+
+    /// Compares the leading ASCII characters of `self` and `other`, or returns `nil` if their UTF-8 is not contiguous.
+    func _compareASCIIPrefix(with other: Substring, caseFold: Bool, literal: Bool) -> _ASCIIPrefixComparison? {
+        let result = utf8.withContiguousStorageIfAvailable { bytes1 in
+            other.utf8.withContiguousStorageIfAvailable { bytes2 in
+                _compareASCII(bytes1, bytes2, caseFold: caseFold, literal: literal)
+            }
+        }
+        return result ?? nil
+    }
+
+    /// Searches the ASCII part of `self` for `strToFind`, or returns `nil` if the fast path does not apply.
+    func _rangeOfASCII(_ strToFind: Substring, caseFold: Bool, literal: Bool, anchored: Bool, backwards: Bool, shifts: _ASCIIShiftTable? = nil) -> _ASCIISearchResult? {
+        let result = utf8.withContiguousStorageIfAvailable { haystack in
+            strToFind.utf8.withContiguousStorageIfAvailable { needle in
+                _searchASCII(haystack, needle, shifts: shifts, caseFold: caseFold, literal: literal, anchored: anchored, backwards: backwards)
+            } ?? nil
+        }
+        return result ?? nil
+    }
+}
+
+/// Whether the byte at `offset` starts a character, given that it and the byte before it are ASCII. The only ASCII
+/// character of more than one byte is CR-LF.
+private func _startsASCIICharacter(_ bytes: UnsafeBufferPointer<UInt8>, at offset: Int) -> Bool {
+    offset == 0 || offset == bytes.count || !(bytes[offset - 1] == .carriageReturn && bytes[offset] == .newline)
+}
+
+/// Whether the ASCII byte at `offset`, which follows ASCII, is a character by itself.
+private func _isSingleByteASCIICharacter(_ bytes: UnsafeBufferPointer<UInt8>, at offset: Int) -> Bool {
+    _startsASCIICharacter(bytes, at: offset) && (offset + 1 == bytes.count || (bytes[offset + 1] < 0x80 && _startsASCIICharacter(bytes, at: offset + 1)))
+}
+
+private func _compareASCII(_ bytes1: UnsafeBufferPointer<UInt8>, _ bytes2: UnsafeBufferPointer<UInt8>, caseFold: Bool, literal: Bool) -> _ASCIIPrefixComparison {
+    let length = min(bytes1.count, bytes2.count)
+    let common = length == 0 ? 0 : _asciishims_common_prefix(bytes1.baseAddress!, bytes2.baseAddress!, length, caseFold)
+
+    if common == length {
+        if bytes1.count == bytes2.count {
+            return .decided(.orderedSame)
+        }
+        // One is a prefix of the other, unless what follows could still be ignored or join the last character
+        let longer = bytes1.count > length ? bytes1 : bytes2
+        if longer[common] < 0x80 && (literal || _startsASCIICharacter(longer, at: common)) {
+            return .decided(bytes1.count < bytes2.count ? .orderedAscending : .orderedDescending)
+        }
+    } else {
+        let byte1 = bytes1[common]
+        let byte2 = bytes2[common]
+        // Characters differ at ASCII bytes, which decide the order, unless a byte is part of a larger character
+        if byte1 < 0x80 && byte2 < 0x80 && (literal || (_isSingleByteASCIICharacter(bytes1, at: common) && _isSingleByteASCIICharacter(bytes2, at: common))) {
+            return .decided(caseFold ? ComparisonResult(byte1._lowercased, byte2._lowercased) : ComparisonResult(byte1, byte2))
+        }
+    }
+
+    // Start over at the last common character, which the byte that follows it may extend
+    var resume = max(common - 1, 0)
+    if !_startsASCIICharacter(bytes1, at: resume) {
+        resume -= 1
+    }
+    return .resume(resume)
+}
+
+private func _searchASCII(_ haystack: UnsafeBufferPointer<UInt8>, _ needle: UnsafeBufferPointer<UInt8>, shifts: _ASCIIShiftTable?, caseFold: Bool, literal: Bool, anchored: Bool, backwards: Bool) -> _ASCIISearchResult? {
+    guard let h = haystack.baseAddress, let n = needle.baseAddress, _asciishims_first_nonascii(n, needle.count) == needle.count else {
+        return nil
+    }
+    let asciiEnd = _asciishims_first_nonascii(h, haystack.count)
+    func isMatch(at offset: Int) -> Bool {
+        literal || (_startsASCIICharacter(haystack, at: offset) && _startsASCIICharacter(haystack, at: offset + needle.count))
+    }
+    func matches(at offset: Int) -> Bool {
+        _asciishims_common_prefix(h + offset, n, needle.count, caseFold) == needle.count && isMatch(at: offset)
+    }
+
+    if backwards {
+        // A match that starts in a non-ASCII part could end in the ASCII part after it, so this needs all of it
+        guard asciiEnd == haystack.count else {
+            return nil
+        }
+        let lastStart = haystack.count - needle.count
+        guard lastStart >= 0 else {
+            return .notFound
+        }
+        if anchored {
+            return matches(at: lastStart) ? .found(lastStart ..< haystack.count) : .notFound
+        }
+        var to = haystack.count
+        while true {
+            let offset = shifts?.last(of: needle, in: haystack, before: to, caseFold: caseFold) ?? _asciishims_last(h, to, haystack.count, n, needle.count, caseFold)
+            if offset == haystack.count {
+                return .notFound
+            }
+            if isMatch(at: offset) {
+                return .found(offset ..< offset + needle.count)
+            }
+            to = offset
+        }
+    }
+
+    // A match in the ASCII part must be followed by ASCII, which cannot extend its last character
+    let limit = asciiEnd == haystack.count ? asciiEnd : max(asciiEnd - 1, 0)
+    if anchored {
+        if needle.count <= limit {
+            return matches(at: 0) ? .found(0 ..< needle.count) : .notFound
+        }
+        return asciiEnd == haystack.count ? .notFound : .searchFrom(0)
+    }
+
+    var from = 0
+    while true {
+        let offset = shifts?.first(of: needle, in: UnsafeBufferPointer(rebasing: haystack[..<limit]), from: from, caseFold: caseFold) ?? _asciishims_first(h, from, limit, n, needle.count, caseFold)
+        if offset == limit {
+            break
+        }
+        if isMatch(at: offset) {
+            return .found(offset ..< offset + needle.count)
+        }
+        from = offset + 1
+    }
+    if asciiEnd == haystack.count {
+        return .notFound
+    }
+    // The matches that were not checked are those that extend beyond the limit
+    var resume = max(limit - needle.count + 1, 0)
+    if !_startsASCIICharacter(haystack, at: resume) {
+        resume -= 1
+    }
+    return .searchFrom(resume)
+}
+
 extension Substring.UnicodeScalarView {
     func _compare(_ other: Substring.UnicodeScalarView) -> ComparisonResult {
         var idx1 = startIndex
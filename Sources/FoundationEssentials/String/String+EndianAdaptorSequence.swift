@@ -10,6 +10,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+internal import _FoundationCShims
+
 enum Endianness {
     case little
     case big
@@ -310,3 +312,62 @@ struct UnicodeScalarToDataAdaptor : Sequence {
         }
     }
 }
+
+extension String {
+    /// Creates a string from UTF-16 `bytes`, handling the byte order and BOM the same way as `UTF16EndianAdaptor`, or
+    /// returns `nil` if the bytes are not valid UTF-16. A trailing odd byte is ignored.
+    internal static func _fromUTF16(_ bytes: UnsafeBufferPointer<UInt8>, endianness: Endianness?) -> String? {
+        var bytes = bytes
+        var endianness = endianness
+        if endianness == nil {
+            // Only an unspecified byte order is taken from a BOM, which is then removed
+            if bytes.starts(with: [0xFF, 0xFE]) {
+                endianness = .little
+                bytes = UnsafeBufferPointer(rebasing: bytes.dropFirst(2))
+            } else if bytes.starts(with: [0xFE, 0xFF]) {
+                endianness = .big
+                bytes = UnsafeBufferPointer(rebasing: bytes.dropFirst(2))
+            }
+        }
+        let units = bytes.count / 2
+        guard units > 0 else {
+            return ""
+        }
+        return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: units * 3) { buffer in
+            var length = 0
+            // Historically speaking, Foundation treats an unspecified encoding with no BOM as big endian
+            guard _transcodeshims_utf16_to_utf8(bytes.baseAddress!, units, endianness != .little, buffer.baseAddress!, &length) else {
+                return nil
+            }
+            // Unfortunately no way to skip the validation inside String at this time
+            return String._tryFromUTF8(UnsafeBufferPointer(rebasing: buffer[..<length]))
+        }
+    }
+
+    /// Creates a string from UTF-32 `bytes`, handling the byte order and BOM the same way as `UTF32EndianAdaptor`, or
+    /// returns `nil` if the bytes are not valid UTF-32. Trailing bytes that do not make up a whole code unit are ignored.
+    internal static func _fromUTF32(_ bytes: UnsafeBufferPointer<UInt8>, endianness: Endianness?) -> String? {
+        var bytes = bytes
+        var endianness = endianness
+        if endianness == nil {
+            if bytes.starts(with: [0xFF, 0xFE, 0x00, 0x00]) {
+                endianness = .little
+                bytes = UnsafeBufferPointer(rebasing: bytes.dropFirst(4))
+            } else if bytes.starts(with: [0x00, 0x00, 0xFE, 0xFF]) {
+                endianness = .big
+                bytes = UnsafeBufferPointer(rebasing: bytes.dropFirst(4))
+            }
+        }
+        let units = bytes.count / 4
+        guard units > 0 else {
+            return ""
+        }
+        return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: units * 4) { buffer in
+            var length = 0
+            guard _transcodeshims_utf32_to_utf8(bytes.baseAddress!, units, endianness != .little, buffer.baseAddress!, &length) else {
+                return nil
+            }
+            return String._tryFromUTF8(UnsafeBufferPointer(rebasing: buffer[..<length]))
+        }
+    }
+}
@@ -116,22 +116,8 @@ extension String {
         case .utf16BigEndian, .utf16LittleEndian, .utf16:
             // See also the package extension String?(_utf16:), which does something similar to this without the swapping of big/little.
             let e = Endianness(encoding)
-            let maybe = bytes.withContiguousStorageIfAvailable { buffer -> String? in
-                withUnsafeTemporaryAllocation(of: UTF8.CodeUnit.self, capacity: buffer.count * 3) { contents in
-                    let s = UTF16EndianAdaptor(buffer, endianness: e)
-                    var count = 0
-                    let error = transcode(s.makeIterator(), from: UTF16.self, to: UTF8.self, stoppingOnError: true) { codeUnit in
-                        contents[count] = codeUnit
-                        count += 1
-                    }
-                    
-                    guard !error else {
-                        return nil
-                    }
-                    
-                    // Unfortunately no way to skip the validation inside String at this time
-                    return String._tryFromUTF8(UnsafeBufferPointer(rebasing: contents[..<count]))
-                }
+            let maybe = bytes.withContiguousStorageIfAvailable { buffer in
+                String._fromUTF16(buffer, endianness: e)
             }
             
             if let maybe, let maybe {
@@ -143,22 +129,8 @@ extension String {
             }
         case .utf32BigEndian, .utf32LittleEndian, .utf32:
             let e = Endianness(encoding)
-            let maybe = bytes.withContiguousStorageIfAvailable { buffer -> String? in
-                withUnsafeTemporaryAllocation(of: UTF8.CodeUnit.self, capacity: buffer.count * 3) { contents in
-                    let s = UTF32EndianAdaptor(buffer, endianness: e)
-                    var count = 0
-                    let error = transcode(s.makeIterator(), from: UTF32.self, to: UTF8.self, stoppingOnError: true) { codeUnit in
-                        contents[count] = codeUnit
-                        count += 1
-                    }
-                    
-                    guard !error else {
-                        return nil
-                    }
-                    
-                    // Unfortunately no way to skip the validation inside String at this time
-                    return String._tryFromUTF8(UnsafeBufferPointer(rebasing: contents[..<count]))
-                }
+            let maybe = bytes.withContiguousStorageIfAvailable { buffer in
+                String._fromUTF32(buffer, endianness: e)
             }
             
             if let maybe, let maybe {
@@ -0,0 +1,187 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+internal import _FoundationCShims
+
+@available(FoundationPreview 6.5, *)
+extension String {
+    /// A search for one string with a fixed set of options, prepared once and reused for many searches.
+    ///
+    /// Searching with `range(of:options:)` examines the string to find and the options on every call. When the same
+    /// pattern is searched for in many strings, for example when filtering a log line by line, a `Searcher` does that
+    /// work once up front. A searcher is immutable, so it can be shared between threads.
+    ///
+    ///     let timeouts = String.Searcher(pattern: "connection timed out", options: .caseInsensitive)
+    ///     let matching = lines.filter { $0.contains(timeouts) }
+    public struct Searcher: Sendable {
+        /// The string to search for.
+        public let pattern: String
+
+        /// The options used for every search, from `caseInsensitive`, `diacriticInsensitive`, `widthInsensitive`,
+        /// `literal`, `anchored` and `backwards`.
+        public var options: String.CompareOptions {
+            search.options
+        }
+
+        let search: _StringSearch
+
+        /// Creates a searcher for the given string.
+        ///
+        /// - parameter pattern: The string to search for. A searcher for an empty string never finds a match.
+        /// - parameter options: The options for every search. Searchers do not support `regularExpression`.
+        public init(pattern: some StringProtocol, options: String.CompareOptions = []) {
+            precondition(!options.contains(.regularExpression), "String.Searcher does not support regular expressions")
+            self.pattern = String(pattern)
+            self.search = _StringSearch(pattern: self.pattern[...], options: options)
+        }
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension StringProtocol {
+    /// Finds and returns the range of the first occurrence of the pattern of the given searcher, or the last
+    /// occurrence if its options include `backwards`.
+    ///
+    /// - parameter searcher: The searcher for the string to find.
+    /// - parameter searchRange: The range of this string in which to search. Default value is `nil`, which means the
+    ///   entire string.
+    /// - returns: The range of the match, or `nil` if there is none.
+    public func range(of searcher: String.Searcher, range searchRange: Range<Index>? = nil) -> Range<Index>? {
+        var haystack = Substring(self)
+        if let searchRange {
+            haystack = haystack[searchRange]
+        }
+        return searcher.search.range(in: haystack)
+    }
+
+    /// Returns whether this string contains the pattern of the given searcher.
+    public func contains(_ searcher: String.Searcher) -> Bool {
+        range(of: searcher) != nil
+    }
+
+    /// Returns an array containing the substrings of this string that are separated by matches of the given searcher.
+    ///
+    /// The searcher's `anchored` and `backwards` options are not used.
+    public func components(separatedBy searcher: String.Searcher) -> [String] {
+        // Always search forward, for any match
+        let search = searcher.search.options.isDisjoint(with: [.anchored, .backwards]) ? searcher.search : _StringSearch(pattern: searcher.search.pattern, options: searcher.search.options.subtracting([.anchored, .backwards]))
+        var result = [String]()
+        var haystack = Substring(self)
+        while let range = search.range(in: haystack), !range.isEmpty {
+            result.append(String(haystack[..<range.lowerBound]))
+            haystack = haystack[range.upperBound...]
+        }
+        result.append(String(haystack))
+        return result
+    }
+}
+
+/// A pattern and search options, with the tables for the ASCII fast path prepared up front.
+struct _StringSearch: Sendable {
+    let pattern: Substring
+    let options: String.CompareOptions
+    let asciiShifts: _ASCIIShiftTable?
+
+    init(pattern: Substring, options: String.CompareOptions) {
+        self.pattern = pattern
+        self.options = options
+        self.asciiShifts = _ASCIIShiftTable(pattern: pattern, caseFold: options.contains(.caseInsensitive), backwards: options.contains(.backwards))
+    }
+
+    func range(in haystack: Substring) -> Range<Substring.Index>? {
+        haystack._range(of: pattern, options: options, asciiShifts: asciiShifts)
+    }
+}
+
+/// The Horspool shift table of an ASCII pattern, used in place of the vectorized search for long patterns.
+///
+/// The table maps each byte of the haystack that lines up with the last byte of the pattern (the first byte, when
+/// searching backwards) to how far the pattern can move without skipping a match. When folding case, both cases of a
+/// letter get the same shift.
+struct _ASCIIShiftTable: Sendable {
+    private let shifts: [Int]?
+    let backwards: Bool
+
+    /// Returns `nil` if `pattern` is not ASCII.
+    init?(pattern: Substring, caseFold: Bool, backwards: Bool) {
+        var utf8 = Array(pattern.utf8)
+        guard utf8.allSatisfy({ $0 < 0x80 }) else {
+            return nil
+        }
+        self.backwards = backwards
+
+        // Short patterns use the vectorized search, which has nothing to precompute.
+        guard utf8.count > Data._vectorSearchMaximumNeedleLength else {
+            shifts = nil
+            return
+        }
+
+        if caseFold {
+            utf8 = utf8.map(\._lowercased)
+        }
+        var shifts = [Int](repeating: utf8.count, count: 256)
+        func setShift(_ shift: Int, for byte: UInt8) {
+            shifts[Int(byte)] = shift
+            if caseFold {
+                shifts[Int(byte._uppercased)] = shift
+            }
+        }
+        if backwards {
+            // Later bytes first, so the smallest shift for a byte wins
+            for i in stride(from: utf8.count - 1, through: 1, by: -1) {
+                setShift(i, for: utf8[i])
+            }
+        } else {
+            for i in 0 ..< utf8.count - 1 {
+                setShift(utf8.count - 1 - i, for: utf8[i])
+            }
+        }
+        self.shifts = shifts
+    }
+
+    /// Returns the offset of the first occurrence of `needle` in `haystack` at or after `from`, `haystack.count` if
+    /// there is none, or `nil` if the caller should use the vectorized search instead.
+    func first(of needle: UnsafeBufferPointer<UInt8>, in haystack: UnsafeBufferPointer<UInt8>, from: Int, caseFold: Bool) -> Int? {
+        guard let shifts, !backwards else {
+            return nil
+        }
+        let lastOffset = needle.count - 1
+        let lastByte = caseFold ? needle[lastOffset]._lowercased : needle[lastOffset]
+        var position = from
+        while position + needle.count <= haystack.count {
+            let byte = haystack[position + lastOffset]
+            if (caseFold ? byte._lowercased : byte) == lastByte && _asciishims_common_prefix(haystack.baseAddress! + position, needle.baseAddress!, lastOffset, caseFold) == lastOffset {
+                return position
+            }
+            position += shifts[Int(byte)]
+        }
+        return haystack.count
+    }
+
+    /// Returns the offset of the last occurrence of `needle` in `haystack` that starts before `to`, `haystack.count`
+    /// if there is none, or `nil` if the caller should use the vectorized search instead.
+    func last(of needle: UnsafeBufferPointer<UInt8>, in haystack: UnsafeBufferPointer<UInt8>, before to: Int, caseFold: Bool) -> Int? {
+        guard let shifts, backwards else {
+            return nil
+        }
+        let firstByte = caseFold ? needle[0]._lowercased : needle[0]
+        var position = min(to - 1, haystack.count - needle.count)
+        while position >= 0 {
+            let byte = haystack[position]
+            if (caseFold ? byte._lowercased : byte) == firstByte && _asciishims_common_prefix(haystack.baseAddress! + position + 1, needle.baseAddress! + 1, needle.count - 1, caseFold) == needle.count - 1 {
+                return position
+            }
+            position -= shifts[Int(byte)]
+        }
+        return haystack.count
+    }
+}
@@ -9,6 +9,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+internal import _FoundationCShims
+
 extension String {
     struct _BlockSearchingOptions : OptionSet {
         let rawValue: Int
@@ -27,6 +29,15 @@ extension String {
         [0xE2, 0x80, 0xA8], // U+2028 Line Separator
         [0xC2, 0x85] // U+0085 <Next Line> (NEL)
     ]
+
+    // The code units that can start a separator, including "\r" and "\n", which are the only ones that can be found
+    // without checking the code units around them.
+    static let paragraphSeparatorLeadingBytes : [UTF8.CodeUnit] = [.newline, .carriageReturn, 0xE2]
+    static let lineSeparatorLeadingBytes : [UTF8.CodeUnit] = [.newline, .carriageReturn, 0xE2, 0xC2]
+
+    // The code units that can end a separator.
+    static let paragraphSeparatorTrailingBytes : [UTF8.CodeUnit] = [.newline, .carriageReturn, 0xA9]
+    static let lineSeparatorTrailingBytes : [UTF8.CodeUnit] = [.newline, .carriageReturn, 0xA9, 0xA8, 0x85]
 }
 
 struct _StringBlock<Index> {
@@ -91,6 +102,53 @@ extension BidirectionalCollection where Element == UTF8.CodeUnit {
         return nil
     }
 
+    /// Returns the first index at or after `start` whose code unit is in `bytes`, or `endIndex` if there is none.
+    /// Contiguous code units are scanned a vector at a time.
+    private func _firstIndex(ofAnyOf bytes: [UTF8.CodeUnit], from start: Index) -> Index {
+        guard start < endIndex else {
+            return endIndex
+        }
+        let found = withContiguousStorageIfAvailable { buffer in
+            let offset = distance(from: startIndex, to: start)
+            let found = bytes.withUnsafeBufferPointer { set in
+                _bytesearchshims_first_of(buffer.baseAddress! + offset, buffer.count - offset, set.baseAddress!, set.count)
+            }
+            return index(start, offsetBy: found)
+        }
+        return found ?? self[start...].firstIndex(where: bytes.contains) ?? endIndex
+    }
+
+    /// Returns the last index at or before `end` whose code unit is in `bytes`, or `nil` if there is none.
+    /// Contiguous code units are scanned a vector at a time.
+    private func _lastIndex(ofAnyOf bytes: [UTF8.CodeUnit], through end: Index) -> Index? {
+        let found = withContiguousStorageIfAvailable { buffer in
+            let length = distance(from: startIndex, to: end) + 1
+            let found = bytes.withUnsafeBufferPointer { set in
+                _bytesearchshims_last_of(buffer.baseAddress!, length, set.baseAddress!, set.count)
+            }
+            return found == length ? nil : index(startIndex, offsetBy: found)
+        }
+        return found ?? self[...end].lastIndex(where: bytes.contains)
+    }
+
+    /// Returns the range of the first separator that starts at or after `start`, or that ends just after it in the
+    /// case of "\r\n". The code units that cannot start a separator are skipped a vector at a time.
+    func _firstSeparator(from start: Index, stopAtLineSeparators: Bool) -> Range<Index>? {
+        let separators = stopAtLineSeparators ? String.lineSeparators : String.paragraphSeparators
+        let leadingBytes = stopAtLineSeparators ? String.lineSeparatorLeadingBytes : String.paragraphSeparatorLeadingBytes
+        var idx = start
+        while true {
+            idx = _firstIndex(ofAnyOf: leadingBytes, from: idx)
+            guard idx < endIndex else {
+                return nil
+            }
+            if let separatorR = _matchesSeparators(separators, from: idx) {
+                return separatorR
+            }
+            idx = index(after: idx)
+        }
+    }
+
     // Based on -[NSString _getBlockStart:end:contentsEnd:forRange:]
     func _getBlock(
         for options: String._BlockSearchingOptions,
@@ -115,7 +173,8 @@ extension BidirectionalCollection where Element == UTF8.CodeUnit {
         }
 
         let separatorCharacters = options.contains(.stopAtLineSeparators) ? String.lineSeparators : String.paragraphSeparators
-        
+        let separatorTrailingBytes = options.contains(.stopAtLineSeparators) ? String.lineSeparatorTrailingBytes : String.paragraphSeparatorTrailingBytes
+
         var start: Index? = nil
         if options.contains(.findStart) {
             if range.lowerBound == startIndex {
@@ -133,6 +192,12 @@ extension BidirectionalCollection where Element == UTF8.CodeUnit {
                 }
 
                 while start == nil, idx >= startIndex, idx < endIndex {
+                    // Only the code units that can end a separator need a closer look
+                    guard let candidate = _lastIndex(ofAnyOf: separatorTrailingBytes, through: idx) else {
+                        start = startIndex
+                        break
+                    }
+                    idx = candidate
                     if let _ = _matchesSeparators(separatorCharacters, from: idx, reverse: true) {
                         start = index(after: idx)
                         break
@@ -163,20 +228,12 @@ extension BidirectionalCollection where Element == UTF8.CodeUnit {
                 // When range.upperBound falls on the end of a multi-code-unit separator, walk backwards to find the start of the separator
                 end = separatorR.upperBound
                 contentsEnd = separatorR.lowerBound
+            } else if let separatorR = _firstSeparator(from: idx, stopAtLineSeparators: options.contains(.stopAtLineSeparators)) {
+                contentsEnd = separatorR.lowerBound
+                end = separatorR.upperBound
             } else {
-                while idx < endIndex {
-                    if let separatorR = _matchesSeparators(separatorCharacters, from: idx) {
-                        contentsEnd = separatorR.lowerBound
-                        end = separatorR.upperBound
-                        break
-                    }
-                    idx = index(after: idx)
-                }
-
-                if idx == endIndex {
-                    contentsEnd = idx
-                    end = idx
-                }
+                contentsEnd = endIndex
+                end = endIndex
             }
         }
 
@@ -206,3 +263,51 @@ extension Substring.UTF8View {
         return (result.start!, result.end!, result.contentsEnd!)
     }
 }
+
+@available(FoundationPreview 6.5, *)
+extension String {
+    /// A lazy sequence of the lines of a string.
+    ///
+    /// Lines end at "\n", "\r", "\r\n", U+0085 NEXT LINE, U+2028 LINE SEPARATOR and U+2029 PARAGRAPH SEPARATOR, like
+    /// in `lineRange(for:)`. Each line is a substring of the original string without its terminator, and a terminator
+    /// at the very end does not start another line. Nothing is copied, so iterating the lines of a large string, such
+    /// as a log file, takes no memory beyond the string itself.
+    ///
+    ///     for line in log.lines where line.hasPrefix("ERROR") {
+    ///         ...
+    ///     }
+    public struct LineSequence: Sequence, Sendable {
+        let base: Substring
+
+        public struct Iterator: IteratorProtocol {
+            let base: Substring
+            var position: Substring.Index
+
+            public mutating func next() -> Substring? {
+                let utf8 = base.utf8
+                guard position < utf8.endIndex else {
+                    return nil
+                }
+                let lineStart = position
+                if let separator = utf8._firstSeparator(from: position, stopAtLineSeparators: true) {
+                    position = separator.upperBound
+                    return base[lineStart ..< separator.lowerBound]
+                }
+                position = utf8.endIndex
+                return base[lineStart...]
+            }
+        }
+
+        public func makeIterator() -> Iterator {
+            Iterator(base: base, position: base.startIndex)
+        }
+    }
+}
+
+@available(FoundationPreview 6.5, *)
+extension StringProtocol {
+    /// The lines of the string, as a lazy sequence of substrings without their line terminators.
+    public var lines: String.LineSequence {
+        String.LineSequence(base: Substring(self))
+    }
+}
@@ -138,77 +138,56 @@ extension String {
                 return allASCII ? data : nil
             }
         case .utf16BigEndian, .utf16LittleEndian, .utf16:
-            let bom: UInt16?
-            let swap: Bool
-            
-            if encoding == .utf16 {
-                swap = false
-                bom = 0xFEFF
-            } else if encoding == .utf16BigEndian {
-#if _endian(little)
-                swap = true
-#else
-                swap = false
-#endif
-                bom = nil
-            } else if encoding == .utf16LittleEndian {
-#if _endian(little)
-                swap = false
-#else
-                swap = true
-#endif
-                bom = nil
-            } else {
-                fatalError("Unreachable")
-            }
+            // Plain .utf16 is written in host byte order, after a BOM
+            let endianness = Endianness(encoding) ?? .host
+            let hasBOM = encoding == .utf16
             
             // Grab this value once, as it requires doing a calculation over String's UTF8 storage
             let inputCount = self.utf16.count
             
             // The output may have 1 additional UTF16 character, if it has a BOM
-            let outputCount = bom == nil ? inputCount : inputCount + 1
+            let outputCount = hasBOM ? inputCount + 1 : inputCount
             
             // Allocate enough memory to hold the UTF16 bytes after conversion. We will pass this off to Data.
             let utf16Pointer = calloc(outputCount, MemoryLayout<UInt16>.size)!.assumingMemoryBound(to: UInt16.self)
             let utf16Buffer = UnsafeMutableBufferPointer<UInt16>(start: utf16Pointer, count: outputCount)
             
-            if let bom {
-                // Put the BOM in, then copy the UTF16 bytes to the buffer after it.
-                utf16Buffer[0] = bom
-                let afterBOMBuffer = UnsafeMutableBufferPointer(rebasing: utf16Buffer[1..<utf16Buffer.endIndex])
-                if self.isContiguousUTF8 {
-                    self._copyUTF16CodeUnits(into: afterBOMBuffer, range: 0..<inputCount)
-                } else {
-                    _ = afterBOMBuffer.initialize(fromContentsOf: self.utf16)
-                }
-            } else {
-                if self.isContiguousUTF8 {
-                    self._copyUTF16CodeUnits(into: utf16Buffer, range: 0..<inputCount)
-                } else {
-                    _ = utf16Buffer.initialize(fromContentsOf: self.utf16)
-                }
-            }            
+            if hasBOM {
+                utf16Buffer[0] = 0xFEFF
+            }
+            let afterBOMBuffer = UnsafeMutableBufferPointer(rebasing: utf16Buffer[(hasBOM ? 1 : 0)...])
             
-            // If we need to swap endianness, we do it as a second pass over the data
-            if swap {
-#if _endian(little)
-                // Swap, including the BOM if it is there
-                for u in utf16Buffer.enumerated() {
-                    utf16Buffer[u.0] = u.1.bigEndian
-                }
-#else
-                for u in utf16Buffer.enumerated() {
-                    utf16Buffer[u.0] = u.1.littleEndian
+            // Transcode straight from the UTF-8 storage into the requested byte order
+            let transcoded: Void? = self.utf8.withContiguousStorageIfAvailable { utf8 in
+                guard let source = utf8.baseAddress, let destination = afterBOMBuffer.baseAddress else { return }
+                _ = _transcodeshims_utf8_to_utf16(source, utf8.count, endianness == .big, UnsafeMutableRawPointer(destination).assumingMemoryBound(to: UInt8.self))
+            }
+            if transcoded == nil {
+                _ = afterBOMBuffer.initialize(fromContentsOf: self.utf16)
+                if endianness != .host {
+                    for i in afterBOMBuffer.indices {
+                        afterBOMBuffer[i] = afterBOMBuffer[i].byteSwapped
+                    }
                 }
-#endif
             }
             
             return Data(bytesNoCopy: utf16Buffer.baseAddress!, count: utf16Buffer.count * 2, deallocator: .free)
 
         case .utf32BigEndian, .utf32LittleEndian:
+            let endianness = Endianness(encoding)!
+            let transcoded = self.utf8.withContiguousStorageIfAvailable { utf8 -> Data in
+                guard let source = utf8.baseAddress else { return Data() }
+                return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: utf8.count * 4) { utf32Buffer in
+                    let count = _transcodeshims_utf8_to_utf32(source, utf8.count, endianness == .big, utf32Buffer.baseAddress!)
+                    return Data(bytes: utf32Buffer.baseAddress!, count: count)
+                }
+            }
+            if let transcoded {
+                return transcoded
+            }
             // This creates a contiguous storage for Data to simply memcpy.
             return withUnsafeTemporaryAllocation(of: UInt8.self, capacity: self.unicodeScalars.count * 4) { utf32Buffer in
-                _ = utf32Buffer.initialize(from: UnicodeScalarToDataAdaptor(self.unicodeScalars, endianness: Endianness(encoding)!))
+                _ = utf32Buffer.initialize(from: UnicodeScalarToDataAdaptor(self.unicodeScalars, endianness: endianness))
                 defer { utf32Buffer.deinitialize() }
                 return Data(utf32Buffer)
             }
@@ -43,8 +43,10 @@ internal func _timeZoneGMTClass() -> _TimeZoneProtocol.Type {
     _TimeZoneGMTICU.self
 }
 #else
+// FoundationInternationalization replaces this with its ICU time zone. Without it, named time zones come from the
+// time zone database.
 dynamic package func _timeZoneICUClass() -> _TimeZoneProtocol.Type? {
-    nil
+    _TimeZoneTZif.self
 }
 dynamic package func _timeZoneGMTClass() -> _TimeZoneProtocol.Type {
     _TimeZoneGMT.self
@@ -413,6 +415,10 @@ struct TimeZoneCache : Sendable, ~Copyable {
 
     let lock: Mutex<State>
 
+    // The values of `current` and `default`, read without taking `lock`. They are only published while holding `lock`, so they cannot overwrite a newer state.
+    private let _currentSnapshot = _PublishedSnapshot<TimeZone>()
+    private let _defaultSnapshot = _PublishedSnapshot<TimeZone>()
+
     static let cache = TimeZoneCache()
 
     fileprivate init() {
@@ -420,23 +426,44 @@ struct TimeZoneCache : Sendable, ~Copyable {
     }
 
     func reset() -> TimeZone? {
-        return lock.withLock { $0.reset() }
+        return lock.withLock {
+            _currentSnapshot.publish(nil)
+            _defaultSnapshot.publish(nil)
+            return $0.reset()
+        }
     }
     
     func resetCurrent(to newValue: TimeZone) {
-        return lock.withLock { $0.resetCurrent(to: newValue) }
+        return lock.withLock {
+            $0.resetCurrent(to: newValue)
+            _currentSnapshot.publish(nil)
+            _defaultSnapshot.publish(nil)
+        }
     }
 
     var current: TimeZone {
-        lock.withLock { $0.current() }
+        if let current = _currentSnapshot.value {
+            return current
+        }
+        return lock.withLock {
+            _currentSnapshot.publishIfAbsent($0.current())
+        }
     }
 
     var `default`: TimeZone {
-        lock.withLock { $0.default() }
+        if let defaultTimeZone = _defaultSnapshot.value {
+            return defaultTimeZone
+        }
+        return lock.withLock {
+            _defaultSnapshot.publishIfAbsent($0.default())
+        }
     }
 
     func setDefault(_ tz: TimeZone?) {
-        lock.withLock { $0.setDefaultTimeZone(tz) }
+        lock.withLock {
+            $0.setDefaultTimeZone(tz)
+            _defaultSnapshot.publish(nil)
+        }
 
         // Reset any 'current' locales, calendars, time zones
         LocaleNotifications.cache.reset()
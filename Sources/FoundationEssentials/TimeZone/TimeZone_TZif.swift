@@ -0,0 +1,877 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+internal import _FoundationCShims
+
+/// A time zone backed by the system's compiled time zone database (TZif files, RFC 8536) rather than ICU.
+///
+/// The zone's file under `TZDIR` is mapped and parsed once into sorted arrays of transition times and the offsets
+/// that follow them. The POSIX TZ rule at the end of the file, which describes the zone's transitions after the last
+/// one listed, is expanded into the same arrays through the end of 2100 and evaluated directly for later dates. Every
+/// lookup is a binary search of immutable storage, so no lock is taken.
+///
+/// When the database is not installed, as in minimal container images, a small table of the current rules of widely
+/// used zones stands in for it. Those zones have no history: dates before the current rules took effect get the
+/// current offsets too.
+package final class _TimeZoneTZif : _TimeZoneProtocol, Sendable {
+    let name: String
+    let zone: _TZifZone
+    private let fileData: Data?
+
+    required package init?(secondsFromGMT: Int) {
+        fatalError("Unexpected init")
+    }
+
+    required package init?(identifier: String) {
+        guard Self.isValidIdentifier(identifier) else {
+            return nil
+        }
+
+        if let data = Self.dataFromFile(identifier), let zone = data.withUnsafeBytes({ _TZifZone(tzif: $0) }) {
+            self.fileData = data
+            self.zone = zone
+        } else if let rule = Self.embeddedRules[identifier], let zone = _TZifZone(posixRule: rule) {
+            self.fileData = nil
+            self.zone = zone
+        } else {
+            return nil
+        }
+        self.name = identifier
+    }
+
+    /// Identifiers name a file relative to `TZDIR`, so they must not be able to reach outside of it.
+    private static func isValidIdentifier(_ identifier: String) -> Bool {
+        !identifier.isEmpty && !identifier.hasPrefix("/") && !identifier.contains("..") && !identifier.utf8.contains(0)
+    }
+
+    private static func dataFromFile(_ identifier: String) -> Data? {
+#if NO_TZFILE || os(Windows) || os(WASI) || os(Emscripten)
+        return nil
+#else
+        try? Data(contentsOf: TZDIR + "/" + identifier, options: .alwaysMapped, reportProgress: false)
+#endif
+    }
+
+    // MARK: -
+
+    package var identifier: String {
+        name
+    }
+
+    package var data: Data? {
+        fileData
+    }
+
+    package var fixedOffsetFromGMT: Int? {
+        zone.fixedOffset
+    }
+
+    package func secondsFromGMT(for date: Date) -> Int {
+        Int(zone.period(at: _TZifZone.seconds(date)).secondsFromGMT)
+    }
+
+    package func abbreviation(for date: Date) -> String? {
+        zone.abbreviation(of: zone.period(at: _TZifZone.seconds(date)))
+    }
+
+    package func isDaylightSavingTime(for date: Date) -> Bool {
+        zone.period(at: _TZifZone.seconds(date)).daylightSavingOffset != 0
+    }
+
+    package func daylightSavingTimeOffset(for date: Date) -> TimeInterval {
+        TimeInterval(zone.period(at: _TZifZone.seconds(date)).daylightSavingOffset)
+    }
+
+    package func rawAndDaylightSavingTimeOffset(for date: Date, repeatedTimePolicy: TimeZone.DaylightSavingTimePolicy = .former, skippedTimePolicy: TimeZone.DaylightSavingTimePolicy = .former) -> (rawOffset: Int, daylightSavingOffset: TimeInterval) {
+        let period = zone.period(atLocal: _TZifZone.seconds(date), repeatedTimePolicy: repeatedTimePolicy, skippedTimePolicy: skippedTimePolicy)
+        return (Int(period.secondsFromGMT - period.daylightSavingOffset), TimeInterval(period.daylightSavingOffset))
+    }
+
+    package func nextDaylightSavingTimeTransition(after date: Date) -> Date? {
+        guard let next = zone.nextTransition(after: _TZifZone.seconds(date)) else {
+            return nil
+        }
+        let result = Date(timeIntervalSince1970: TimeInterval(next))
+        guard result < Date.validCalendarRange.upperBound else {
+            return nil
+        }
+        return result
+    }
+
+    package func localizedName(for style: TimeZone.NameStyle, locale: Locale?) -> String? {
+        // Localized names come from ICU
+        nil
+    }
+
+    // MARK: -
+
+    /// The rules in effect today for widely used zones, as POSIX TZ strings, for systems without a time zone database.
+    static let embeddedRules: [String: String] = [
+        "Africa/Addis_Ababa": "EAT-3",
+        "Africa/Cairo": "EET-2EEST,M4.5.5/0,M10.5.4/24",
+        "Africa/Harare": "CAT-2",
+        "Africa/Johannesburg": "SAST-2",
+        "Africa/Lagos": "WAT-1",
+        "Africa/Nairobi": "EAT-3",
+        "America/Anchorage": "AKST9AKDT,M3.2.0,M11.1.0",
+        "America/Argentina/Buenos_Aires": "<-03>3",
+        "America/Bogota": "<-05>5",
+        "America/Chicago": "CST6CDT,M3.2.0,M11.1.0",
+        "America/Denver": "MST7MDT,M3.2.0,M11.1.0",
+        "America/Halifax": "AST4ADT,M3.2.0,M11.1.0",
+        "America/Juneau": "AKST9AKDT,M3.2.0,M11.1.0",
+        "America/Lima": "<-05>5",
+        "America/Los_Angeles": "PST8PDT,M3.2.0,M11.1.0",
+        "America/Mexico_City": "CST6",
+        "America/New_York": "EST5EDT,M3.2.0,M11.1.0",
+        "America/Phoenix": "MST7",
+        "America/Santiago": "<-04>4<-03>,M9.1.6/24,M4.1.6/24",
+        "America/Sao_Paulo": "<-03>3",
+        "America/St_Johns": "NST3:30NDT,M3.2.0,M11.1.0",
+        "America/Toronto": "EST5EDT,M3.2.0,M11.1.0",
+        "America/Vancouver": "PST8PDT,M3.2.0,M11.1.0",
+        "Asia/Bangkok": "<+07>-7",
+        "Asia/Dhaka": "<+06>-6",
+        "Asia/Dubai": "<+04>-4",
+        "Asia/Hong_Kong": "HKT-8",
+        "Asia/Jakarta": "WIB-7",
+        "Asia/Jerusalem": "IST-2IDT,M3.4.4/26,M10.5.0",
+        "Asia/Karachi": "PKT-5",
+        "Asia/Kolkata": "IST-5:30",
+        "Asia/Manila": "PST-8",
+        "Asia/Seoul": "KST-9",
+        "Asia/Shanghai": "CST-8",
+        "Asia/Singapore": "<+08>-8",
+        "Asia/Taipei": "CST-8",
+        "Asia/Tehran": "<+0330>-3:30",
+        "Asia/Tokyo": "JST-9",
+        "Australia/Adelaide": "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
+        "Australia/Brisbane": "AEST-10",
+        "Australia/Melbourne": "AEST-10AEDT,M10.1.0,M4.1.0/3",
+        "Australia/Perth": "AWST-8",
+        "Australia/Sydney": "AEST-10AEDT,M10.1.0,M4.1.0/3",
+        "Etc/UTC": "UTC0",
+        "Europe/Amsterdam": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Athens": "EET-2EEST,M3.5.0/3,M10.5.0/4",
+        "Europe/Berlin": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Brussels": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Dublin": "IST-1GMT0,M10.5.0,M3.5.0/1",
+        "Europe/Helsinki": "EET-2EEST,M3.5.0/3,M10.5.0/4",
+        "Europe/Istanbul": "<+03>-3",
+        "Europe/Kyiv": "EET-2EEST,M3.5.0/3,M10.5.0/4",
+        "Europe/Lisbon": "WET0WEST,M3.5.0/1,M10.5.0",
+        "Europe/London": "GMT0BST,M3.5.0/1,M10.5.0",
+        "Europe/Madrid": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Moscow": "MSK-3",
+        "Europe/Paris": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Rome": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Stockholm": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Warsaw": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Europe/Zurich": "CET-1CEST,M3.5.0,M10.5.0/3",
+        "Pacific/Auckland": "NZST-12NZDT,M9.5.0,M4.1.0/3",
+        "Pacific/Honolulu": "HST10",
+    ]
+}
+
+// MARK: - Zone data
+
+/// The offsets of a time zone over time: the transitions listed in its TZif file, followed by those of its POSIX TZ
+/// rule.
+struct _TZifZone : Sendable {
+    /// The offsets in effect between two transitions.
+    struct Period : Sendable, Equatable {
+        var secondsFromGMT: Int32
+        /// The part of `secondsFromGMT` due to daylight saving time, zero in standard time.
+        var daylightSavingOffset: Int32
+        /// An index into `abbreviations`.
+        var abbreviation: UInt16
+
+        func hasSameOffsets(as other: Period) -> Bool {
+            secondsFromGMT == other.secondsFromGMT && daylightSavingOffset == other.daylightSavingOffset
+        }
+    }
+
+    /// Transition times in seconds since 1970, in ascending order.
+    let transitions: [Int64]
+    /// The period before each transition, followed by the period after the last one, so `periods[i]` is in effect
+    /// from `transitions[i - 1]` until `transitions[i]`.
+    let periods: [Period]
+    let abbreviations: [String]
+
+    /// The rule for transitions after `ruleStart`, if the zone still observes daylight saving time, and the periods
+    /// it alternates between.
+    let rule: _POSIXTimeZoneRule?
+    private let rulePeriods: (standard: Period, daylightSaving: Period)?
+    /// The first time that `transitions` and `periods` do not cover, `Int64.max` if they cover all time.
+    let ruleStart: Int64
+
+    /// Rule transitions are tabulated through the end of this year and computed when needed after that.
+    static let lastTabulatedYear = 2100
+
+    /// Parses the contents of a TZif file.
+    init?(tzif bytes: UnsafeRawBufferPointer) {
+        var reader = _TZifReader(bytes)
+        guard var header = reader.readHeader() else {
+            return nil
+        }
+        var timeSize = 4
+        if header.version >= UInt8(ascii: "2") {
+            // Skip the version 1 data, which only has 32-bit times, for the 64-bit data that follows it
+            guard reader.skip(header.dataSize(timeSize: 4)), let header64 = reader.readHeader() else {
+                return nil
+            }
+            header = header64
+            timeSize = 8
+        }
+        // Check the counts against the data that is actually there before reserving space for them
+        guard reader.remainingCount >= header.dataSize(timeSize: timeSize) else {
+            return nil
+        }
+
+        var transitions = [Int64]()
+        transitions.reserveCapacity(header.transitionCount)
+        for _ in 0 ..< header.transitionCount {
+            guard let time = timeSize == 8 ? reader.read(Int64.self) : reader.read(Int32.self).map(Int64.init) else {
+                return nil
+            }
+            guard transitions.last.map({ $0 < time }) ?? true else {
+                // Transitions must be in ascending order
+                return nil
+            }
+            transitions.append(time)
+        }
+        var transitionTypes = [Int]()
+        transitionTypes.reserveCapacity(header.transitionCount)
+        for _ in 0 ..< header.transitionCount {
+            guard let type = reader.read(UInt8.self), Int(type) < header.typeCount else {
+                return nil
+            }
+            transitionTypes.append(Int(type))
+        }
+        var types = [(secondsFromGMT: Int32, isDaylightSavingTime: Bool, abbreviationIndex: Int)]()
+        for _ in 0 ..< header.typeCount {
+            guard let offset = reader.read(Int32.self), offset != Int32.min, let isDST = reader.read(UInt8.self), let abbreviationIndex = reader.read(UInt8.self), Int(abbreviationIndex) < header.abbreviationByteCount else {
+                return nil
+            }
+            types.append((offset, isDST != 0, Int(abbreviationIndex)))
+        }
+        guard let abbreviationBytes = reader.read(count: header.abbreviationByteCount) else {
+            return nil
+        }
+
+        // Leap second records only appear in the "right/" variants of zones. Like the POSIX functions, we ignore
+        // them; the standard/wall and UT/local indicators only matter for the rules of the "posixrules" file.
+        guard reader.skip(header.leapCount * (timeSize + 4) + header.standardIndicatorCount + header.utIndicatorCount) else {
+            return nil
+        }
+
+        var rule: _POSIXTimeZoneRule?
+        if timeSize == 8 {
+            // The footer is the POSIX TZ string between two newlines, which is empty if it cannot express the rule
+            guard reader.read(UInt8.self) == UInt8(ascii: "\n"), let footer = reader.readLine() else {
+                return nil
+            }
+            if !footer.isEmpty {
+                guard let parsed = _POSIXTimeZoneRule(footer) else {
+                    return nil
+                }
+                rule = parsed
+            }
+        }
+
+        var abbreviations = [String]()
+        let typeAbbreviations = types.map { type in
+            let bytes = abbreviationBytes[type.abbreviationIndex...].prefix { $0 != 0 }
+            return Self.index(of: String(decoding: bytes, as: UTF8.self), in: &abbreviations)
+        }
+
+        // Times before the first transition use the first type
+        let periodTypes = [0] + transitionTypes
+        var periods = periodTypes.map { Period(secondsFromGMT: types[$0].secondsFromGMT, daylightSavingOffset: 0, abbreviation: typeAbbreviations[$0]) }
+
+        // TZif only records whether each period is daylight saving time, so measure its savings against the
+        // standard time before it, or after it for daylight saving time at the start of the zone's history
+        var standardOffset = periodTypes.first { !types[$0].isDaylightSavingTime }.map { types[$0].secondsFromGMT }
+        for (i, type) in periodTypes.enumerated() {
+            if types[type].isDaylightSavingTime {
+                let savings = standardOffset.map { periods[i].secondsFromGMT - $0 } ?? 3600
+                // A period marked as daylight saving time always has some savings
+                periods[i].daylightSavingOffset = savings != 0 ? savings : 3600
+            } else {
+                standardOffset = types[type].secondsFromGMT
+            }
+        }
+        // Some zones, like Europe/Dublin, mark winter time as daylight saving time with negative savings. Like ICU,
+        // treat it as standard time, and the summer time around it as daylight saving time with positive savings.
+        for i in periods.indices where periods[i].daylightSavingOffset < 0 {
+            let savings = -periods[i].daylightSavingOffset
+            periods[i].daylightSavingOffset = 0
+            for j in [i - 1, i + 1] where periods.indices.contains(j) && periods[j].daylightSavingOffset == 0 && periods[j].secondsFromGMT == periods[i].secondsFromGMT + savings {
+                periods[j].daylightSavingOffset = savings
+            }
+        }
+
+        self.init(transitions: transitions, periods: periods, abbreviations: abbreviations, rule: rule)
+    }
+
+    /// Creates a zone with no history, whose offsets all come from a POSIX TZ string.
+    init?(posixRule: String) {
+        guard let rule = _POSIXTimeZoneRule(posixRule[...].utf8) else {
+            return nil
+        }
+        if let constant = rule.constantOffsets {
+            self.init(transitions: [], periods: [Period(secondsFromGMT: constant.secondsFromGMT, daylightSavingOffset: constant.daylightSavingOffset, abbreviation: 0)], abbreviations: [constant.abbreviation], rule: rule)
+        } else {
+            // The period before the first transition comes from the rule
+            self.init(transitions: [], periods: [], abbreviations: [], rule: rule)
+        }
+    }
+
+    private init(transitions: [Int64], periods: [Period], abbreviations: [String], rule: _POSIXTimeZoneRule?) {
+        var transitions = transitions
+        var periods = periods
+        var abbreviations = abbreviations
+
+        guard let rule, let daylight = rule.daylight, rule.constantOffsets == nil else {
+            if let constant = rule?.constantOffsets {
+                // The offsets never change after the last transition. If the file ends in a period the rule
+                // disagrees with, the rule wins from the last transition on.
+                let last = periods[periods.count - 1]
+                if last.secondsFromGMT != constant.secondsFromGMT || last.daylightSavingOffset != constant.daylightSavingOffset || abbreviations[Int(last.abbreviation)] != constant.abbreviation {
+                    periods[periods.count - 1] = Period(secondsFromGMT: constant.secondsFromGMT, daylightSavingOffset: constant.daylightSavingOffset, abbreviation: Self.index(of: constant.abbreviation, in: &abbreviations))
+                }
+            }
+            self.transitions = transitions
+            self.periods = periods
+            self.abbreviations = abbreviations
+            self.rule = nil
+            self.rulePeriods = nil
+            self.ruleStart = Int64.max
+            return
+        }
+
+        // Tabulate the rule's transitions after the last listed one. With negative savings, as in Europe/Dublin's
+        // `IST-1GMT0,M10.5.0,M3.5.0/1`, the rule's daylight saving time is reported as standard time and its
+        // standard time as daylight saving time.
+        let savings = daylight.offset - rule.standardOffset
+        let standard = Period(secondsFromGMT: rule.standardOffset, daylightSavingOffset: savings < 0 ? -savings : 0, abbreviation: Self.index(of: rule.standardAbbreviation, in: &abbreviations))
+        let daylightSaving = Period(secondsFromGMT: daylight.offset, daylightSavingOffset: savings < 0 ? 0 : savings, abbreviation: Self.index(of: daylight.abbreviation, in: &abbreviations))
+        let firstYear = transitions.last.map { Swift.min(Self.year(containing: $0), Self.lastTabulatedYear) } ?? 1970
+        for year in firstYear ... Self.lastTabulatedYear {
+            for (time, isStart) in rule.transitions(in: year) where transitions.last.map({ $0 < time }) ?? true {
+                transitions.append(time)
+                periods.append(isStart ? daylightSaving : standard)
+            }
+        }
+        if periods.count == transitions.count {
+            // A zone with no history starts out in the state before its first transition
+            periods.insert(periods[0] == daylightSaving ? standard : daylightSaving, at: 0)
+        }
+
+        self.transitions = transitions
+        self.periods = periods
+        self.abbreviations = abbreviations
+        self.rule = rule
+        self.rulePeriods = (standard, daylightSaving)
+        self.ruleStart = _CalendarUtility.daysSince1970(year: Int64(Self.lastTabulatedYear), month: 1, day: 1) * 86400
+    }
+
+    /// The proleptic Gregorian year containing `time`, in seconds since 1970.
+    private static func year(containing time: Int64) -> Int {
+        Int(_CalendarUtility.civilDate(daysSince1970: _CalendarUtility.floorDiv(time, 86400)).year)
+    }
+
+    private static func index(of abbreviation: String, in abbreviations: inout [String]) -> UInt16 {
+        if let index = abbreviations.firstIndex(of: abbreviation) {
+            return UInt16(index)
+        }
+        abbreviations.append(abbreviation)
+        return UInt16(abbreviations.count - 1)
+    }
+
+    /// Whole seconds since 1970, clamped to a range where adding an offset cannot overflow.
+    static func seconds(_ date: Date) -> Int64 {
+        let seconds = date.timeIntervalSince1970.rounded(.down)
+        guard seconds > -0x1p62 else {
+            return -(1 << 62)
+        }
+        guard seconds < 0x1p62 else {
+            return 1 << 62
+        }
+        return Int64(seconds)
+    }
+
+    // MARK: - Lookups
+
+    /// The offset if it has never changed and never will, `nil` otherwise.
+    var fixedOffset: Int? {
+        guard rule == nil, periods.allSatisfy({ $0.hasSameOffsets(as: periods[0]) }) else {
+            return nil
+        }
+        return Int(periods[0].secondsFromGMT)
+    }
+
+    func abbreviation(of period: Period) -> String {
+        abbreviations[Int(period.abbreviation)]
+    }
+
+    private var table: _TZifTransitions {
+        _TZifTransitions(times: transitions, periods: periods)
+    }
+
+    /// The period in effect at `time`, in seconds since 1970.
+    func period(at time: Int64) -> Period {
+        guard time < ruleStart else {
+            return ruleTransitions(near: time).period(at: time)
+        }
+        return table.period(at: time)
+    }
+
+    /// The period in effect at the local time `localTime`, in seconds since 1970 as if the zone were GMT.
+    func period(atLocal localTime: Int64, repeatedTimePolicy: TimeZone.DaylightSavingTimePolicy, skippedTimePolicy: TimeZone.DaylightSavingTimePolicy) -> Period {
+        // Local time is less than a day away from GMT, so the table has every transition near local times a day
+        // before `ruleStart`
+        guard localTime < ruleStart - 86400 else {
+            return ruleTransitions(near: localTime).period(atLocal: localTime, repeatedTimePolicy: repeatedTimePolicy, skippedTimePolicy: skippedTimePolicy)
+        }
+        return table.period(atLocal: localTime, repeatedTimePolicy: repeatedTimePolicy, skippedTimePolicy: skippedTimePolicy)
+    }
+
+    /// The first time after `time` at which the offsets change.
+    func nextTransition(after time: Int64) -> Int64? {
+        if let next = table.nextTransition(after: time) {
+            return next
+        }
+        guard rule != nil else {
+            return nil
+        }
+        // The table runs through the end of `lastTabulatedYear`, so `time` is after that, and the rule has a
+        // transition in the year after `time` at the latest
+        return ruleTransitions(near: time).nextTransition(after: time)
+    }
+
+    /// The rule's transitions from the year before the one containing `time` through the year after it.
+    private func ruleTransitions(near time: Int64) -> _TZifTransitions {
+        let rule = rule!
+        let (standard, daylightSaving) = rulePeriods!
+        let year = Self.year(containing: time)
+
+        var yearTransitions = [(time: Int64, isStart: Bool)]()
+        for year in year - 1 ... year + 1 {
+            yearTransitions += rule.transitions(in: year)
+        }
+        var times = [Int64]()
+        var periods = [yearTransitions[0].isStart ? standard : daylightSaving]
+        for (time, isStart) in yearTransitions where times.last.map({ $0 < time }) ?? true {
+            times.append(time)
+            periods.append(isStart ? daylightSaving : standard)
+        }
+        return _TZifTransitions(times: times, periods: periods)
+    }
+}
+
+/// A view of transition times and the periods between them, used for both the zone's table and rule transitions
+/// computed on the fly.
+private struct _TZifTransitions {
+    let times: [Int64]
+    let periods: [_TZifZone.Period]
+
+    func period(at time: Int64) -> _TZifZone.Period {
+        // The number of transitions at or before `time`
+        var low = 0
+        var high = times.count
+        while low < high {
+            let mid = (low + high) / 2
+            if times[mid] <= time {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return periods[low]
+    }
+
+    func period(atLocal localTime: Int64, repeatedTimePolicy: TimeZone.DaylightSavingTimePolicy, skippedTimePolicy: TimeZone.DaylightSavingTimePolicy) -> _TZifZone.Period {
+        // Each transition happens at a local time, read on the clock before or after it as the policies choose. Local
+        // times skipped by a transition take the period before it for `.former` and the one after it for `.latter`,
+        // and so do local times that a transition repeats.
+        func localTransition(_ i: Int) -> Int64 {
+            let before = Int64(periods[i].secondsFromGMT)
+            let after = Int64(periods[i + 1].secondsFromGMT)
+            if after >= before {
+                return times[i] + (skippedTimePolicy == .former ? after : before)
+            } else {
+                return times[i] + (repeatedTimePolicy == .former ? before : after)
+            }
+        }
+        var low = 0
+        var high = times.count
+        while low < high {
+            let mid = (low + high) / 2
+            if localTransition(mid) <= localTime {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return periods[low]
+    }
+
+    func nextTransition(after time: Int64) -> Int64? {
+        var low = 0
+        var high = times.count
+        while low < high {
+            let mid = (low + high) / 2
+            if times[mid] <= time {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        // Skip transitions that only change the abbreviation
+        for i in low ..< times.count where !periods[i].hasSameOffsets(as: periods[i + 1]) {
+            return times[i]
+        }
+        return nil
+    }
+}
+
+// MARK: - POSIX TZ rules
+
+/// A time zone rule in the format of the POSIX `TZ` environment variable, such as `PST8PDT,M3.2.0,M11.1.0`, with the
+/// extensions of RFC 8536 for TZif footers.
+struct _POSIXTimeZoneRule : Sendable, Equatable {
+    /// The day and local time of a transition in any year.
+    struct Transition : Sendable, Equatable {
+        enum Day : Sendable, Equatable {
+            /// `Jn`: day 1 through 365, not counting February 29.
+            case julian(Int)
+            /// `n`: day 0 through 365, counting February 29.
+            case zeroBased(Int)
+            /// `Mm.w.d`: weekday `d` (0 is Sunday) of week `w` of month `m`, where week 5 is the last one.
+            case monthWeekday(month: Int, week: Int, weekday: Int)
+        }
+
+        var day: Day
+        /// Seconds since the local midnight that starts `day`, which may be negative or more than a day.
+        var time: Int64
+
+        /// The day of the transition in `year`, in days since 1970.
+        func daysSince1970(in year: Int) -> Int64 {
+            switch day {
+            case .julian(let day):
+                let leapDay: Int64 = day >= 60 && _CalendarGregorian.isLeapYear(year) ? 1 : 0
+                return _CalendarUtility.daysSince1970(year: Int64(year), month: 1, day: 1) + Int64(day - 1) + leapDay
+            case .zeroBased(let day):
+                return _CalendarUtility.daysSince1970(year: Int64(year), month: 1, day: 1) + Int64(day)
+            case .monthWeekday(let month, let week, let weekday):
+                let first = _CalendarUtility.daysSince1970(year: Int64(year), month: Int64(month), day: 1)
+                // January 1, 1970 was a Thursday
+                let firstWeekday = first + 4 - _CalendarUtility.floorDiv(first + 4, 7) * 7
+                var result = first + (Int64(weekday) - firstWeekday + 7) % 7 + Int64(week - 1) * 7
+                let nextMonth = month == 12 ? _CalendarUtility.daysSince1970(year: Int64(year + 1), month: 1, day: 1) : _CalendarUtility.daysSince1970(year: Int64(year), month: Int64(month + 1), day: 1)
+                while result >= nextMonth {
+                    result -= 7
+                }
+                return result
+            }
+        }
+    }
+
+    struct DaylightSavingTime : Sendable, Equatable {
+        var abbreviation: String
+        /// Seconds east of GMT.
+        var offset: Int32
+        var start: Transition
+        var end: Transition
+    }
+
+    var standardAbbreviation: String
+    /// Seconds east of GMT, the opposite sign of the POSIX string.
+    var standardOffset: Int32
+    var daylight: DaylightSavingTime?
+
+    init?(_ string: Substring.UTF8View) {
+        var parser = _POSIXTimeZoneRuleParser(bytes: Array(string))
+        guard let rule = parser.parse() else {
+            return nil
+        }
+        self = rule
+    }
+
+    init(standardAbbreviation: String, standardOffset: Int32, daylight: DaylightSavingTime?) {
+        self.standardAbbreviation = standardAbbreviation
+        self.standardOffset = standardOffset
+        self.daylight = daylight
+    }
+
+    /// The offsets of a rule without transitions: standard time if it has no daylight saving time, or daylight saving
+    /// time all year, which RFC 8536 writes as starting on January 1 at 00:00 and ending on December 31 at 24:00 plus
+    /// the savings, for example `EST5EDT,0/0,J365/25`.
+    var constantOffsets: (secondsFromGMT: Int32, daylightSavingOffset: Int32, abbreviation: String)? {
+        guard let daylight else {
+            return (standardOffset, 0, standardAbbreviation)
+        }
+        let savings = daylight.offset - standardOffset
+        guard daylight.start == Transition(day: .zeroBased(0), time: 0), daylight.end == Transition(day: .julian(365), time: 86400 + Int64(savings)) else {
+            return nil
+        }
+        return (daylight.offset, savings, daylight.abbreviation)
+    }
+
+    /// The daylight saving time transitions in `year`, in seconds since 1970, in ascending order. `isStart` is true
+    /// for the transition to daylight saving time.
+    func transitions(in year: Int) -> [(time: Int64, isStart: Bool)] {
+        guard let daylight else {
+            return []
+        }
+        // The start is given in standard time, and the end in daylight saving time
+        let start = daylight.start.daysSince1970(in: year) * 86400 + daylight.start.time - Int64(standardOffset)
+        let end = daylight.end.daysSince1970(in: year) * 86400 + daylight.end.time - Int64(daylight.offset)
+        // In the southern hemisphere, daylight saving time ends earlier in the year than it starts
+        return start < end ? [(start, true), (end, false)] : [(end, false), (start, true)]
+    }
+}
+
+private struct _POSIXTimeZoneRuleParser {
+    let bytes: [UInt8]
+    var index = 0
+
+    init(bytes: [UInt8]) {
+        self.bytes = bytes
+    }
+
+    private var current: UInt8? {
+        index < bytes.count ? bytes[index] : nil
+    }
+
+    private mutating func consume(_ byte: UInt8) -> Bool {
+        guard current == byte else {
+            return false
+        }
+        index += 1
+        return true
+    }
+
+    mutating func parse() -> _POSIXTimeZoneRule? {
+        guard let standardAbbreviation = abbreviation(), let standardOffset = offset(maximumHours: 24) else {
+            return nil
+        }
+        guard current != nil else {
+            return _POSIXTimeZoneRule(standardAbbreviation: standardAbbreviation, standardOffset: standardOffset, daylight: nil)
+        }
+
+        guard let daylightAbbreviation = abbreviation() else {
+            return nil
+        }
+        var daylightOffset = standardOffset + 3600
+        if current != UInt8(ascii: ","), current != nil {
+            guard let parsedOffset = offset(maximumHours: 24) else {
+                return nil
+            }
+            daylightOffset = parsedOffset
+        }
+
+        let start: _POSIXTimeZoneRule.Transition
+        let end: _POSIXTimeZoneRule.Transition
+        if consume(UInt8(ascii: ",")) {
+            guard let parsedStart = transition(), consume(UInt8(ascii: ",")), let parsedEnd = transition() else {
+                return nil
+            }
+            start = parsedStart
+            end = parsedEnd
+        } else {
+            // POSIX leaves the rule up to the implementation when it is missing. Like tzcode, use the US rules.
+            start = .init(day: .monthWeekday(month: 3, week: 2, weekday: 0), time: 7200)
+            end = .init(day: .monthWeekday(month: 11, week: 1, weekday: 0), time: 7200)
+        }
+        guard current == nil else {
+            return nil
+        }
+        return _POSIXTimeZoneRule(standardAbbreviation: standardAbbreviation, standardOffset: standardOffset, daylight: .init(abbreviation: daylightAbbreviation, offset: daylightOffset, start: start, end: end))
+    }
+
+    /// Either at least three letters, or `<`, at least three letters, digits and signs, and `>`.
+    private mutating func abbreviation() -> String? {
+        let quoted = consume(UInt8(ascii: "<"))
+        let start = index
+        while let byte = current, (UInt8(ascii: "A") ... UInt8(ascii: "Z")).contains(byte) || (UInt8(ascii: "a") ... UInt8(ascii: "z")).contains(byte) || (quoted && (isASCIIDigit(byte) || byte == UInt8(ascii: "+") || byte == UInt8(ascii: "-"))) {
+            index += 1
+        }
+        let end = index
+        guard end - start >= 3, !quoted || consume(UInt8(ascii: ">")) else {
+            return nil
+        }
+        return String(decoding: bytes[start ..< end], as: UTF8.self)
+    }
+
+    /// An offset in the POSIX sense, hours west of GMT, returned in seconds east of GMT.
+    private mutating func offset(maximumHours: Int64) -> Int32? {
+        guard let time = time(maximumHours: maximumHours) else {
+            return nil
+        }
+        return Int32(-time)
+    }
+
+    /// `[+|-]hh[:mm[:ss]]`, in seconds.
+    private mutating func time(maximumHours: Int64) -> Int64? {
+        var sign: Int64 = 1
+        if consume(UInt8(ascii: "-")) {
+            sign = -1
+        } else {
+            _ = consume(UInt8(ascii: "+"))
+        }
+        guard let hours = number(maximumDigits: 3), hours <= maximumHours else {
+            return nil
+        }
+        var seconds = hours * 3600
+        if consume(UInt8(ascii: ":")) {
+            guard let minutes = number(maximumDigits: 2), minutes < 60 else {
+                return nil
+            }
+            seconds += minutes * 60
+            if consume(UInt8(ascii: ":")) {
+                guard let secondsPart = number(maximumDigits: 2), secondsPart < 60 else {
+                    return nil
+                }
+                seconds += secondsPart
+            }
+        }
+        return sign * seconds
+    }
+
+    private mutating func number(maximumDigits: Int) -> Int64? {
+        var result: Int64 = 0
+        var digits = 0
+        while let byte = current, isASCIIDigit(byte), digits < maximumDigits {
+            result = result * 10 + Int64(byte - UInt8(ascii: "0"))
+            digits += 1
+            index += 1
+        }
+        return digits > 0 ? result : nil
+    }
+
+    /// `Jn`, `n` or `Mm.w.d`, optionally followed by `/time`.
+    private mutating func transition() -> _POSIXTimeZoneRule.Transition? {
+        let day: _POSIXTimeZoneRule.Transition.Day
+        if consume(UInt8(ascii: "J")) {
+            guard let n = number(maximumDigits: 3), (1 ... 365).contains(n) else {
+                return nil
+            }
+            day = .julian(Int(n))
+        } else if consume(UInt8(ascii: "M")) {
+            guard let month = number(maximumDigits: 2), (1 ... 12).contains(month), consume(UInt8(ascii: ".")),
+                  let week = number(maximumDigits: 1), (1 ... 5).contains(week), consume(UInt8(ascii: ".")),
+                  let weekday = number(maximumDigits: 1), (0 ... 6).contains(weekday) else {
+                return nil
+            }
+            day = .monthWeekday(month: Int(month), week: Int(week), weekday: Int(weekday))
+        } else {
+            guard let n = number(maximumDigits: 3), (0 ... 365).contains(n) else {
+                return nil
+            }
+            day = .zeroBased(Int(n))
+        }
+
+        var time: Int64 = 7200
+        if consume(UInt8(ascii: "/")) {
+            // RFC 8536 allows hours from -167 to 167
+            guard let parsed = self.time(maximumHours: 167) else {
+                return nil
+            }
+            time = parsed
+        }
+        return .init(day: day, time: time)
+    }
+}
+
+// MARK: - TZif reading
+
+private struct _TZifReader {
+    struct Header {
+        var version: UInt8
+        var utIndicatorCount: Int
+        var standardIndicatorCount: Int
+        var leapCount: Int
+        var transitionCount: Int
+        var typeCount: Int
+        var abbreviationByteCount: Int
+
+        /// The size of the data block that follows the header.
+        func dataSize(timeSize: Int) -> Int {
+            transitionCount * (timeSize + 1) + typeCount * 6 + abbreviationByteCount + leapCount * (timeSize + 4) + standardIndicatorCount + utIndicatorCount
+        }
+    }
+
+    let bytes: UnsafeRawBufferPointer
+    var offset = 0
+
+    init(_ bytes: UnsafeRawBufferPointer) {
+        self.bytes = bytes
+    }
+
+    mutating func read<T: FixedWidthInteger>(_ type: T.Type) -> T? {
+        guard bytes.count - offset >= MemoryLayout<T>.size else {
+            return nil
+        }
+        let value = bytes.loadUnaligned(fromByteOffset: offset, as: T.self)
+        offset += MemoryLayout<T>.size
+        return T(bigEndian: value)
+    }
+
+    mutating func read(count: Int) -> [UInt8]? {
+        guard bytes.count - offset >= count else {
+            return nil
+        }
+        defer { offset += count }
+        return Array(bytes[offset ..< offset + count])
+    }
+
+    var remainingCount: Int {
+        bytes.count - offset
+    }
+
+    mutating func skip(_ count: Int) -> Bool {
+        guard bytes.count - offset >= count else {
+            return false
+        }
+        offset += count
+        return true
+    }
+
+    /// Reads up to the next newline, and consumes it.
+    mutating func readLine() -> Substring.UTF8View? {
+        guard let end = bytes[offset...].firstIndex(of: UInt8(ascii: "\n")) else {
+            return nil
+        }
+        defer { offset = end + 1 }
+        return String(decoding: bytes[offset ..< end], as: UTF8.self)[...].utf8
+    }
+
+    mutating func readHeader() -> Header? {
+        guard let magic = read(UInt32.self), magic == 0x545A_6966 /* TZif */, let version = read(UInt8.self), skip(15) else {
+            return nil
+        }
+        var counts = [Int]()
+        for _ in 0 ..< 6 {
+            guard let count = read(UInt32.self) else {
+                return nil
+            }
+            counts.append(Int(count))
+        }
+        // Every file has at least one type and one abbreviation byte, and type indices are bytes
+        guard counts[4] > 0, counts[4] <= 256, counts[5] > 0 else {
+            return nil
+        }
+        return Header(version: version, utIndicatorCount: counts[0], standardIndicatorCount: counts[1], leapCount: counts[2], transitionCount: counts[3], typeCount: counts[4], abbreviationByteCount: counts[5])
+    }
+}
@@ -62,6 +62,126 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
     // This is only currently in use for foundation_swift_ICUResourceTimeZone_feature_enabled
     let _timeZoneICUResource: _TimeZoneICUResource?
 
+    // Built from `_timeZone` on first use. Once stored it is never replaced, so it can be read without the lock.
+    private let _offsetTable = AtomicLazyReference<OffsetTable>()
+
+    /// The offsets of a `UTimeZone` between 1900 and 2100, so that the common case of looking up the offset of a date in that range does not need the `UTimeZone` or its lock.
+    final class OffsetTable: Sendable {
+        struct Offsets: Sendable {
+            /// Raw offset, in milliseconds
+            let raw: Int32
+            /// Daylight saving time offset, in milliseconds
+            let dst: Int32
+        }
+
+        // 1900-01-01T00:00:00Z and 2100-01-01T00:00:00Z
+        static let tabulatedRange: Range<UDate> = -2208988800000.0 ..< 4102444800000.0
+
+        /// The dates the table answers for. This is shorter than `tabulatedRange` if ICU failed part way through building the table.
+        let range: Range<UDate>
+        /// The transitions inside `range`, in ascending order
+        let transitions: [UDate]
+        /// `offsets[i]` is in effect from `transitions[i - 1]` until `transitions[i]`
+        let offsets: [Offsets]
+
+        /// The `UTimeZone` must be protected from concurrent access for the duration of this call.
+        init(forLocked timeZone: UnsafePointer<UTimeZone?>) {
+            let lowerBound = Self.tabulatedRange.lowerBound
+            let upperBound = Self.tabulatedRange.upperBound
+
+            func icuOffsets(at udate: UDate) -> Offsets? {
+                var rawOffset: Int32 = 0
+                var dstOffset: Int32 = 0
+                var status = U_ZERO_ERROR
+                uatimezone_getOffset(timeZone, udate, 0, &rawOffset, &dstOffset, &status)
+                guard status.isSuccess else { return nil }
+                return Offsets(raw: rawOffset, dst: dstOffset)
+            }
+
+            guard let initialOffsets = icuOffsets(at: lowerBound) else {
+                // Answer nothing from the table; everything goes to ICU
+                self.range = lowerBound ..< lowerBound
+                self.transitions = []
+                self.offsets = []
+                return
+            }
+
+            var transitions: [UDate] = []
+            var allOffsets = [initialOffsets]
+            var date = lowerBound
+            var end = upperBound
+            while true {
+                var status = U_ZERO_ERROR
+                var next = UDate(0.0)
+                let success = uatimezone_getTimeZoneTransitionDate(timeZone, date, UCAL_TZ_TRANSITION_NEXT, &next, &status)
+                guard status.isSuccess else {
+                    end = date
+                    break
+                }
+                guard success != 0, next > date, next < upperBound else {
+                    // No more transitions in the range
+                    break
+                }
+                guard let nextOffsets = icuOffsets(at: next) else {
+                    end = next
+                    break
+                }
+                transitions.append(next)
+                allOffsets.append(nextOffsets)
+                date = next
+            }
+
+            self.range = lowerBound ..< end
+            self.transitions = transitions
+            self.offsets = allOffsets
+        }
+
+        /// The number of transitions at or before `udate`, which is also the index of the offsets in effect at `udate`
+        private func transitionCount(atOrBefore udate: UDate) -> Int {
+            var low = 0
+            var high = transitions.count
+            while low < high {
+                let mid = (low + high) / 2
+                if transitions[mid] <= udate {
+                    low = mid + 1
+                } else {
+                    high = mid
+                }
+            }
+            return low
+        }
+
+        /// Returns nil if `udate` is outside of `range`.
+        func offsetsInEffect(at udate: UDate) -> Offsets? {
+            guard range.contains(udate) else { return nil }
+            return offsets[transitionCount(atOrBefore: udate)]
+        }
+
+        /// Returns nil if `udate` is outside of `range`, or if the next transition is after the end of `range`.
+        func nextTransition(after udate: UDate) -> UDate? {
+            guard range.contains(udate) else { return nil }
+            let index = transitionCount(atOrBefore: udate)
+            guard index < transitions.count else { return nil }
+            return transitions[index]
+        }
+    }
+
+    /// Returns nil when there is no `_timeZone`, i.e. when this is backed by `_timeZoneICUResource`.
+    private var offsetTable: OffsetTable? {
+        if let table = _offsetTable.load() {
+            return table
+        }
+        return _timeZone._borrowingMap {
+            $0.withLock {
+                // Another thread may have built the table while we waited for the lock
+                if let table = _offsetTable.load() {
+                    return table
+                }
+                return _offsetTable.storeIfNil(OffsetTable(forLocked: $0))
+            }
+        }
+    }
+
     // This type is safely sendable because it is guarded by a lock in _TimeZoneICU and we never vend it outside of the lock so it can only ever be accessed from within the lock
     struct State : @unchecked Sendable {
         /// Access must be serialized
@@ -110,7 +230,12 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
 
     }
 
-    required init?(identifier: String) {
+    required convenience init?(identifier: String) {
+        self.init(identifier: identifier, preferringICUResource: foundation_swift_ICUResourceTimeZone_feature_enabled())
+    }
+
+    /// When `preferringICUResource` is false, or the time zone is not in ICU's resources, the time zone is backed by a `UTimeZone` instead.
+    init?(identifier: String, preferringICUResource: Bool) {
         guard !identifier.isEmpty else {
             return nil
         }
@@ -129,7 +254,7 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
 
         self.name = name
         lock = Mutex(State())
-        if foundation_swift_ICUResourceTimeZone_feature_enabled(), let timeZoneICUResource = try? _TimeZoneICUResource(identifier: name) {
+        if preferringICUResource, let timeZoneICUResource = try? _TimeZoneICUResource(identifier: name) {
             // TODO: add logging for when initializaiton fails
             self._timeZoneICUResource = timeZoneICUResource
             self._timeZone = nil
@@ -170,6 +295,10 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
     }
 
     func _secondsFromGMT(for date: Date) -> Int {
+        if let offsets = offsetTable?.offsetsInEffect(at: date.udate) {
+            return Int((offsets.raw + offsets.dst) / 1000)
+        }
+
         let result = _timeZone._borrowingMap {
             $0.withLock {
                  var rawOffset: Int32 = 0
@@ -208,6 +337,10 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
     }
 
     func _daylightSavingTimeOffset(for date: Date) -> TimeInterval {
+        if let offsets = offsetTable?.offsetsInEffect(at: date.udate) {
+            return TimeInterval(Double(offsets.dst) / 1000.0)
+        }
+
         let result = _timeZone._borrowingMap {
             $0.withLock {
                 var rawOffset_unused: Int32 = 0
@@ -232,6 +365,10 @@ final class _TimeZoneICU: _TimeZoneProtocol, Sendable {
     }
 
     func _nextDaylightSavingTimeTransition(after date: Date) -> Date? {
+        if let next = offsetTable?.nextTransition(after: date.udate) {
+            return Date(udate: next)
+        }
+
         let result: UDate?? = _timeZone._borrowingMap {
             let limit = Date.validCalendarRange.upperBound
             return $0.withLock {
@@ -0,0 +1,474 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/_CShimsTargetConditionals.h"
+#include "include/ascii_shims.h"
+
+// Case folding sets bit 0x20 of the bytes in 'A'...'Z'. Each kernel takes that bit as a value that
+// is 0x20 when folding and 0 otherwise, so the same code serves both comparisons.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !TARGET_OS_WINDOWS
+#define ASCIISHIMS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ASCIISHIMS_NEON 1
+#include <arm_neon.h>
+#endif
+
+typedef size_t (*_asciishims_nonascii_kernel)(const uint8_t *, size_t);
+typedef size_t (*_asciishims_prefix_kernel)(const uint8_t *, const uint8_t *, size_t, uint8_t);
+typedef size_t (*_asciishims_search_kernel)(const uint8_t *, size_t, size_t, const uint8_t *, size_t, uint8_t);
+
+static inline uint8_t _asciishims_fold(uint8_t c, uint8_t caseBit) {
+    return (uint8_t)(c - 'A') < 26 ? (c | caseBit) : c;
+}
+
+// Compares the bytes between the first and the last one, which the caller has already matched.
+static inline bool _asciishims_matches(const uint8_t *candidate, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    for (size_t i = 1; i + 1 < needleLength; i++) {
+        if (_asciishims_fold(candidate[i], caseBit) != _asciishims_fold(needle[i], caseBit)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline size_t _asciishims_nonascii_scalar(const uint8_t *bytes, size_t from, size_t length) {
+    for (size_t i = from; i < length; i++) {
+        if (bytes[i] & 0x80) {
+            return i;
+        }
+    }
+    return length;
+}
+
+static inline size_t _asciishims_prefix_scalar(const uint8_t *a, const uint8_t *b, size_t from, size_t length, uint8_t caseBit) {
+    for (size_t i = from; i < length; i++) {
+        if (((a[i] | b[i]) & 0x80) || _asciishims_fold(a[i], caseBit) != _asciishims_fold(b[i], caseBit)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// Checks the candidate positions in `from..<to`, front to back.
+static inline size_t _asciishims_first_scalar(const uint8_t *haystack, size_t from, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    const uint8_t first = _asciishims_fold(needle[0], caseBit);
+    const uint8_t last = _asciishims_fold(needle[needleLength - 1], caseBit);
+    for (size_t i = from; i < to; i++) {
+        if (_asciishims_fold(haystack[i], caseBit) == first && _asciishims_fold(haystack[i + needleLength - 1], caseBit) == last && _asciishims_matches(haystack + i, needle, needleLength, caseBit)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// Checks the candidate positions in `0..<to`, back to front.
+static inline size_t _asciishims_last_scalar(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    const uint8_t first = _asciishims_fold(needle[0], caseBit);
+    const uint8_t last = _asciishims_fold(needle[needleLength - 1], caseBit);
+    for (size_t i = to; i-- > 0;) {
+        if (_asciishims_fold(haystack[i], caseBit) == first && _asciishims_fold(haystack[i + needleLength - 1], caseBit) == last && _asciishims_matches(haystack + i, needle, needleLength, caseBit)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+#if !ASCIISHIMS_X86 && !ASCIISHIMS_NEON
+static size_t _asciishims_nonascii_none(const uint8_t *bytes, size_t length) {
+    return _asciishims_nonascii_scalar(bytes, 0, length);
+}
+
+static size_t _asciishims_prefix_none(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit) {
+    return _asciishims_prefix_scalar(a, b, 0, length, caseBit);
+}
+
+static size_t _asciishims_first_none(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    return _asciishims_first_scalar(haystack, from, length - needleLength + 1, length, needle, needleLength, caseBit);
+}
+
+static size_t _asciishims_last_none(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    return _asciishims_last_scalar(haystack, to < positions ? to : positions, length, needle, needleLength, caseBit);
+}
+#endif
+
+// MARK: - x86
+
+#if ASCIISHIMS_X86
+
+// Adding 0x3F moves 'A'...'Z' to the 26 smallest signed bytes, so a single signed compare finds them.
+
+static inline __m128i _asciishims_fold_sse2(__m128i v, __m128i caseBit) {
+    const __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(v, _mm_set1_epi8(0x3F)), _mm_set1_epi8(-128 + 26));
+    return _mm_or_si128(v, _mm_and_si128(upper, caseBit));
+}
+
+static size_t _asciishims_nonascii_sse2(const uint8_t *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)));
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return _asciishims_nonascii_scalar(bytes, i, length);
+}
+
+static size_t _asciishims_prefix_sse2(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit) {
+    const __m128i bit = _mm_set1_epi8((char)caseBit);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        const __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        const unsigned nonASCII = (unsigned)_mm_movemask_epi8(_mm_or_si128(va, vb));
+        const unsigned equal = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_asciishims_fold_sse2(va, bit), _asciishims_fold_sse2(vb, bit)));
+        const unsigned stop = nonASCII | (~equal & 0xFFFF);
+        if (stop) {
+            return i + (size_t)__builtin_ctz(stop);
+        }
+    }
+    return _asciishims_prefix_scalar(a, b, i, length, caseBit);
+}
+
+// In the search kernels a block at `i` loads the bytes `i ..< i + width` and
+// `i + needleLength - 1 ..< i + needleLength - 1 + width`, so blocks are only used while
+// `i + width <= positions`, which keeps both loads within the haystack.
+
+static size_t _asciishims_first_sse2(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m128i bit = _mm_set1_epi8((char)caseBit);
+    const __m128i first = _mm_set1_epi8((char)_asciishims_fold(needle[0], caseBit));
+    const __m128i last = _mm_set1_epi8((char)_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t i = from;
+    for (; i + 16 <= positions; i += 16) {
+        const __m128i a = _asciishims_fold_sse2(_mm_loadu_si128((const __m128i *)(haystack + i)), bit);
+        const __m128i b = _asciishims_fold_sse2(_mm_loadu_si128((const __m128i *)(haystack + i + needleLength - 1)), bit);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask) {
+            const size_t candidate = i + (size_t)__builtin_ctz(mask);
+            if (_asciishims_matches(haystack + candidate, needle, needleLength, caseBit)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return _asciishims_first_scalar(haystack, i, positions, length, needle, needleLength, caseBit);
+}
+
+static size_t _asciishims_last_sse2(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m128i bit = _mm_set1_epi8((char)caseBit);
+    const __m128i first = _mm_set1_epi8((char)_asciishims_fold(needle[0], caseBit));
+    const __m128i last = _mm_set1_epi8((char)_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t end = to < positions ? to : positions;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        const __m128i a = _asciishims_fold_sse2(_mm_loadu_si128((const __m128i *)(haystack + i)), bit);
+        const __m128i b = _asciishims_fold_sse2(_mm_loadu_si128((const __m128i *)(haystack + i + needleLength - 1)), bit);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask) {
+            const unsigned offset = 31 - (unsigned)__builtin_clz(mask);
+            if (_asciishims_matches(haystack + i + offset, needle, needleLength, caseBit)) {
+                return i + offset;
+            }
+            mask &= ~(1u << offset);
+        }
+    }
+    return _asciishims_last_scalar(haystack, end, length, needle, needleLength, caseBit);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i _asciishims_fold_avx2(__m256i v, __m256i caseBit) {
+    const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), _mm256_add_epi8(v, _mm256_set1_epi8(0x3F)));
+    return _mm256_or_si256(v, _mm256_and_si256(upper, caseBit));
+}
+
+__attribute__((target("avx2")))
+static size_t _asciishims_nonascii_avx2(const uint8_t *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)(bytes + i)));
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return _asciishims_nonascii_scalar(bytes, i, length);
+}
+
+__attribute__((target("avx2")))
+static size_t _asciishims_prefix_avx2(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit) {
+    const __m256i bit = _mm256_set1_epi8((char)caseBit);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        const unsigned nonASCII = (unsigned)_mm256_movemask_epi8(_mm256_or_si256(va, vb));
+        const unsigned equal = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_asciishims_fold_avx2(va, bit), _asciishims_fold_avx2(vb, bit)));
+        const unsigned stop = nonASCII | ~equal;
+        if (stop) {
+            return i + (size_t)__builtin_ctz(stop);
+        }
+    }
+    return _asciishims_prefix_scalar(a, b, i, length, caseBit);
+}
+
+__attribute__((target("avx2")))
+static size_t _asciishims_first_avx2(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m256i bit = _mm256_set1_epi8((char)caseBit);
+    const __m256i first = _mm256_set1_epi8((char)_asciishims_fold(needle[0], caseBit));
+    const __m256i last = _mm256_set1_epi8((char)_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t i = from;
+    for (; i + 32 <= positions; i += 32) {
+        const __m256i a = _asciishims_fold_avx2(_mm256_loadu_si256((const __m256i *)(haystack + i)), bit);
+        const __m256i b = _asciishims_fold_avx2(_mm256_loadu_si256((const __m256i *)(haystack + i + needleLength - 1)), bit);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask) {
+            const size_t candidate = i + (size_t)__builtin_ctz(mask);
+            if (_asciishims_matches(haystack + candidate, needle, needleLength, caseBit)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return _asciishims_first_scalar(haystack, i, positions, length, needle, needleLength, caseBit);
+}
+
+__attribute__((target("avx2")))
+static size_t _asciishims_last_avx2(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m256i bit = _mm256_set1_epi8((char)caseBit);
+    const __m256i first = _mm256_set1_epi8((char)_asciishims_fold(needle[0], caseBit));
+    const __m256i last = _mm256_set1_epi8((char)_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t end = to < positions ? to : positions;
+    for (; end >= 32; end -= 32) {
+        const size_t i = end - 32;
+        const __m256i a = _asciishims_fold_avx2(_mm256_loadu_si256((const __m256i *)(haystack + i)), bit);
+        const __m256i b = _asciishims_fold_avx2(_mm256_loadu_si256((const __m256i *)(haystack + i + needleLength - 1)), bit);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask) {
+            const unsigned offset = 31 - (unsigned)__builtin_clz(mask);
+            if (_asciishims_matches(haystack + i + offset, needle, needleLength, caseBit)) {
+                return i + offset;
+            }
+            mask &= ~(1u << offset);
+        }
+    }
+    return _asciishims_last_scalar(haystack, end, length, needle, needleLength, caseBit);
+}
+
+#endif // ASCIISHIMS_X86
+
+// MARK: - NEON
+
+#if ASCIISHIMS_NEON
+
+// NEON has no movemask; narrowing a 16 byte comparison result by 4 bits yields a 64 bit mask with
+// a nibble per byte instead.
+static inline uint64_t _asciishims_neon_mask(uint8x16_t v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+static inline uint8x16_t _asciishims_fold_neon(uint8x16_t v, uint8x16_t caseBit) {
+    const uint8x16_t upper = vcltq_u8(vsubq_u8(v, vdupq_n_u8('A')), vdupq_n_u8(26));
+    return vorrq_u8(v, vandq_u8(upper, caseBit));
+}
+
+static size_t _asciishims_nonascii_neon(const uint8_t *bytes, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const uint64_t mask = _asciishims_neon_mask(vcgeq_u8(vld1q_u8(bytes + i), vdupq_n_u8(0x80)));
+        if (mask) {
+            return i + (size_t)__builtin_ctzll(mask) / 4;
+        }
+    }
+    return _asciishims_nonascii_scalar(bytes, i, length);
+}
+
+static size_t _asciishims_prefix_neon(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit) {
+    const uint8x16_t bit = vdupq_n_u8(caseBit);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t va = vld1q_u8(a + i);
+        const uint8x16_t vb = vld1q_u8(b + i);
+        const uint8x16_t nonASCII = vcgeq_u8(vorrq_u8(va, vb), vdupq_n_u8(0x80));
+        const uint8x16_t different = vmvnq_u8(vceqq_u8(_asciishims_fold_neon(va, bit), _asciishims_fold_neon(vb, bit)));
+        const uint64_t stop = _asciishims_neon_mask(vorrq_u8(nonASCII, different));
+        if (stop) {
+            return i + (size_t)__builtin_ctzll(stop) / 4;
+        }
+    }
+    return _asciishims_prefix_scalar(a, b, i, length, caseBit);
+}
+
+static size_t _asciishims_first_neon(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const uint8x16_t bit = vdupq_n_u8(caseBit);
+    const uint8x16_t first = vdupq_n_u8(_asciishims_fold(needle[0], caseBit));
+    const uint8x16_t last = vdupq_n_u8(_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t i = from;
+    for (; i + 16 <= positions; i += 16) {
+        const uint8x16_t a = _asciishims_fold_neon(vld1q_u8(haystack + i), bit);
+        const uint8x16_t b = _asciishims_fold_neon(vld1q_u8(haystack + i + needleLength - 1), bit);
+        uint64_t mask = _asciishims_neon_mask(vandq_u8(vceqq_u8(a, first), vceqq_u8(b, last)));
+        while (mask) {
+            const unsigned offset = (unsigned)__builtin_ctzll(mask) / 4;
+            if (_asciishims_matches(haystack + i + offset, needle, needleLength, caseBit)) {
+                return i + offset;
+            }
+            mask &= ~(0xFULL << (offset * 4));
+        }
+    }
+    return _asciishims_first_scalar(haystack, i, positions, length, needle, needleLength, caseBit);
+}
+
+static size_t _asciishims_last_neon(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const uint8x16_t bit = vdupq_n_u8(caseBit);
+    const uint8x16_t first = vdupq_n_u8(_asciishims_fold(needle[0], caseBit));
+    const uint8x16_t last = vdupq_n_u8(_asciishims_fold(needle[needleLength - 1], caseBit));
+    size_t end = to < positions ? to : positions;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        const uint8x16_t a = _asciishims_fold_neon(vld1q_u8(haystack + i), bit);
+        const uint8x16_t b = _asciishims_fold_neon(vld1q_u8(haystack + i + needleLength - 1), bit);
+        uint64_t mask = _asciishims_neon_mask(vandq_u8(vceqq_u8(a, first), vceqq_u8(b, last)));
+        while (mask) {
+            const unsigned offset = (63 - (unsigned)__builtin_clzll(mask)) / 4;
+            if (_asciishims_matches(haystack + i + offset, needle, needleLength, caseBit)) {
+                return i + offset;
+            }
+            mask &= ~(0xFULL << (offset * 4));
+        }
+    }
+    return _asciishims_last_scalar(haystack, end, length, needle, needleLength, caseBit);
+}
+
+#endif // ASCIISHIMS_NEON
+
+// MARK: - Dispatch
+
+typedef struct {
+    _asciishims_nonascii_kernel nonascii;
+    _asciishims_prefix_kernel prefix;
+    _asciishims_search_kernel first;
+    _asciishims_search_kernel last;
+} _asciishims_kernels;
+
+static _asciishims_kernels _asciishims_select_kernels(void) {
+    _asciishims_kernels kernels;
+#if ASCIISHIMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.nonascii = _asciishims_nonascii_avx2;
+        kernels.prefix = _asciishims_prefix_avx2;
+        kernels.first = _asciishims_first_avx2;
+        kernels.last = _asciishims_last_avx2;
+    } else {
+        kernels.nonascii = _asciishims_nonascii_sse2;
+        kernels.prefix = _asciishims_prefix_sse2;
+        kernels.first = _asciishims_first_sse2;
+        kernels.last = _asciishims_last_sse2;
+    }
+#elif ASCIISHIMS_NEON
+    kernels.nonascii = _asciishims_nonascii_neon;
+    kernels.prefix = _asciishims_prefix_neon;
+    kernels.first = _asciishims_first_neon;
+    kernels.last = _asciishims_last_neon;
+#else
+    kernels.nonascii = _asciishims_nonascii_none;
+    kernels.prefix = _asciishims_prefix_none;
+    kernels.first = _asciishims_first_none;
+    kernels.last = _asciishims_last_none;
+#endif
+    return kernels;
+}
+
+static size_t _asciishims_nonascii_resolve(const uint8_t *bytes, size_t length);
+static size_t _asciishims_prefix_resolve(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit);
+static size_t _asciishims_first_resolve(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit);
+static size_t _asciishims_last_resolve(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit);
+
+static _asciishims_nonascii_kernel _asciishims_nonascii_kernel_ptr = _asciishims_nonascii_resolve;
+static _asciishims_prefix_kernel _asciishims_prefix_kernel_ptr = _asciishims_prefix_resolve;
+static _asciishims_search_kernel _asciishims_first_kernel_ptr = _asciishims_first_resolve;
+static _asciishims_search_kernel _asciishims_last_kernel_ptr = _asciishims_last_resolve;
+
+static void _asciishims_resolve(void) {
+    const _asciishims_kernels kernels = _asciishims_select_kernels();
+    _CSHIMS_STORE_KERNEL(_asciishims_nonascii_kernel_ptr, kernels.nonascii);
+    _CSHIMS_STORE_KERNEL(_asciishims_prefix_kernel_ptr, kernels.prefix);
+    _CSHIMS_STORE_KERNEL(_asciishims_first_kernel_ptr, kernels.first);
+    _CSHIMS_STORE_KERNEL(_asciishims_last_kernel_ptr, kernels.last);
+}
+
+static size_t _asciishims_nonascii_resolve(const uint8_t *bytes, size_t length) {
+    _asciishims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_asciishims_nonascii_kernel_ptr)(bytes, length);
+}
+
+static size_t _asciishims_prefix_resolve(const uint8_t *a, const uint8_t *b, size_t length, uint8_t caseBit) {
+    _asciishims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_asciishims_prefix_kernel_ptr)(a, b, length, caseBit);
+}
+
+static size_t _asciishims_first_resolve(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    _asciishims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_asciishims_first_kernel_ptr)(haystack, from, length, needle, needleLength, caseBit);
+}
+
+static size_t _asciishims_last_resolve(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, uint8_t caseBit) {
+    _asciishims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_asciishims_last_kernel_ptr)(haystack, to, length, needle, needleLength, caseBit);
+}
+
+size_t _asciishims_first_nonascii(const uint8_t *bytes, size_t length) {
+    return _CSHIMS_LOAD_KERNEL(_asciishims_nonascii_kernel_ptr)(bytes, length);
+}
+
+size_t _asciishims_common_prefix(const uint8_t *a, const uint8_t *b, size_t length, bool foldCase) {
+    return _CSHIMS_LOAD_KERNEL(_asciishims_prefix_kernel_ptr)(a, b, length, foldCase ? 0x20 : 0);
+}
+
+size_t _asciishims_first(const uint8_t *haystack, size_t from, size_t length, const uint8_t *needle, size_t needleLength, bool foldCase) {
+    return _CSHIMS_LOAD_KERNEL(_asciishims_first_kernel_ptr)(haystack, from, length, needle, needleLength, foldCase ? 0x20 : 0);
+}
+
+size_t _asciishims_last(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength, bool foldCase) {
+    return _CSHIMS_LOAD_KERNEL(_asciishims_last_kernel_ptr)(haystack, to, length, needle, needleLength, foldCase ? 0x20 : 0);
+}
@@ -0,0 +1,360 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/_CShimsTargetConditionals.h"
+#include "include/base64_shims.h"
+
+// The x86 kernels follow the approach described by Wojciech Muła and Daniel Lemire in
+// "Faster Base64 Encoding and Decoding Using AVX2 Instructions" and "Base64 encoding and decoding
+// at almost the speed of a memory copy".
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !TARGET_OS_WINDOWS
+#define BASE64SHIMS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define BASE64SHIMS_NEON 1
+#include <arm_neon.h>
+#endif
+
+typedef size_t (*_base64shims_kernel)(const uint8_t *, size_t, uint8_t *, bool);
+
+#if BASE64SHIMS_X86 || BASE64SHIMS_NEON
+static const uint8_t _base64shims_alphabet[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const uint8_t _base64shims_alphabet_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+#endif
+
+static size_t _base64shims_none(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    (void)input;
+    (void)length;
+    (void)output;
+    (void)urlAlphabet;
+    return 0;
+}
+
+// MARK: - x86
+
+#if BASE64SHIMS_X86
+
+// Maps ASCII characters to their 6 bit value, or 0x80 for characters outside of the alphabet.
+static const uint8_t _base64shims_decoding[128] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x80, 0x80, 0x80, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+static const uint8_t _base64shims_decoding_url[128] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3E, 0x80, 0x80,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x80, 0x80, 0x80, 0x80, 0x3F,
+    0x80, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+// Gathers 48 input bytes into 16 lanes of [b1, b0, b2, b1].
+static const uint8_t _base64shims_avx512_encode_gather[64] = {
+     1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7, 10,  9, 11, 10,
+    13, 12, 14, 13, 16, 15, 17, 16, 19, 18, 20, 19, 22, 21, 23, 22,
+    25, 24, 26, 25, 28, 27, 29, 28, 31, 30, 32, 31, 34, 33, 35, 34,
+    37, 36, 38, 37, 40, 39, 41, 40, 43, 42, 44, 43, 46, 45, 47, 46,
+};
+
+// Compacts 16 lanes holding 24 decoded bits each into 48 consecutive bytes.
+static const uint8_t _base64shims_avx512_decode_pack[64] = {
+     2,  1,  0,  6,  5,  4, 10,  9,  8, 14, 13, 12, 18, 17, 16, 22,
+    21, 20, 26, 25, 24, 30, 29, 28, 34, 33, 32, 38, 37, 36, 42, 41,
+    40, 46, 45, 44, 50, 49, 48, 54, 53, 52, 58, 57, 56, 62, 61, 60,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+__attribute__((target("avx2")))
+static size_t _base64shims_encode_avx2(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    // The upper lane is loaded 4 bytes early so that no load reaches past the 24 bytes consumed per
+    // iteration, which is why its gather pattern is offset by 4.
+    const __m256i gather = _mm256_setr_epi8(
+         1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7, 10,  9, 11, 10,
+         5,  4,  6,  5,  8,  7,  9,  8, 11, 10, 12, 11, 14, 13, 15, 14);
+    // Offsets from a 6 bit value to its character, indexed by the range the value falls into.
+    const int8_t c62 = urlAlphabet ? '-' - 62 : '+' - 62;
+    const int8_t c63 = urlAlphabet ? '_' - 63 : '/' - 63;
+    const __m256i offsets = _mm256_setr_epi8(
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, c62, c63, 0, 0,
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, c62, c63, 0, 0);
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 24) {
+        const __m128i lo = _mm_loadu_si128((const __m128i *)(input + inIndex));
+        const __m128i hi = _mm_loadu_si128((const __m128i *)(input + inIndex + 8));
+        __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        v = _mm256_shuffle_epi8(v, gather);
+
+        // Split every [b1, b0, b2, b1] lane into four 6 bit values, one per byte.
+        const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const __m256i values = _mm256_or_si256(t1, t3);
+
+        __m256i ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        ranges = _mm256_sub_epi8(ranges, _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+        const __m256i characters = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+
+        _mm256_storeu_si256((__m256i *)(output + outIndex), characters);
+        inIndex += 24;
+        outIndex += 32;
+    }
+    return inIndex;
+}
+
+__attribute__((target("avx2")))
+static size_t _base64shims_decode_avx2(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    const __m256i c62 = _mm256_set1_epi8(urlAlphabet ? '-' : '+');
+    const __m256i c63 = _mm256_set1_epi8(urlAlphabet ? '_' : '/');
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 32) {
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(input + inIndex));
+
+        // Unsigned range checks of the form `c - lower <= upper - lower`.
+        const __m256i dUpper = _mm256_sub_epi8(c, _mm256_set1_epi8('A'));
+        const __m256i isUpper = _mm256_cmpeq_epi8(_mm256_min_epu8(dUpper, _mm256_set1_epi8(25)), dUpper);
+        const __m256i dLower = _mm256_sub_epi8(c, _mm256_set1_epi8('a'));
+        const __m256i isLower = _mm256_cmpeq_epi8(_mm256_min_epu8(dLower, _mm256_set1_epi8(25)), dLower);
+        const __m256i dDigit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+        const __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(dDigit, _mm256_set1_epi8(9)), dDigit);
+        const __m256i is62 = _mm256_cmpeq_epi8(c, c62);
+        const __m256i is63 = _mm256_cmpeq_epi8(c, c63);
+
+        const __m256i valid = _mm256_or_si256(_mm256_or_si256(isUpper, isLower), _mm256_or_si256(_mm256_or_si256(isDigit, is62), is63));
+        if (_mm256_movemask_epi8(valid) != -1) {
+            break;
+        }
+
+        __m256i values = _mm256_and_si256(isUpper, dUpper);
+        values = _mm256_or_si256(values, _mm256_and_si256(isLower, _mm256_add_epi8(dLower, _mm256_set1_epi8(26))));
+        values = _mm256_or_si256(values, _mm256_and_si256(isDigit, _mm256_add_epi8(dDigit, _mm256_set1_epi8(52))));
+        values = _mm256_or_si256(values, _mm256_and_si256(is62, _mm256_set1_epi8(62)));
+        values = _mm256_or_si256(values, _mm256_and_si256(is63, _mm256_set1_epi8(63)));
+
+        // Merge each group of four 6 bit values into 24 bits, then compact the 12 bytes of each lane.
+        __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, pack);
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+        _mm_storeu_si128((__m128i *)(output + outIndex), _mm256_castsi256_si128(merged));
+        _mm_storel_epi64((__m128i *)(output + outIndex + 16), _mm256_extracti128_si256(merged, 1));
+        inIndex += 32;
+        outIndex += 24;
+    }
+    return inIndex;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t _base64shims_encode_avx512vbmi(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    const __m512i alphabet = _mm512_loadu_si512(urlAlphabet ? _base64shims_alphabet_url : _base64shims_alphabet);
+    const __m512i gather = _mm512_loadu_si512(_base64shims_avx512_encode_gather);
+    // Bit offsets of the four 6 bit values inside every [b1, b0, b2, b1] lane.
+    const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040aLL);
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 48) {
+        __m512i v = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFFULL, input + inIndex);
+        v = _mm512_permutexvar_epi8(gather, v);
+        v = _mm512_multishift_epi64_epi8(shifts, v);
+        v = _mm512_permutexvar_epi8(v, alphabet);
+        _mm512_storeu_si512(output + outIndex, v);
+        inIndex += 48;
+        outIndex += 64;
+    }
+    return inIndex;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t _base64shims_decode_avx512vbmi(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    const uint8_t *table = urlAlphabet ? _base64shims_decoding_url : _base64shims_decoding;
+    const __m512i tableLo = _mm512_loadu_si512(table);
+    const __m512i tableHi = _mm512_loadu_si512(table + 64);
+    const __m512i pack = _mm512_loadu_si512(_base64shims_avx512_decode_pack);
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 64) {
+        const __m512i c = _mm512_loadu_si512(input + inIndex);
+        const __m512i values = _mm512_permutex2var_epi8(tableLo, c, tableHi);
+        // Non-ASCII input has its high bit set, characters outside of the alphabet map to 0x80.
+        if (_mm512_movepi8_mask(_mm512_or_si512(values, c)) != 0) {
+            break;
+        }
+
+        __m512i merged = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        merged = _mm512_madd_epi16(merged, _mm512_set1_epi32(0x00011000));
+        merged = _mm512_permutexvar_epi8(pack, merged);
+        _mm512_mask_storeu_epi8(output + outIndex, 0x0000FFFFFFFFFFFFULL, merged);
+        inIndex += 64;
+        outIndex += 48;
+    }
+    return inIndex;
+}
+
+#endif // BASE64SHIMS_X86
+
+// MARK: - NEON
+
+#if BASE64SHIMS_NEON
+
+static size_t _base64shims_encode_neon(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    const uint8_t *alphabet = urlAlphabet ? _base64shims_alphabet_url : _base64shims_alphabet;
+    uint8x16x4_t table;
+    table.val[0] = vld1q_u8(alphabet);
+    table.val[1] = vld1q_u8(alphabet + 16);
+    table.val[2] = vld1q_u8(alphabet + 32);
+    table.val[3] = vld1q_u8(alphabet + 48);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 48) {
+        const uint8x16x3_t bytes = vld3q_u8(input + inIndex);
+        uint8x16x4_t characters;
+        characters.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        characters.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[1], 4), vshlq_n_u8(bytes.val[0], 4)), mask);
+        characters.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[2], 6), vshlq_n_u8(bytes.val[1], 2)), mask);
+        characters.val[3] = vandq_u8(bytes.val[2], mask);
+        characters.val[0] = vqtbl4q_u8(table, characters.val[0]);
+        characters.val[1] = vqtbl4q_u8(table, characters.val[1]);
+        characters.val[2] = vqtbl4q_u8(table, characters.val[2]);
+        characters.val[3] = vqtbl4q_u8(table, characters.val[3]);
+        vst4q_u8(output + outIndex, characters);
+        inIndex += 48;
+        outIndex += 64;
+    }
+    return inIndex;
+}
+
+static inline uint8x16_t _base64shims_decode_neon_values(uint8x16_t c, uint8x16_t c62, uint8x16_t c63, uint8x16_t *invalid) {
+    // Unsigned range checks of the form `c - lower <= upper - lower`.
+    const uint8x16_t dUpper = vsubq_u8(c, vdupq_n_u8('A'));
+    const uint8x16_t isUpper = vcleq_u8(dUpper, vdupq_n_u8(25));
+    const uint8x16_t dLower = vsubq_u8(c, vdupq_n_u8('a'));
+    const uint8x16_t isLower = vcleq_u8(dLower, vdupq_n_u8(25));
+    const uint8x16_t dDigit = vsubq_u8(c, vdupq_n_u8('0'));
+    const uint8x16_t isDigit = vcleq_u8(dDigit, vdupq_n_u8(9));
+    const uint8x16_t is62 = vceqq_u8(c, c62);
+    const uint8x16_t is63 = vceqq_u8(c, c63);
+
+    const uint8x16_t valid = vorrq_u8(vorrq_u8(isUpper, isLower), vorrq_u8(vorrq_u8(isDigit, is62), is63));
+    *invalid = vorrq_u8(*invalid, vmvnq_u8(valid));
+
+    uint8x16_t values = vandq_u8(isUpper, dUpper);
+    values = vorrq_u8(values, vandq_u8(isLower, vaddq_u8(dLower, vdupq_n_u8(26))));
+    values = vorrq_u8(values, vandq_u8(isDigit, vaddq_u8(dDigit, vdupq_n_u8(52))));
+    values = vorrq_u8(values, vandq_u8(is62, vdupq_n_u8(62)));
+    values = vorrq_u8(values, vandq_u8(is63, vdupq_n_u8(63)));
+    return values;
+}
+
+static size_t _base64shims_decode_neon(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    const uint8x16_t c62 = vdupq_n_u8(urlAlphabet ? '-' : '+');
+    const uint8x16_t c63 = vdupq_n_u8(urlAlphabet ? '_' : '/');
+
+    size_t inIndex = 0;
+    size_t outIndex = 0;
+    while (length - inIndex >= 64) {
+        uint8x16x4_t characters = vld4q_u8(input + inIndex);
+        uint8x16_t invalid = vdupq_n_u8(0);
+        const uint8x16_t a = _base64shims_decode_neon_values(characters.val[0], c62, c63, &invalid);
+        const uint8x16_t b = _base64shims_decode_neon_values(characters.val[1], c62, c63, &invalid);
+        const uint8x16_t c = _base64shims_decode_neon_values(characters.val[2], c62, c63, &invalid);
+        const uint8x16_t d = _base64shims_decode_neon_values(characters.val[3], c62, c63, &invalid);
+        if (vmaxvq_u8(invalid) != 0) {
+            break;
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+        vst3q_u8(output + outIndex, bytes);
+        inIndex += 64;
+        outIndex += 48;
+    }
+    return inIndex;
+}
+
+#endif // BASE64SHIMS_NEON
+
+// MARK: - Dispatch
+
+static void _base64shims_select_kernels(_base64shims_kernel *encode, _base64shims_kernel *decode) {
+    *encode = _base64shims_none;
+    *decode = _base64shims_none;
+#if BASE64SHIMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw")) {
+        *encode = _base64shims_encode_avx512vbmi;
+        *decode = _base64shims_decode_avx512vbmi;
+    } else if (__builtin_cpu_supports("avx2")) {
+        *encode = _base64shims_encode_avx2;
+        *decode = _base64shims_decode_avx2;
+    }
+#elif BASE64SHIMS_NEON
+    *encode = _base64shims_encode_neon;
+    *decode = _base64shims_decode_neon;
+#endif
+}
+
+static size_t _base64shims_encode_resolve(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet);
+static size_t _base64shims_decode_resolve(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet);
+
+static _base64shims_kernel _base64shims_encode_kernel = _base64shims_encode_resolve;
+static _base64shims_kernel _base64shims_decode_kernel = _base64shims_decode_resolve;
+
+static void _base64shims_resolve(void) {
+    _base64shims_kernel encode, decode;
+    _base64shims_select_kernels(&encode, &decode);
+    _CSHIMS_STORE_KERNEL(_base64shims_encode_kernel, encode);
+    _CSHIMS_STORE_KERNEL(_base64shims_decode_kernel, decode);
+}
+
+static size_t _base64shims_encode_resolve(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    _base64shims_resolve();
+    return _base64shims_encode(input, length, output, urlAlphabet);
+}
+
+static size_t _base64shims_decode_resolve(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    _base64shims_resolve();
+    return _base64shims_decode(input, length, output, urlAlphabet);
+}
+
+size_t _base64shims_encode(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    return _CSHIMS_LOAD_KERNEL(_base64shims_encode_kernel)(input, length, output, urlAlphabet);
+}
+
+size_t _base64shims_decode(const uint8_t *input, size_t length, uint8_t *output, bool urlAlphabet) {
+    return _CSHIMS_LOAD_KERNEL(_base64shims_decode_kernel)(input, length, output, urlAlphabet);
+}
@@ -0,0 +1,464 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/_CShimsTargetConditionals.h"
+#include "include/bytesearch_shims.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+// The kernels follow the "generic SIMD" substring search described by Wojciech Muła: a candidate
+// position needs both the first and the last byte of the needle to match, which rejects almost all
+// positions of typical input with two vector compares.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !TARGET_OS_WINDOWS
+#define BYTESEARCHSHIMS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define BYTESEARCHSHIMS_NEON 1
+#include <arm_neon.h>
+#endif
+
+typedef size_t (*_bytesearchshims_kernel)(const uint8_t *, size_t, const uint8_t *, size_t);
+
+// Compares the bytes between the first and the last one, which the caller has already matched.
+static inline bool _bytesearchshims_matches(const uint8_t *candidate, const uint8_t *needle, size_t needleLength) {
+    return memcmp(candidate + 1, needle + 1, needleLength - 2) == 0;
+}
+
+// Checks the candidate positions in `from..<to`, front to back.
+static inline size_t _bytesearchshims_first_scalar(const uint8_t *haystack, size_t from, size_t to, size_t length, const uint8_t *needle, size_t needleLength) {
+    for (size_t i = from; i < to; i++) {
+        if (haystack[i] == needle[0] && haystack[i + needleLength - 1] == needle[needleLength - 1] && _bytesearchshims_matches(haystack + i, needle, needleLength)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// Checks the candidate positions in `0..<to`, back to front.
+static inline size_t _bytesearchshims_last_scalar(const uint8_t *haystack, size_t to, size_t length, const uint8_t *needle, size_t needleLength) {
+    for (size_t i = to; i-- > 0;) {
+        if (haystack[i] == needle[0] && haystack[i + needleLength - 1] == needle[needleLength - 1] && _bytesearchshims_matches(haystack + i, needle, needleLength)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+static inline bool _bytesearchshims_in_set(uint8_t byte, const uint8_t *set, size_t setCount) {
+    for (size_t k = 0; k < setCount; k++) {
+        if (byte == set[k]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Checks the bytes in `from..<length`, front to back.
+static inline size_t _bytesearchshims_first_of_scalar(const uint8_t *bytes, size_t from, size_t length, const uint8_t *set, size_t setCount) {
+    for (size_t i = from; i < length; i++) {
+        if (_bytesearchshims_in_set(bytes[i], set, setCount)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// Checks the bytes in `0..<to`, back to front.
+static inline size_t _bytesearchshims_last_of_scalar(const uint8_t *bytes, size_t to, size_t length, const uint8_t *set, size_t setCount) {
+    for (size_t i = to; i-- > 0;) {
+        if (_bytesearchshims_in_set(bytes[i], set, setCount)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+// The vector kernels compare against five members of the set, so smaller sets repeat their first
+// member to fill the rest.
+#define BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k) ((k) < (setCount) ? (set)[k] : (set)[0])
+
+#if !BYTESEARCHSHIMS_X86 && !BYTESEARCHSHIMS_NEON
+static size_t _bytesearchshims_first_none(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    return _bytesearchshims_first_scalar(haystack, 0, length - needleLength + 1, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_last_none(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    return _bytesearchshims_last_scalar(haystack, length - needleLength + 1, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_first_of_none(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    return _bytesearchshims_first_of_scalar(bytes, 0, length, set, setCount);
+}
+
+static size_t _bytesearchshims_last_of_none(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    return _bytesearchshims_last_of_scalar(bytes, length, length, set, setCount);
+}
+#endif
+
+// MARK: - x86
+
+#if BYTESEARCHSHIMS_X86
+
+// In all kernels `positions` is the number of candidate positions. A block at `i` loads the bytes
+// `i ..< i + width` and `i + needleLength - 1 ..< i + needleLength - 1 + width`, so blocks are only
+// used while `i + width <= positions`, which keeps both loads within the haystack.
+
+static size_t _bytesearchshims_first_sse2(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m128i first = _mm_set1_epi8((char)needle[0]);
+    const __m128i last = _mm_set1_epi8((char)needle[needleLength - 1]);
+    size_t i = 0;
+    for (; i + 16 <= positions; i += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(haystack + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(haystack + i + needleLength - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask) {
+            const size_t candidate = i + (size_t)__builtin_ctz(mask);
+            if (_bytesearchshims_matches(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return _bytesearchshims_first_scalar(haystack, i, positions, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_last_sse2(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const __m128i first = _mm_set1_epi8((char)needle[0]);
+    const __m128i last = _mm_set1_epi8((char)needle[needleLength - 1]);
+    size_t end = length - needleLength + 1;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        const __m128i a = _mm_loadu_si128((const __m128i *)(haystack + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(haystack + i + needleLength - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask) {
+            const unsigned bit = 31 - (unsigned)__builtin_clz(mask);
+            if (_bytesearchshims_matches(haystack + i + bit, needle, needleLength)) {
+                return i + bit;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return _bytesearchshims_last_scalar(haystack, end, length, needle, needleLength);
+}
+
+__attribute__((target("avx2")))
+static size_t _bytesearchshims_first_avx2(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const __m256i first = _mm256_set1_epi8((char)needle[0]);
+    const __m256i last = _mm256_set1_epi8((char)needle[needleLength - 1]);
+    size_t i = 0;
+    for (; i + 32 <= positions; i += 32) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(haystack + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(haystack + i + needleLength - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask) {
+            const size_t candidate = i + (size_t)__builtin_ctz(mask);
+            if (_bytesearchshims_matches(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return _bytesearchshims_first_scalar(haystack, i, positions, length, needle, needleLength);
+}
+
+__attribute__((target("avx2")))
+static size_t _bytesearchshims_last_avx2(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const __m256i first = _mm256_set1_epi8((char)needle[0]);
+    const __m256i last = _mm256_set1_epi8((char)needle[needleLength - 1]);
+    size_t end = length - needleLength + 1;
+    for (; end >= 32; end -= 32) {
+        const size_t i = end - 32;
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(haystack + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(haystack + i + needleLength - 1));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask) {
+            const unsigned bit = 31 - (unsigned)__builtin_clz(mask);
+            if (_bytesearchshims_matches(haystack + i + bit, needle, needleLength)) {
+                return i + bit;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return _bytesearchshims_last_scalar(haystack, end, length, needle, needleLength);
+}
+
+static inline __m128i _bytesearchshims_set_mask_sse2(__m128i v, const __m128i members[5]) {
+    __m128i eq = _mm_or_si128(_mm_cmpeq_epi8(v, members[0]), _mm_cmpeq_epi8(v, members[1]));
+    eq = _mm_or_si128(eq, _mm_or_si128(_mm_cmpeq_epi8(v, members[2]), _mm_cmpeq_epi8(v, members[3])));
+    return _mm_or_si128(eq, _mm_cmpeq_epi8(v, members[4]));
+}
+
+static size_t _bytesearchshims_first_of_sse2(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    __m128i members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = _mm_set1_epi8((char)BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const unsigned mask = (unsigned)_mm_movemask_epi8(_bytesearchshims_set_mask_sse2(_mm_loadu_si128((const __m128i *)(bytes + i)), members));
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return _bytesearchshims_first_of_scalar(bytes, i, length, set, setCount);
+}
+
+static size_t _bytesearchshims_last_of_sse2(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    __m128i members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = _mm_set1_epi8((char)BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t end = length;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        const unsigned mask = (unsigned)_mm_movemask_epi8(_bytesearchshims_set_mask_sse2(_mm_loadu_si128((const __m128i *)(bytes + i)), members));
+        if (mask) {
+            return i + 31 - (unsigned)__builtin_clz(mask);
+        }
+    }
+    return _bytesearchshims_last_of_scalar(bytes, end, length, set, setCount);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i _bytesearchshims_set_mask_avx2(__m256i v, const __m256i members[5]) {
+    __m256i eq = _mm256_or_si256(_mm256_cmpeq_epi8(v, members[0]), _mm256_cmpeq_epi8(v, members[1]));
+    eq = _mm256_or_si256(eq, _mm256_or_si256(_mm256_cmpeq_epi8(v, members[2]), _mm256_cmpeq_epi8(v, members[3])));
+    return _mm256_or_si256(eq, _mm256_cmpeq_epi8(v, members[4]));
+}
+
+__attribute__((target("avx2")))
+static size_t _bytesearchshims_first_of_avx2(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    __m256i members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = _mm256_set1_epi8((char)BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const unsigned mask = (unsigned)_mm256_movemask_epi8(_bytesearchshims_set_mask_avx2(_mm256_loadu_si256((const __m256i *)(bytes + i)), members));
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+    return _bytesearchshims_first_of_scalar(bytes, i, length, set, setCount);
+}
+
+__attribute__((target("avx2")))
+static size_t _bytesearchshims_last_of_avx2(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    __m256i members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = _mm256_set1_epi8((char)BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t end = length;
+    for (; end >= 32; end -= 32) {
+        const size_t i = end - 32;
+        const unsigned mask = (unsigned)_mm256_movemask_epi8(_bytesearchshims_set_mask_avx2(_mm256_loadu_si256((const __m256i *)(bytes + i)), members));
+        if (mask) {
+            return i + 31 - (unsigned)__builtin_clz(mask);
+        }
+    }
+    return _bytesearchshims_last_of_scalar(bytes, end, length, set, setCount);
+}
+
+#endif // BYTESEARCHSHIMS_X86
+
+// MARK: - NEON
+
+#if BYTESEARCHSHIMS_NEON
+
+// NEON has no movemask; narrowing the 16 byte comparison result by 4 bits yields a 64 bit mask with
+// a nibble per byte instead.
+static inline uint64_t _bytesearchshims_neon_mask(uint8x16_t a, uint8x16_t b, uint8x16_t first, uint8x16_t last) {
+    const uint8x16_t eq = vandq_u8(vceqq_u8(a, first), vceqq_u8(b, last));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+static size_t _bytesearchshims_first_neon(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const size_t positions = length - needleLength + 1;
+    const uint8x16_t first = vdupq_n_u8(needle[0]);
+    const uint8x16_t last = vdupq_n_u8(needle[needleLength - 1]);
+    size_t i = 0;
+    for (; i + 16 <= positions; i += 16) {
+        uint64_t mask = _bytesearchshims_neon_mask(vld1q_u8(haystack + i), vld1q_u8(haystack + i + needleLength - 1), first, last);
+        while (mask) {
+            const unsigned bit = (unsigned)__builtin_ctzll(mask) / 4;
+            if (_bytesearchshims_matches(haystack + i + bit, needle, needleLength)) {
+                return i + bit;
+            }
+            mask &= ~(0xFULL << (bit * 4));
+        }
+    }
+    return _bytesearchshims_first_scalar(haystack, i, positions, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_last_neon(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    if (needleLength > length) {
+        return length;
+    }
+    const uint8x16_t first = vdupq_n_u8(needle[0]);
+    const uint8x16_t last = vdupq_n_u8(needle[needleLength - 1]);
+    size_t end = length - needleLength + 1;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        uint64_t mask = _bytesearchshims_neon_mask(vld1q_u8(haystack + i), vld1q_u8(haystack + i + needleLength - 1), first, last);
+        while (mask) {
+            const unsigned bit = (63 - (unsigned)__builtin_clzll(mask)) / 4;
+            if (_bytesearchshims_matches(haystack + i + bit, needle, needleLength)) {
+                return i + bit;
+            }
+            mask &= ~(0xFULL << (bit * 4));
+        }
+    }
+    return _bytesearchshims_last_scalar(haystack, end, length, needle, needleLength);
+}
+
+static inline uint64_t _bytesearchshims_set_mask_neon(uint8x16_t v, const uint8x16_t members[5]) {
+    uint8x16_t eq = vorrq_u8(vceqq_u8(v, members[0]), vceqq_u8(v, members[1]));
+    eq = vorrq_u8(eq, vorrq_u8(vceqq_u8(v, members[2]), vceqq_u8(v, members[3])));
+    eq = vorrq_u8(eq, vceqq_u8(v, members[4]));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+static size_t _bytesearchshims_first_of_neon(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    uint8x16_t members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = vdupq_n_u8(BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const uint64_t mask = _bytesearchshims_set_mask_neon(vld1q_u8(bytes + i), members);
+        if (mask) {
+            return i + (unsigned)__builtin_ctzll(mask) / 4;
+        }
+    }
+    return _bytesearchshims_first_of_scalar(bytes, i, length, set, setCount);
+}
+
+static size_t _bytesearchshims_last_of_neon(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    uint8x16_t members[5];
+    for (size_t k = 0; k < 5; k++) {
+        members[k] = vdupq_n_u8(BYTESEARCHSHIMS_SET_MEMBER(set, setCount, k));
+    }
+    size_t end = length;
+    for (; end >= 16; end -= 16) {
+        const size_t i = end - 16;
+        const uint64_t mask = _bytesearchshims_set_mask_neon(vld1q_u8(bytes + i), members);
+        if (mask) {
+            return i + (63 - (unsigned)__builtin_clzll(mask)) / 4;
+        }
+    }
+    return _bytesearchshims_last_of_scalar(bytes, end, length, set, setCount);
+}
+
+#endif // BYTESEARCHSHIMS_NEON
+
+// MARK: - Dispatch
+
+typedef struct {
+    _bytesearchshims_kernel first;
+    _bytesearchshims_kernel last;
+    _bytesearchshims_kernel firstOf;
+    _bytesearchshims_kernel lastOf;
+} _bytesearchshims_kernels;
+
+static _bytesearchshims_kernels _bytesearchshims_select_kernels(void) {
+#if BYTESEARCHSHIMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return (_bytesearchshims_kernels){ _bytesearchshims_first_avx2, _bytesearchshims_last_avx2, _bytesearchshims_first_of_avx2, _bytesearchshims_last_of_avx2 };
+    }
+    return (_bytesearchshims_kernels){ _bytesearchshims_first_sse2, _bytesearchshims_last_sse2, _bytesearchshims_first_of_sse2, _bytesearchshims_last_of_sse2 };
+#elif BYTESEARCHSHIMS_NEON
+    return (_bytesearchshims_kernels){ _bytesearchshims_first_neon, _bytesearchshims_last_neon, _bytesearchshims_first_of_neon, _bytesearchshims_last_of_neon };
+#else
+    return (_bytesearchshims_kernels){ _bytesearchshims_first_none, _bytesearchshims_last_none, _bytesearchshims_first_of_none, _bytesearchshims_last_of_none };
+#endif
+}
+
+static size_t _bytesearchshims_first_resolve(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength);
+static size_t _bytesearchshims_last_resolve(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength);
+static size_t _bytesearchshims_first_of_resolve(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount);
+static size_t _bytesearchshims_last_of_resolve(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount);
+
+static _bytesearchshims_kernel _bytesearchshims_first_kernel = _bytesearchshims_first_resolve;
+static _bytesearchshims_kernel _bytesearchshims_last_kernel = _bytesearchshims_last_resolve;
+static _bytesearchshims_kernel _bytesearchshims_first_of_kernel = _bytesearchshims_first_of_resolve;
+static _bytesearchshims_kernel _bytesearchshims_last_of_kernel = _bytesearchshims_last_of_resolve;
+
+static void _bytesearchshims_resolve(void) {
+    const _bytesearchshims_kernels kernels = _bytesearchshims_select_kernels();
+    _CSHIMS_STORE_KERNEL(_bytesearchshims_first_kernel, kernels.first);
+    _CSHIMS_STORE_KERNEL(_bytesearchshims_last_kernel, kernels.last);
+    _CSHIMS_STORE_KERNEL(_bytesearchshims_first_of_kernel, kernels.firstOf);
+    _CSHIMS_STORE_KERNEL(_bytesearchshims_last_of_kernel, kernels.lastOf);
+}
+
+static size_t _bytesearchshims_first_resolve(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    _bytesearchshims_resolve();
+    return _bytesearchshims_first(haystack, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_last_resolve(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    _bytesearchshims_resolve();
+    return _bytesearchshims_last(haystack, length, needle, needleLength);
+}
+
+static size_t _bytesearchshims_first_of_resolve(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    _bytesearchshims_resolve();
+    return _bytesearchshims_first_of(bytes, length, set, setCount);
+}
+
+static size_t _bytesearchshims_last_of_resolve(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    _bytesearchshims_resolve();
+    return _bytesearchshims_last_of(bytes, length, set, setCount);
+}
+
+size_t _bytesearchshims_first(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    return _CSHIMS_LOAD_KERNEL(_bytesearchshims_first_kernel)(haystack, length, needle, needleLength);
+}
+
+size_t _bytesearchshims_last(const uint8_t *haystack, size_t length, const uint8_t *needle, size_t needleLength) {
+    return _CSHIMS_LOAD_KERNEL(_bytesearchshims_last_kernel)(haystack, length, needle, needleLength);
+}
+
+size_t _bytesearchshims_first_of(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    return _CSHIMS_LOAD_KERNEL(_bytesearchshims_first_of_kernel)(bytes, length, set, setCount);
+}
+
+size_t _bytesearchshims_last_of(const uint8_t *bytes, size_t length, const uint8_t *set, size_t setCount) {
+    return _CSHIMS_LOAD_KERNEL(_bytesearchshims_last_of_kernel)(bytes, length, set, setCount);
+}
@@ -0,0 +1,831 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/_CShimsTargetConditionals.h"
+#include "include/checksum_shims.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !TARGET_OS_WINDOWS
+#define CHECKSUMSHIMS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define CHECKSUMSHIMS_NEON 1
+#include <arm_neon.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define CHECKSUMSHIMS_ARM_CRC 1
+#include <arm_acle.h>
+#if TARGET_OS_LINUX
+#include <sys/auxv.h>
+#endif
+#endif
+#endif
+
+static inline uint32_t _checksumshims_read32(const uint8_t *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap32(value);
+#endif
+    return value;
+}
+
+static inline uint64_t _checksumshims_read64(const uint8_t *p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+static inline void _checksumshims_write64(uint8_t *p, uint64_t value) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    memcpy(p, &value, sizeof(value));
+}
+
+// MARK: - CRC-32C
+
+// The table for the reflected Castagnoli polynomial 0x82F63B78, for CPUs without CRC instructions.
+static const uint32_t _checksumshims_crc32c_table[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+
+typedef uint32_t (*_checksumshims_crc32c_kernel)(uint32_t, const uint8_t *, size_t);
+
+// The kernels take and return the CRC before the final inversion.
+static uint32_t _checksumshims_crc32c_table_kernel(uint32_t crc, const uint8_t *bytes, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        crc = _checksumshims_crc32c_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if CHECKSUMSHIMS_X86
+
+__attribute__((target("sse4.2")))
+static uint32_t _checksumshims_crc32c_sse42(uint32_t crc, const uint8_t *bytes, size_t length) {
+    uint64_t crc64 = crc;
+    while (length >= 8) {
+        crc64 = _mm_crc32_u64(crc64, _checksumshims_read64(bytes));
+        bytes += 8;
+        length -= 8;
+    }
+    crc = (uint32_t)crc64;
+    while (length > 0) {
+        crc = _mm_crc32_u8(crc, *bytes);
+        bytes++;
+        length--;
+    }
+    return crc;
+}
+
+#elif CHECKSUMSHIMS_ARM_CRC
+
+__attribute__((target("crc")))
+static uint32_t _checksumshims_crc32c_arm(uint32_t crc, const uint8_t *bytes, size_t length) {
+    while (length >= 8) {
+        crc = __crc32cd(crc, _checksumshims_read64(bytes));
+        bytes += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = __crc32cb(crc, *bytes);
+        bytes++;
+        length--;
+    }
+    return crc;
+}
+
+#endif
+
+// MARK: - XXH3
+
+// Constants and algorithm from the xxHash 0.8 specification (https://github.com/Cyan4973/xxHash).
+
+#define XXH_PRIME32_1 0x9E3779B1U
+#define XXH_PRIME32_2 0x85EBCA77U
+#define XXH_PRIME32_3 0xC2B2AE3DU
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+#define XXH_PRIME_MX1 0x165667919E3779F9ULL
+#define XXH_PRIME_MX2 0x9FB21C651E98DF25ULL
+
+#define XXH_STRIPE_LENGTH 64
+#define XXH_SECRET_LENGTH 192
+#define XXH_SECRET_CONSUME_RATE 8
+#define XXH_STRIPES_PER_BLOCK ((XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH) / XXH_SECRET_CONSUME_RATE)
+#define XXH_BUFFER_STRIPES (256 / XXH_STRIPE_LENGTH)
+#define XXH_MIDSIZE_MAX 240
+
+static const uint8_t _checksumshims_xxh3_default_secret[XXH_SECRET_LENGTH] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+typedef struct {
+    uint64_t low;
+    uint64_t high;
+} _checksumshims_u128;
+
+static inline _checksumshims_u128 _checksumshims_mul64to128(uint64_t a, uint64_t b) {
+    _checksumshims_u128 result;
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)a * b;
+    result.low = (uint64_t)product;
+    result.high = (uint64_t)(product >> 64);
+#else
+    uint64_t lolo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    uint64_t hilo = (a >> 32) * (b & 0xFFFFFFFF);
+    uint64_t lohi = (a & 0xFFFFFFFF) * (b >> 32);
+    uint64_t hihi = (a >> 32) * (b >> 32);
+    uint64_t cross = (lolo >> 32) + (hilo & 0xFFFFFFFF) + lohi;
+    result.low = (cross << 32) | (lolo & 0xFFFFFFFF);
+    result.high = (hilo >> 32) + (cross >> 32) + hihi;
+#endif
+    return result;
+}
+
+static inline uint64_t _checksumshims_mul128_fold64(uint64_t a, uint64_t b) {
+    _checksumshims_u128 product = _checksumshims_mul64to128(a, b);
+    return product.low ^ product.high;
+}
+
+static inline uint64_t _checksumshims_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint32_t _checksumshims_rotl32(uint32_t x, int r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+static inline uint64_t _checksumshims_xxh64_avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t _checksumshims_xxh3_avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= XXH_PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t _checksumshims_xxh3_rrmxmx(uint64_t h, uint64_t length) {
+    h ^= _checksumshims_rotl64(h, 49) ^ _checksumshims_rotl64(h, 24);
+    h *= XXH_PRIME_MX2;
+    h ^= (h >> 35) + length;
+    h *= XXH_PRIME_MX2;
+    h ^= h >> 28;
+    return h;
+}
+
+static inline uint64_t _checksumshims_xxh3_mix16(const uint8_t *input, const uint8_t *secret, uint64_t seed) {
+    uint64_t low = _checksumshims_read64(input);
+    uint64_t high = _checksumshims_read64(input + 8);
+    return _checksumshims_mul128_fold64(low ^ (_checksumshims_read64(secret) + seed), high ^ (_checksumshims_read64(secret + 8) - seed));
+}
+
+// MARK: XXH3 short inputs
+
+static uint64_t _checksumshims_xxh3_64_0to16(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    if (length > 8) {
+        uint64_t bitflip1 = (_checksumshims_read64(secret + 24) ^ _checksumshims_read64(secret + 32)) + seed;
+        uint64_t bitflip2 = (_checksumshims_read64(secret + 40) ^ _checksumshims_read64(secret + 48)) - seed;
+        uint64_t low = _checksumshims_read64(input) ^ bitflip1;
+        uint64_t high = _checksumshims_read64(input + length - 8) ^ bitflip2;
+        uint64_t acc = length + __builtin_bswap64(low) + high + _checksumshims_mul128_fold64(low, high);
+        return _checksumshims_xxh3_avalanche(acc);
+    }
+    if (length >= 4) {
+        seed ^= (uint64_t)__builtin_bswap32((uint32_t)seed) << 32;
+        uint32_t input1 = _checksumshims_read32(input);
+        uint32_t input2 = _checksumshims_read32(input + length - 4);
+        uint64_t bitflip = (_checksumshims_read64(secret + 8) ^ _checksumshims_read64(secret + 16)) - seed;
+        uint64_t input64 = input2 + ((uint64_t)input1 << 32);
+        return _checksumshims_xxh3_rrmxmx(input64 ^ bitflip, length);
+    }
+    if (length > 0) {
+        uint32_t combined = ((uint32_t)input[0] << 16) | ((uint32_t)input[length >> 1] << 24) | (uint32_t)input[length - 1] | ((uint32_t)length << 8);
+        uint64_t bitflip = (_checksumshims_read32(secret) ^ _checksumshims_read32(secret + 4)) + seed;
+        return _checksumshims_xxh64_avalanche((uint64_t)combined ^ bitflip);
+    }
+    return _checksumshims_xxh64_avalanche(seed ^ (_checksumshims_read64(secret + 56) ^ _checksumshims_read64(secret + 64)));
+}
+
+static uint64_t _checksumshims_xxh3_64_17to128(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    uint64_t acc = length * XXH_PRIME64_1;
+    if (length > 32) {
+        if (length > 64) {
+            if (length > 96) {
+                acc += _checksumshims_xxh3_mix16(input + 48, secret + 96, seed);
+                acc += _checksumshims_xxh3_mix16(input + length - 64, secret + 112, seed);
+            }
+            acc += _checksumshims_xxh3_mix16(input + 32, secret + 64, seed);
+            acc += _checksumshims_xxh3_mix16(input + length - 48, secret + 80, seed);
+        }
+        acc += _checksumshims_xxh3_mix16(input + 16, secret + 32, seed);
+        acc += _checksumshims_xxh3_mix16(input + length - 32, secret + 48, seed);
+    }
+    acc += _checksumshims_xxh3_mix16(input, secret, seed);
+    acc += _checksumshims_xxh3_mix16(input + length - 16, secret + 16, seed);
+    return _checksumshims_xxh3_avalanche(acc);
+}
+
+static uint64_t _checksumshims_xxh3_64_129to240(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    uint64_t acc = length * XXH_PRIME64_1;
+    size_t rounds = length / 16;
+    for (size_t i = 0; i < 8; i++) {
+        acc += _checksumshims_xxh3_mix16(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = _checksumshims_xxh3_avalanche(acc);
+    uint64_t accEnd = _checksumshims_xxh3_mix16(input + length - 16, secret + 136 - 17, seed);
+    for (size_t i = 8; i < rounds; i++) {
+        accEnd += _checksumshims_xxh3_mix16(input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+    }
+    return _checksumshims_xxh3_avalanche(acc + accEnd);
+}
+
+static _checksumshims_u128 _checksumshims_xxh3_128_0to16(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    _checksumshims_u128 result;
+    if (length > 8) {
+        uint64_t bitflipLow = (_checksumshims_read64(secret + 32) ^ _checksumshims_read64(secret + 40)) - seed;
+        uint64_t bitflipHigh = (_checksumshims_read64(secret + 48) ^ _checksumshims_read64(secret + 56)) + seed;
+        uint64_t inputLow = _checksumshims_read64(input);
+        uint64_t inputHigh = _checksumshims_read64(input + length - 8);
+        _checksumshims_u128 m = _checksumshims_mul64to128(inputLow ^ inputHigh ^ bitflipLow, XXH_PRIME64_1);
+        m.low += (uint64_t)(length - 1) << 54;
+        inputHigh ^= bitflipHigh;
+        m.high += inputHigh + (uint64_t)(uint32_t)inputHigh * (XXH_PRIME32_2 - 1);
+        m.low ^= __builtin_bswap64(m.high);
+        _checksumshims_u128 h = _checksumshims_mul64to128(m.low, XXH_PRIME64_2);
+        h.high += m.high * XXH_PRIME64_2;
+        result.low = _checksumshims_xxh3_avalanche(h.low);
+        result.high = _checksumshims_xxh3_avalanche(h.high);
+        return result;
+    }
+    if (length >= 4) {
+        seed ^= (uint64_t)__builtin_bswap32((uint32_t)seed) << 32;
+        uint32_t inputLow = _checksumshims_read32(input);
+        uint32_t inputHigh = _checksumshims_read32(input + length - 4);
+        uint64_t input64 = inputLow + ((uint64_t)inputHigh << 32);
+        uint64_t bitflip = (_checksumshims_read64(secret + 16) ^ _checksumshims_read64(secret + 24)) + seed;
+        _checksumshims_u128 m = _checksumshims_mul64to128(input64 ^ bitflip, XXH_PRIME64_1 + (length << 2));
+        m.high += m.low << 1;
+        m.low ^= m.high >> 3;
+        m.low ^= m.low >> 35;
+        m.low *= XXH_PRIME_MX2;
+        m.low ^= m.low >> 28;
+        result.low = m.low;
+        result.high = _checksumshims_xxh3_avalanche(m.high);
+        return result;
+    }
+    if (length > 0) {
+        uint32_t combinedLow = ((uint32_t)input[0] << 16) | ((uint32_t)input[length >> 1] << 24) | (uint32_t)input[length - 1] | ((uint32_t)length << 8);
+        uint32_t combinedHigh = _checksumshims_rotl32(__builtin_bswap32(combinedLow), 13);
+        uint64_t bitflipLow = (_checksumshims_read32(secret) ^ _checksumshims_read32(secret + 4)) + seed;
+        uint64_t bitflipHigh = (_checksumshims_read32(secret + 8) ^ _checksumshims_read32(secret + 12)) - seed;
+        result.low = _checksumshims_xxh64_avalanche((uint64_t)combinedLow ^ bitflipLow);
+        result.high = _checksumshims_xxh64_avalanche((uint64_t)combinedHigh ^ bitflipHigh);
+        return result;
+    }
+    result.low = _checksumshims_xxh64_avalanche(seed ^ _checksumshims_read64(secret + 64) ^ _checksumshims_read64(secret + 72));
+    result.high = _checksumshims_xxh64_avalanche(seed ^ _checksumshims_read64(secret + 80) ^ _checksumshims_read64(secret + 88));
+    return result;
+}
+
+static inline _checksumshims_u128 _checksumshims_xxh3_mix32(_checksumshims_u128 acc, const uint8_t *input1, const uint8_t *input2, const uint8_t *secret, uint64_t seed) {
+    acc.low += _checksumshims_xxh3_mix16(input1, secret, seed);
+    acc.low ^= _checksumshims_read64(input2) + _checksumshims_read64(input2 + 8);
+    acc.high += _checksumshims_xxh3_mix16(input2, secret + 16, seed);
+    acc.high ^= _checksumshims_read64(input1) + _checksumshims_read64(input1 + 8);
+    return acc;
+}
+
+static inline _checksumshims_u128 _checksumshims_xxh3_128_finish(_checksumshims_u128 acc, size_t length, uint64_t seed) {
+    _checksumshims_u128 result;
+    result.low = _checksumshims_xxh3_avalanche(acc.low + acc.high);
+    result.high = 0 - _checksumshims_xxh3_avalanche(acc.low * XXH_PRIME64_1 + acc.high * XXH_PRIME64_4 + (length - seed) * XXH_PRIME64_2);
+    return result;
+}
+
+static _checksumshims_u128 _checksumshims_xxh3_128_17to128(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    _checksumshims_u128 acc = { length * XXH_PRIME64_1, 0 };
+    if (length > 32) {
+        if (length > 64) {
+            if (length > 96) {
+                acc = _checksumshims_xxh3_mix32(acc, input + 48, input + length - 64, secret + 96, seed);
+            }
+            acc = _checksumshims_xxh3_mix32(acc, input + 32, input + length - 48, secret + 64, seed);
+        }
+        acc = _checksumshims_xxh3_mix32(acc, input + 16, input + length - 32, secret + 32, seed);
+    }
+    acc = _checksumshims_xxh3_mix32(acc, input, input + length - 16, secret, seed);
+    return _checksumshims_xxh3_128_finish(acc, length, seed);
+}
+
+static _checksumshims_u128 _checksumshims_xxh3_128_129to240(const uint8_t *input, size_t length, const uint8_t *secret, uint64_t seed) {
+    _checksumshims_u128 acc = { length * XXH_PRIME64_1, 0 };
+    for (size_t i = 32; i < 160; i += 32) {
+        acc = _checksumshims_xxh3_mix32(acc, input + i - 32, input + i - 16, secret + i - 32, seed);
+    }
+    acc.low = _checksumshims_xxh3_avalanche(acc.low);
+    acc.high = _checksumshims_xxh3_avalanche(acc.high);
+    for (size_t i = 160; i <= length; i += 32) {
+        acc = _checksumshims_xxh3_mix32(acc, input + i - 32, input + i - 16, secret + 3 + i - 160, seed);
+    }
+    acc = _checksumshims_xxh3_mix32(acc, input + length - 16, input + length - 32, secret + 136 - 17 - 16, 0 - seed);
+    return _checksumshims_xxh3_128_finish(acc, length, seed);
+}
+
+// MARK: XXH3 long inputs
+
+// A kernel folds `stripes` consecutive stripes of input into the accumulators, using the secret
+// starting at `secret` and advancing it by XXH_SECRET_CONSUME_RATE bytes per stripe.
+typedef void (*_checksumshims_xxh3_accumulate_kernel)(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes);
+typedef void (*_checksumshims_xxh3_scramble_kernel)(uint64_t *acc, const uint8_t *secret);
+
+#if !CHECKSUMSHIMS_X86 && !CHECKSUMSHIMS_NEON
+
+static void _checksumshims_xxh3_accumulate_scalar(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    for (size_t n = 0; n < stripes; n++) {
+        const uint8_t *stripe = input + n * XXH_STRIPE_LENGTH;
+        const uint8_t *key = secret + n * XXH_SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 8; i++) {
+            uint64_t value = _checksumshims_read64(stripe + 8 * i);
+            uint64_t keyed = value ^ _checksumshims_read64(key + 8 * i);
+            acc[i ^ 1] += value;
+            acc[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+        }
+    }
+}
+
+static void _checksumshims_xxh3_scramble_scalar(uint64_t *acc, const uint8_t *secret) {
+    for (size_t i = 0; i < 8; i++) {
+        uint64_t value = acc[i];
+        value ^= value >> 47;
+        value ^= _checksumshims_read64(secret + 8 * i);
+        value *= XXH_PRIME32_1;
+        acc[i] = value;
+    }
+}
+
+#elif CHECKSUMSHIMS_X86
+
+static void _checksumshims_xxh3_accumulate_sse2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    __m128i vacc[4];
+    for (size_t i = 0; i < 4; i++) {
+        vacc[i] = _mm_loadu_si128((const __m128i *)(acc + 2 * i));
+    }
+    for (size_t n = 0; n < stripes; n++) {
+        const uint8_t *stripe = input + n * XXH_STRIPE_LENGTH;
+        const uint8_t *key = secret + n * XXH_SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 4; i++) {
+            __m128i value = _mm_loadu_si128((const __m128i *)(stripe + 16 * i));
+            __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128((const __m128i *)(key + 16 * i)));
+            __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            vacc[i] = _mm_add_epi64(vacc[i], _mm_add_epi64(product, swapped));
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+        _mm_storeu_si128((__m128i *)(acc + 2 * i), vacc[i]);
+    }
+}
+
+static void _checksumshims_xxh3_scramble_sse2(uint64_t *acc, const uint8_t *secret) {
+    const __m128i prime = _mm_set1_epi32((int)XXH_PRIME32_1);
+    for (size_t i = 0; i < 4; i++) {
+        __m128i accumulator = _mm_loadu_si128((const __m128i *)(acc + 2 * i));
+        __m128i value = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+        __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128((const __m128i *)(secret + 16 * i)));
+        __m128i productLow = _mm_mul_epu32(keyed, prime);
+        __m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_storeu_si128((__m128i *)(acc + 2 * i), _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+    }
+}
+
+__attribute__((target("avx2")))
+static void _checksumshims_xxh3_accumulate_avx2(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    __m256i vacc[2] = { _mm256_loadu_si256((const __m256i *)acc), _mm256_loadu_si256((const __m256i *)(acc + 4)) };
+    for (size_t n = 0; n < stripes; n++) {
+        const uint8_t *stripe = input + n * XXH_STRIPE_LENGTH;
+        const uint8_t *key = secret + n * XXH_SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 2; i++) {
+            __m256i value = _mm256_loadu_si256((const __m256i *)(stripe + 32 * i));
+            __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256((const __m256i *)(key + 32 * i)));
+            __m256i product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            vacc[i] = _mm256_add_epi64(vacc[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+    _mm256_storeu_si256((__m256i *)acc, vacc[0]);
+    _mm256_storeu_si256((__m256i *)(acc + 4), vacc[1]);
+}
+
+__attribute__((target("avx2")))
+static void _checksumshims_xxh3_scramble_avx2(uint64_t *acc, const uint8_t *secret) {
+    const __m256i prime = _mm256_set1_epi32((int)XXH_PRIME32_1);
+    for (size_t i = 0; i < 2; i++) {
+        __m256i accumulator = _mm256_loadu_si256((const __m256i *)(acc + 4 * i));
+        __m256i value = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+        __m256i keyed = _mm256_xor_si256(value, _mm256_loadu_si256((const __m256i *)(secret + 32 * i)));
+        __m256i productLow = _mm256_mul_epu32(keyed, prime);
+        __m256i productHigh = _mm256_mul_epu32(_mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_storeu_si256((__m256i *)(acc + 4 * i), _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+    }
+}
+
+#elif CHECKSUMSHIMS_NEON
+
+static void _checksumshims_xxh3_accumulate_neon(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    uint64x2_t vacc[4];
+    for (size_t i = 0; i < 4; i++) {
+        vacc[i] = vld1q_u64(acc + 2 * i);
+    }
+    for (size_t n = 0; n < stripes; n++) {
+        const uint8_t *stripe = input + n * XXH_STRIPE_LENGTH;
+        const uint8_t *key = secret + n * XXH_SECRET_CONSUME_RATE;
+        for (size_t i = 0; i < 4; i++) {
+            uint64x2_t value = vreinterpretq_u64_u8(vld1q_u8(stripe + 16 * i));
+            uint64x2_t keyed = veorq_u64(value, vreinterpretq_u64_u8(vld1q_u8(key + 16 * i)));
+            vacc[i] = vaddq_u64(vacc[i], vextq_u64(value, value, 1));
+            vacc[i] = vmlal_u32(vacc[i], vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+        vst1q_u64(acc + 2 * i, vacc[i]);
+    }
+}
+
+static void _checksumshims_xxh3_scramble_neon(uint64_t *acc, const uint8_t *secret) {
+    const uint32x2_t prime = vdup_n_u32(XXH_PRIME32_1);
+    for (size_t i = 0; i < 4; i++) {
+        uint64x2_t accumulator = vld1q_u64(acc + 2 * i);
+        uint64x2_t value = veorq_u64(accumulator, vshrq_n_u64(accumulator, 47));
+        uint64x2_t keyed = veorq_u64(value, vreinterpretq_u64_u8(vld1q_u8(secret + 16 * i)));
+        uint64x2_t productHigh = vshlq_n_u64(vmull_u32(vshrn_n_u64(keyed, 32), prime), 32);
+        vst1q_u64(acc + 2 * i, vmlal_u32(productHigh, vmovn_u64(keyed), prime));
+    }
+}
+
+#endif
+
+// MARK: - Dispatch
+
+static void _checksumshims_select_kernels(_checksumshims_crc32c_kernel *crc32c, _checksumshims_xxh3_accumulate_kernel *accumulate, _checksumshims_xxh3_scramble_kernel *scramble) {
+    *crc32c = _checksumshims_crc32c_table_kernel;
+#if CHECKSUMSHIMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        *crc32c = _checksumshims_crc32c_sse42;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        *accumulate = _checksumshims_xxh3_accumulate_avx2;
+        *scramble = _checksumshims_xxh3_scramble_avx2;
+    } else {
+        *accumulate = _checksumshims_xxh3_accumulate_sse2;
+        *scramble = _checksumshims_xxh3_scramble_sse2;
+    }
+#elif CHECKSUMSHIMS_NEON
+#if CHECKSUMSHIMS_ARM_CRC
+#if TARGET_OS_MAC || defined(__ARM_FEATURE_CRC32)
+    // Every arm64 Apple CPU implements the CRC instructions.
+    *crc32c = _checksumshims_crc32c_arm;
+#elif TARGET_OS_LINUX && defined(HWCAP_CRC32)
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) {
+        *crc32c = _checksumshims_crc32c_arm;
+    }
+#endif
+#endif
+    *accumulate = _checksumshims_xxh3_accumulate_neon;
+    *scramble = _checksumshims_xxh3_scramble_neon;
+#else
+    *accumulate = _checksumshims_xxh3_accumulate_scalar;
+    *scramble = _checksumshims_xxh3_scramble_scalar;
+#endif
+}
+
+static uint32_t _checksumshims_crc32c_resolve(uint32_t crc, const uint8_t *bytes, size_t length);
+static void _checksumshims_xxh3_accumulate_resolve(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes);
+static void _checksumshims_xxh3_scramble_resolve(uint64_t *acc, const uint8_t *secret);
+
+static _checksumshims_crc32c_kernel _checksumshims_crc32c_kernel_ptr = _checksumshims_crc32c_resolve;
+static _checksumshims_xxh3_accumulate_kernel _checksumshims_xxh3_accumulate_kernel_ptr = _checksumshims_xxh3_accumulate_resolve;
+static _checksumshims_xxh3_scramble_kernel _checksumshims_xxh3_scramble_kernel_ptr = _checksumshims_xxh3_scramble_resolve;
+
+static void _checksumshims_resolve(void) {
+    _checksumshims_crc32c_kernel crc32c;
+    _checksumshims_xxh3_accumulate_kernel accumulate;
+    _checksumshims_xxh3_scramble_kernel scramble;
+    _checksumshims_select_kernels(&crc32c, &accumulate, &scramble);
+    _CSHIMS_STORE_KERNEL(_checksumshims_crc32c_kernel_ptr, crc32c);
+    _CSHIMS_STORE_KERNEL(_checksumshims_xxh3_accumulate_kernel_ptr, accumulate);
+    _CSHIMS_STORE_KERNEL(_checksumshims_xxh3_scramble_kernel_ptr, scramble);
+}
+
+static uint32_t _checksumshims_crc32c_resolve(uint32_t crc, const uint8_t *bytes, size_t length) {
+    _checksumshims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_checksumshims_crc32c_kernel_ptr)(crc, bytes, length);
+}
+
+static void _checksumshims_xxh3_accumulate_resolve(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    _checksumshims_resolve();
+    _CSHIMS_LOAD_KERNEL(_checksumshims_xxh3_accumulate_kernel_ptr)(acc, input, secret, stripes);
+}
+
+static void _checksumshims_xxh3_scramble_resolve(uint64_t *acc, const uint8_t *secret) {
+    _checksumshims_resolve();
+    _CSHIMS_LOAD_KERNEL(_checksumshims_xxh3_scramble_kernel_ptr)(acc, secret);
+}
+
+static inline void _checksumshims_xxh3_accumulate(uint64_t *acc, const uint8_t *input, const uint8_t *secret, size_t stripes) {
+    _CSHIMS_LOAD_KERNEL(_checksumshims_xxh3_accumulate_kernel_ptr)(acc, input, secret, stripes);
+}
+
+static inline void _checksumshims_xxh3_scramble(uint64_t *acc, const uint8_t *secret) {
+    _CSHIMS_LOAD_KERNEL(_checksumshims_xxh3_scramble_kernel_ptr)(acc, secret);
+}
+
+// MARK: - Public entry points
+
+uint32_t _checksumshims_crc32c(uint32_t crc, const uint8_t *bytes, size_t length) {
+    if (length == 0) {
+        return crc;
+    }
+    return ~_CSHIMS_LOAD_KERNEL(_checksumshims_crc32c_kernel_ptr)(~crc, bytes, length);
+}
+
+static inline void _checksumshims_xxh3_init_acc(uint64_t *acc) {
+    acc[0] = XXH_PRIME32_3;
+    acc[1] = XXH_PRIME64_1;
+    acc[2] = XXH_PRIME64_2;
+    acc[3] = XXH_PRIME64_3;
+    acc[4] = XXH_PRIME64_4;
+    acc[5] = XXH_PRIME32_2;
+    acc[6] = XXH_PRIME64_5;
+    acc[7] = XXH_PRIME32_1;
+}
+
+static void _checksumshims_xxh3_derive_secret(uint8_t *secret, uint64_t seed) {
+    for (size_t i = 0; i < XXH_SECRET_LENGTH; i += 16) {
+        _checksumshims_write64(secret + i, _checksumshims_read64(_checksumshims_xxh3_default_secret + i) + seed);
+        _checksumshims_write64(secret + i + 8, _checksumshims_read64(_checksumshims_xxh3_default_secret + i + 8) - seed);
+    }
+}
+
+// Folds an input of more than XXH_MIDSIZE_MAX bytes into `acc`, including its last stripe.
+static void _checksumshims_xxh3_hash_long(uint64_t *acc, const uint8_t *input, size_t length, const uint8_t *secret) {
+    const size_t blockLength = XXH_STRIPE_LENGTH * XXH_STRIPES_PER_BLOCK;
+    size_t blocks = (length - 1) / blockLength;
+    for (size_t n = 0; n < blocks; n++) {
+        _checksumshims_xxh3_accumulate(acc, input + n * blockLength, secret, XXH_STRIPES_PER_BLOCK);
+        _checksumshims_xxh3_scramble(acc, secret + XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH);
+    }
+    size_t stripes = ((length - 1) - blocks * blockLength) / XXH_STRIPE_LENGTH;
+    _checksumshims_xxh3_accumulate(acc, input + blocks * blockLength, secret, stripes);
+    _checksumshims_xxh3_accumulate(acc, input + length - XXH_STRIPE_LENGTH, secret + XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH - 7, 1);
+}
+
+static uint64_t _checksumshims_xxh3_merge(const uint64_t *acc, const uint8_t *secret, uint64_t start) {
+    uint64_t result = start;
+    for (size_t i = 0; i < 4; i++) {
+        result += _checksumshims_mul128_fold64(acc[2 * i] ^ _checksumshims_read64(secret + 16 * i), acc[2 * i + 1] ^ _checksumshims_read64(secret + 16 * i + 8));
+    }
+    return _checksumshims_xxh3_avalanche(result);
+}
+
+static inline uint64_t _checksumshims_xxh3_merge64(const uint64_t *acc, const uint8_t *secret, uint64_t length) {
+    return _checksumshims_xxh3_merge(acc, secret + 11, length * XXH_PRIME64_1);
+}
+
+static inline _checksumshims_u128 _checksumshims_xxh3_merge128(const uint64_t *acc, const uint8_t *secret, uint64_t length) {
+    _checksumshims_u128 result;
+    result.low = _checksumshims_xxh3_merge(acc, secret + 11, length * XXH_PRIME64_1);
+    result.high = _checksumshims_xxh3_merge(acc, secret + XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH - 11, ~(length * XXH_PRIME64_2));
+    return result;
+}
+
+// Inputs up to XXH_MIDSIZE_MAX bytes always use the default secret, combined with the seed.
+static uint64_t _checksumshims_xxh3_64_short(const uint8_t *input, size_t length, uint64_t seed) {
+    const uint8_t *secret = _checksumshims_xxh3_default_secret;
+    if (length <= 16) {
+        return _checksumshims_xxh3_64_0to16(input, length, secret, seed);
+    } else if (length <= 128) {
+        return _checksumshims_xxh3_64_17to128(input, length, secret, seed);
+    } else {
+        return _checksumshims_xxh3_64_129to240(input, length, secret, seed);
+    }
+}
+
+static _checksumshims_u128 _checksumshims_xxh3_128_short(const uint8_t *input, size_t length, uint64_t seed) {
+    const uint8_t *secret = _checksumshims_xxh3_default_secret;
+    if (length <= 16) {
+        return _checksumshims_xxh3_128_0to16(input, length, secret, seed);
+    } else if (length <= 128) {
+        return _checksumshims_xxh3_128_17to128(input, length, secret, seed);
+    } else {
+        return _checksumshims_xxh3_128_129to240(input, length, secret, seed);
+    }
+}
+
+uint64_t _checksumshims_xxh3_64(const uint8_t *bytes, size_t length, uint64_t seed) {
+    if (length <= XXH_MIDSIZE_MAX) {
+        return _checksumshims_xxh3_64_short(bytes, length, seed);
+    }
+    uint8_t derived[XXH_SECRET_LENGTH];
+    const uint8_t *secret = _checksumshims_xxh3_default_secret;
+    if (seed != 0) {
+        _checksumshims_xxh3_derive_secret(derived, seed);
+        secret = derived;
+    }
+    uint64_t acc[8];
+    _checksumshims_xxh3_init_acc(acc);
+    _checksumshims_xxh3_hash_long(acc, bytes, length, secret);
+    return _checksumshims_xxh3_merge64(acc, secret, length);
+}
+
+void _checksumshims_xxh3_128(const uint8_t *bytes, size_t length, uint64_t seed, uint64_t *low, uint64_t *high) {
+    _checksumshims_u128 result;
+    if (length <= XXH_MIDSIZE_MAX) {
+        result = _checksumshims_xxh3_128_short(bytes, length, seed);
+    } else {
+        uint8_t derived[XXH_SECRET_LENGTH];
+        const uint8_t *secret = _checksumshims_xxh3_default_secret;
+        if (seed != 0) {
+            _checksumshims_xxh3_derive_secret(derived, seed);
+            secret = derived;
+        }
+        uint64_t acc[8];
+        _checksumshims_xxh3_init_acc(acc);
+        _checksumshims_xxh3_hash_long(acc, bytes, length, secret);
+        result = _checksumshims_xxh3_merge128(acc, secret, length);
+    }
+    *low = result.low;
+    *high = result.high;
+}
+
+// MARK: XXH3 streaming
+
+void _checksumshims_xxh3_reset(_checksumshims_xxh3_state *state, uint64_t seed) {
+    _checksumshims_xxh3_init_acc(state->acc);
+    if (seed != 0) {
+        _checksumshims_xxh3_derive_secret(state->secret, seed);
+    } else {
+        memcpy(state->secret, _checksumshims_xxh3_default_secret, XXH_SECRET_LENGTH);
+    }
+    state->seed = seed;
+    state->totalLength = 0;
+    state->bufferedLength = 0;
+    state->stripesInBlock = 0;
+}
+
+// Folds `stripes` stripes into `acc`, scrambling whenever a block of the secret is used up.
+static void _checksumshims_xxh3_consume_stripes(uint64_t *acc, uint32_t *stripesInBlock, const uint8_t *input, size_t stripes, const uint8_t *secret) {
+    size_t toEndOfBlock = XXH_STRIPES_PER_BLOCK - *stripesInBlock;
+    if (toEndOfBlock <= stripes) {
+        _checksumshims_xxh3_accumulate(acc, input, secret + *stripesInBlock * XXH_SECRET_CONSUME_RATE, toEndOfBlock);
+        _checksumshims_xxh3_scramble(acc, secret + XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH);
+        _checksumshims_xxh3_accumulate(acc, input + toEndOfBlock * XXH_STRIPE_LENGTH, secret, stripes - toEndOfBlock);
+        *stripesInBlock = (uint32_t)(stripes - toEndOfBlock);
+    } else {
+        _checksumshims_xxh3_accumulate(acc, input, secret + *stripesInBlock * XXH_SECRET_CONSUME_RATE, stripes);
+        *stripesInBlock += (uint32_t)stripes;
+    }
+}
+
+void _checksumshims_xxh3_update(_checksumshims_xxh3_state *state, const uint8_t *bytes, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    const uint8_t *end = bytes + length;
+    state->totalLength += length;
+
+    if (length <= sizeof(state->buffer) - state->bufferedLength) {
+        memcpy(state->buffer + state->bufferedLength, bytes, length);
+        state->bufferedLength += (uint32_t)length;
+        return;
+    }
+
+    // At least one byte always stays buffered, so that the digest can treat the end of the input
+    // as the last stripe.
+    if (state->bufferedLength > 0) {
+        size_t fill = sizeof(state->buffer) - state->bufferedLength;
+        memcpy(state->buffer + state->bufferedLength, bytes, fill);
+        bytes += fill;
+        _checksumshims_xxh3_consume_stripes(state->acc, &state->stripesInBlock, state->buffer, XXH_BUFFER_STRIPES, state->secret);
+        state->bufferedLength = 0;
+    }
+
+    if ((size_t)(end - bytes) > sizeof(state->buffer)) {
+        const uint8_t *limit = end - sizeof(state->buffer);
+        do {
+            _checksumshims_xxh3_consume_stripes(state->acc, &state->stripesInBlock, bytes, XXH_BUFFER_STRIPES, state->secret);
+            bytes += sizeof(state->buffer);
+        } while (bytes < limit);
+        // Keep the stripe before the remainder for a digest that needs to look back.
+        memcpy(state->buffer + sizeof(state->buffer) - XXH_STRIPE_LENGTH, bytes - XXH_STRIPE_LENGTH, XXH_STRIPE_LENGTH);
+    }
+
+    memcpy(state->buffer, bytes, (size_t)(end - bytes));
+    state->bufferedLength = (uint32_t)(end - bytes);
+}
+
+static void _checksumshims_xxh3_digest_long(const _checksumshims_xxh3_state *state, uint64_t *acc) {
+    memcpy(acc, state->acc, sizeof(state->acc));
+    const uint8_t *lastStripeSecret = state->secret + XXH_SECRET_LENGTH - XXH_STRIPE_LENGTH - 7;
+    if (state->bufferedLength >= XXH_STRIPE_LENGTH) {
+        size_t stripes = (state->bufferedLength - 1) / XXH_STRIPE_LENGTH;
+        uint32_t stripesInBlock = state->stripesInBlock;
+        _checksumshims_xxh3_consume_stripes(acc, &stripesInBlock, state->buffer, stripes, state->secret);
+        _checksumshims_xxh3_accumulate(acc, state->buffer + state->bufferedLength - XXH_STRIPE_LENGTH, lastStripeSecret, 1);
+    } else {
+        // The last stripe begins in the bytes that were consumed before the buffered ones.
+        uint8_t lastStripe[XXH_STRIPE_LENGTH];
+        size_t lookBack = XXH_STRIPE_LENGTH - state->bufferedLength;
+        memcpy(lastStripe, state->buffer + sizeof(state->buffer) - lookBack, lookBack);
+        memcpy(lastStripe + lookBack, state->buffer, state->bufferedLength);
+        _checksumshims_xxh3_accumulate(acc, lastStripe, lastStripeSecret, 1);
+    }
+}
+
+uint64_t _checksumshims_xxh3_digest64(const _checksumshims_xxh3_state *state) {
+    if (state->totalLength <= XXH_MIDSIZE_MAX) {
+        return _checksumshims_xxh3_64_short(state->buffer, (size_t)state->totalLength, state->seed);
+    }
+    uint64_t acc[8];
+    _checksumshims_xxh3_digest_long(state, acc);
+    return _checksumshims_xxh3_merge64(acc, state->secret, state->totalLength);
+}
+
+void _checksumshims_xxh3_digest128(const _checksumshims_xxh3_state *state, uint64_t *low, uint64_t *high) {
+    _checksumshims_u128 result;
+    if (state->totalLength <= XXH_MIDSIZE_MAX) {
+        result = _checksumshims_xxh3_128_short(state->buffer, (size_t)state->totalLength, state->seed);
+    } else {
+        uint64_t acc[8];
+        _checksumshims_xxh3_digest_long(state, acc);
+        result = _checksumshims_xxh3_merge128(acc, state->secret, state->totalLength);
+    }
+    *low = result.low;
+    *high = result.high;
+}
@@ -21,4 +21,9 @@
 #define INTERNAL extern
 #endif
 
+// Shims that pick a vector kernel at run time call it through a function pointer that starts out pointing at a resolver,
+// which stores the selected kernel on first use. Racing resolvers store identical values, so relaxed ordering is sufficient.
+#define _CSHIMS_LOAD_KERNEL(pointer) __atomic_load_n(&(pointer), __ATOMIC_RELAXED)
+#define _CSHIMS_STORE_KERNEL(pointer, kernel) __atomic_store_n(&(pointer), (kernel), __ATOMIC_RELAXED)
+
 #endif
@@ -19,6 +19,11 @@
 #include "CFUniCharBitmapData.h"
 #include "CFUniCharBitmapDataAccess.h"
 #include "string_shims.h"
+#include "ascii_shims.h"
+#include "base64_shims.h"
+#include "bytesearch_shims.h"
+#include "checksum_shims.h"
+#include "transcode_shims.h"
 #include "bplist_shims.h"
 #include "io_shims.h"
 #include "platform_shims.h"
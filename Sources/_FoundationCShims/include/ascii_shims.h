@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CSHIMS_ASCII_H
+#define CSHIMS_ASCII_H
+
+#include "_CShimsMacros.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Kernels for comparing and searching ASCII text, optionally ignoring case, 16 or 32 bytes at a
+// time. Folding only maps 'A'...'Z' to 'a'...'z'; callers handle everything outside ASCII. The
+// kernel matching the host CPU (AVX2, SSE2 or NEON) is selected on first use.
+
+/// Returns the offset of the first byte of `bytes` that is not ASCII, or `length` if there is none.
+INTERNAL size_t _asciishims_first_nonascii(const uint8_t * _Nonnull bytes, size_t length);
+
+/// Returns the length of the longest common prefix of `a` and `b` that is entirely ASCII, comparing
+/// letters without regard to case if `foldCase` is true.
+INTERNAL size_t _asciishims_common_prefix(const uint8_t * _Nonnull a, const uint8_t * _Nonnull b, size_t length, bool foldCase);
+
+/// Returns the offset of the first occurrence of `needle` in `haystack` at or after `from`, or
+/// `length` if there is none, comparing letters without regard to case if `foldCase` is true.
+/// `needleLength` must be at least 1.
+INTERNAL size_t _asciishims_first(const uint8_t * _Nonnull haystack, size_t from, size_t length, const uint8_t * _Nonnull needle, size_t needleLength, bool foldCase);
+
+/// Returns the offset of the last occurrence of `needle` in `haystack` that starts before `to`, or
+/// `length` if there is none, comparing letters without regard to case if `foldCase` is true.
+/// `needleLength` must be at least 1.
+INTERNAL size_t _asciishims_last(const uint8_t * _Nonnull haystack, size_t to, size_t length, const uint8_t * _Nonnull needle, size_t needleLength, bool foldCase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSHIMS_ASCII_H */
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CSHIMS_BASE64_H
+#define CSHIMS_BASE64_H
+
+#include "_CShimsMacros.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Vectorized base64 kernels. The kernel matching the host CPU (AVX-512VBMI, AVX2 or NEON) is
+// selected on first use. These only process whole vector blocks; the caller is expected to finish
+// the remaining bytes, padding and error reporting with the scalar implementation.
+
+/// Encodes whole 3 byte groups of `input` into `output` and returns the number of input bytes that
+/// were consumed. Exactly `consumed / 3 * 4` bytes are written to `output`. Returns 0 if no vector
+/// unit is available or the input is shorter than one block.
+INTERNAL size_t _base64shims_encode(const uint8_t * _Nonnull input, size_t length, uint8_t * _Nonnull output, bool urlAlphabet);
+
+/// Decodes whole 4 character groups of `input` into `output` and returns the number of input bytes
+/// that were consumed. Exactly `consumed / 4 * 3` bytes are written to `output`. Decoding stops
+/// in front of the first block that contains a character outside of the alphabet, including the
+/// padding character.
+INTERNAL size_t _base64shims_decode(const uint8_t * _Nonnull input, size_t length, uint8_t * _Nonnull output, bool urlAlphabet);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSHIMS_BASE64_H */
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CSHIMS_BYTESEARCH_H
+#define CSHIMS_BYTESEARCH_H
+
+#include "_CShimsMacros.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Substring search for short needles. Candidate positions are found by comparing a vector of
+// haystack bytes against the first and the last byte of the needle at the same time, and only the
+// positions where both match are verified. The kernel matching the host CPU (AVX2, SSE2 or NEON) is
+// selected on first use.
+
+/// Returns the offset of the first occurrence of `needle` in `haystack`, or `length` if there is
+/// none. `needleLength` must be at least 2.
+INTERNAL size_t _bytesearchshims_first(const uint8_t * _Nonnull haystack, size_t length, const uint8_t * _Nonnull needle, size_t needleLength);
+
+/// Returns the offset of the last occurrence of `needle` in `haystack`, or `length` if there is
+/// none. `needleLength` must be at least 2.
+INTERNAL size_t _bytesearchshims_last(const uint8_t * _Nonnull haystack, size_t length, const uint8_t * _Nonnull needle, size_t needleLength);
+
+// Searches for any one of a small set of bytes, such as the code units that can start or end a
+// line separator, comparing a vector of bytes against each member of the set.
+
+/// Returns the offset of the first byte of `bytes` that is in `set`, or `length` if there is none.
+/// `setCount` must be between 1 and 5.
+INTERNAL size_t _bytesearchshims_first_of(const uint8_t * _Nonnull bytes, size_t length, const uint8_t * _Nonnull set, size_t setCount);
+
+/// Returns the offset of the last byte of `bytes` that is in `set`, or `length` if there is none.
+/// `setCount` must be between 1 and 5.
+INTERNAL size_t _bytesearchshims_last_of(const uint8_t * _Nonnull bytes, size_t length, const uint8_t * _Nonnull set, size_t setCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSHIMS_BYTESEARCH_H */
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CSHIMS_CHECKSUM_H
+#define CSHIMS_CHECKSUM_H
+
+#include "_CShimsMacros.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Non-cryptographic checksums. CRC-32C uses the SSE4.2 or ARMv8 CRC instructions when the host CPU
+// has them, and XXH3 (as specified by xxHash 0.8) uses AVX2, SSE2 or NEON for inputs longer than
+// 240 bytes. The kernels are selected on first use.
+
+/// Returns the CRC-32C (Castagnoli) of `bytes`, continuing from `crc`, which is the CRC-32C of the
+/// bytes that come before them, or 0 for the first call.
+INTERNAL uint32_t _checksumshims_crc32c(uint32_t crc, const uint8_t * _Nullable bytes, size_t length);
+
+/// The state of an incremental XXH3 computation. Treat it as opaque.
+typedef struct {
+    uint64_t acc[8];
+    uint8_t secret[192];
+    uint8_t buffer[256];
+    uint64_t seed;
+    uint64_t totalLength;
+    uint32_t bufferedLength;
+    uint32_t stripesInBlock;
+} _checksumshims_xxh3_state;
+
+/// Prepares `state` for a new XXH3 computation with `seed`.
+INTERNAL void _checksumshims_xxh3_reset(_checksumshims_xxh3_state * _Nonnull state, uint64_t seed);
+
+/// Adds `bytes` to the input of the computation in `state`.
+INTERNAL void _checksumshims_xxh3_update(_checksumshims_xxh3_state * _Nonnull state, const uint8_t * _Nullable bytes, size_t length);
+
+/// Returns the XXH3-64 of the input so far. `state` is not modified and may be updated further.
+INTERNAL uint64_t _checksumshims_xxh3_digest64(const _checksumshims_xxh3_state * _Nonnull state);
+
+/// Stores the XXH3-128 of the input so far in `low` and `high`. `state` is not modified and may be
+/// updated further.
+INTERNAL void _checksumshims_xxh3_digest128(const _checksumshims_xxh3_state * _Nonnull state, uint64_t * _Nonnull low, uint64_t * _Nonnull high);
+
+/// Returns the XXH3-64 of `bytes`.
+INTERNAL uint64_t _checksumshims_xxh3_64(const uint8_t * _Nullable bytes, size_t length, uint64_t seed);
+
+/// Stores the XXH3-128 of `bytes` in `low` and `high`.
+INTERNAL void _checksumshims_xxh3_128(const uint8_t * _Nullable bytes, size_t length, uint64_t seed, uint64_t * _Nonnull low, uint64_t * _Nonnull high);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSHIMS_CHECKSUM_H */
@@ -14,6 +14,7 @@
 #ifndef IOShims_h
 #define IOShims_h
 
+#include "_CShimsMacros.h"
 #include "_CShimsTargetConditionals.h"
 
 #if TARGET_OS_MAC && (!defined(TARGET_OS_EXCLAVEKIT) || !TARGET_OS_EXCLAVEKIT)
@@ -75,4 +76,31 @@ static inline intptr_t _ioshims_reparse_data_buffer_mountpointreparsebuffer_path
 }
 
 #endif
+
+#if TARGET_OS_LINUX
+
+#include <sys/types.h>
+
+// O_TMPFILE, fallocate and mremap are only declared for _GNU_SOURCE, so they are wrapped here.
+
+/// Opens an unnamed regular file in the directory `dirfd` for writing. Returns -1 and sets `errno` if the
+/// kernel or the file system does not support unnamed temporary files.
+INTERNAL int _ioshims_open_tmpfile(int dirfd, mode_t mode);
+
+/// Gives the unnamed file `fd` the name `name` in the directory `dirfd`. Like `linkat`, this fails with
+/// `EEXIST` if the name is taken.
+INTERNAL int _ioshims_link_tmpfile(int fd, int dirfd, const char * _Nonnull name);
+
+/// Checks that `_ioshims_link_tmpfile` can reach the unnamed file `fd`, which needs `/proc` to be mounted.
+/// Like `access`, returns 0 on success and -1 otherwise.
+INTERNAL int _ioshims_access_tmpfile(int fd);
+
+/// Allocates the blocks for the first `length` bytes of `fd`, extending the file size as needed.
+INTERNAL int _ioshims_fallocate(int fd, off_t length);
+
+/// Resizes the anonymous mapping at `address` from `size` to `newSize` bytes, moving it if it cannot grow in
+/// place. Returns the new address, or NULL and sets `errno` on failure, in which case the mapping is unchanged.
+INTERNAL void * _Nullable _ioshims_mremap(void * _Nonnull address, size_t size, size_t newSize);
+
+#endif // TARGET_OS_LINUX
 #endif /* IOShims_h */
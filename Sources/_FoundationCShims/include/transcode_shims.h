@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CSHIMS_TRANSCODE_H
+#define CSHIMS_TRANSCODE_H
+
+#include "_CShimsMacros.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Transcoders between UTF-8 and UTF-16 or UTF-32 in either byte order. Neither side needs to be
+// aligned. Runs of ASCII are converted 16 or 32 code units at a time by the kernel matching the
+// host CPU (AVX2, SSE2 or NEON), which is selected on first use.
+
+/// Transcodes `units` UTF-16 code units at `source`, which are big-endian if `bigEndian` is true
+/// and little-endian otherwise, to UTF-8 at `destination`, which must have room for `3 * units`
+/// bytes. Returns false if the input is not valid UTF-16, otherwise stores the number of bytes
+/// written in `length`.
+INTERNAL bool _transcodeshims_utf16_to_utf8(const uint8_t * _Nonnull source, size_t units, bool bigEndian, uint8_t * _Nonnull destination, size_t * _Nonnull length);
+
+/// Transcodes `units` UTF-32 code units at `source`, which are big-endian if `bigEndian` is true
+/// and little-endian otherwise, to UTF-8 at `destination`, which must have room for `4 * units`
+/// bytes. Returns false if the input is not valid UTF-32, otherwise stores the number of bytes
+/// written in `length`.
+INTERNAL bool _transcodeshims_utf32_to_utf8(const uint8_t * _Nonnull source, size_t units, bool bigEndian, uint8_t * _Nonnull destination, size_t * _Nonnull length);
+
+/// Transcodes `length` bytes of valid UTF-8 at `source` to UTF-16 at `destination`, big-endian if
+/// `bigEndian` is true and little-endian otherwise. `destination` must have room for the UTF-16
+/// form, which is at most `2 * length` bytes. Returns the number of bytes written.
+INTERNAL size_t _transcodeshims_utf8_to_utf16(const uint8_t * _Nonnull source, size_t length, bool bigEndian, uint8_t * _Nonnull destination);
+
+/// Transcodes `length` bytes of valid UTF-8 at `source` to UTF-32 at `destination`, big-endian if
+/// `bigEndian` is true and little-endian otherwise. `destination` must have room for the UTF-32
+/// form, which is at most `4 * length` bytes. Returns the number of bytes written.
+INTERNAL size_t _transcodeshims_utf8_to_utf32(const uint8_t * _Nonnull source, size_t length, bool bigEndian, uint8_t * _Nonnull destination);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSHIMS_TRANSCODE_H */
@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "include/io_shims.h"
+
+#if TARGET_OS_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+int _ioshims_open_tmpfile(int dirfd, mode_t mode) {
+#if defined(O_TMPFILE)
+    return openat(dirfd, ".", O_TMPFILE | O_WRONLY | O_CLOEXEC, mode);
+#else
+    errno = EOPNOTSUPP;
+    return -1;
+#endif
+}
+
+int _ioshims_link_tmpfile(int fd, int dirfd, const char *name) {
+    // linkat(fd, "", ..., AT_EMPTY_PATH) requires CAP_DAC_READ_SEARCH, while linking the /proc entry of the
+    // descriptor works for any process that can write to the directory.
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    return linkat(AT_FDCWD, path, dirfd, name, AT_SYMLINK_FOLLOW);
+}
+
+int _ioshims_access_tmpfile(int fd) {
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    return faccessat(AT_FDCWD, path, F_OK, 0);
+}
+
+int _ioshims_fallocate(int fd, off_t length) {
+    return fallocate(fd, 0, 0, length);
+}
+
+void *_ioshims_mremap(void *address, size_t size, size_t newSize) {
+    void *result = mremap(address, size, newSize, MREMAP_MAYMOVE);
+    return result == MAP_FAILED ? NULL : result;
+}
+
+#endif // TARGET_OS_LINUX
@@ -0,0 +1,528 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "include/_CShimsTargetConditionals.h"
+#include "include/transcode_shims.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+// The transcoders are scalar loops that hand runs of ASCII to a vector kernel. A kernel converts
+// whole blocks of code units for as long as every unit in the block is ASCII, and returns how many
+// it converted, leaving the block that holds the first non-ASCII unit to the scalar loop.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !TARGET_OS_WINDOWS
+#define TRANSCODESHIMS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define TRANSCODESHIMS_NEON 1
+#include <arm_neon.h>
+#endif
+
+// After a kernel stops, the scalar loop converts at least this many units before returning to the
+// kernel, so text with only occasional ASCII does not call the kernel for every space.
+#define TRANSCODESHIMS_SCALAR_RUN 16
+
+typedef size_t (*_transcodeshims_kernel)(const uint8_t *, size_t, bool, uint8_t *);
+
+static inline uint32_t _transcodeshims_load16(const uint8_t *source, bool bigEndian) {
+    return bigEndian ? ((uint32_t)source[0] << 8 | source[1]) : ((uint32_t)source[1] << 8 | source[0]);
+}
+
+static inline uint32_t _transcodeshims_load32(const uint8_t *source, bool bigEndian) {
+    if (bigEndian) {
+        return (uint32_t)source[0] << 24 | (uint32_t)source[1] << 16 | (uint32_t)source[2] << 8 | source[3];
+    }
+    return (uint32_t)source[3] << 24 | (uint32_t)source[2] << 16 | (uint32_t)source[1] << 8 | source[0];
+}
+
+static inline void _transcodeshims_store16(uint8_t *destination, uint32_t unit, bool bigEndian) {
+    destination[bigEndian ? 0 : 1] = (uint8_t)(unit >> 8);
+    destination[bigEndian ? 1 : 0] = (uint8_t)unit;
+}
+
+static inline void _transcodeshims_store32(uint8_t *destination, uint32_t unit, bool bigEndian) {
+    for (size_t k = 0; k < 4; k++) {
+        destination[bigEndian ? 3 - k : k] = (uint8_t)(unit >> (8 * k));
+    }
+}
+
+// Writes the UTF-8 form of the non-ASCII scalar `scalar` and returns its length.
+static inline size_t _transcodeshims_encode_utf8(uint8_t *destination, uint32_t scalar) {
+    if (scalar < 0x800) {
+        destination[0] = (uint8_t)(0xC0 | scalar >> 6);
+        destination[1] = (uint8_t)(0x80 | (scalar & 0x3F));
+        return 2;
+    } else if (scalar < 0x10000) {
+        destination[0] = (uint8_t)(0xE0 | scalar >> 12);
+        destination[1] = (uint8_t)(0x80 | (scalar >> 6 & 0x3F));
+        destination[2] = (uint8_t)(0x80 | (scalar & 0x3F));
+        return 3;
+    } else {
+        destination[0] = (uint8_t)(0xF0 | scalar >> 18);
+        destination[1] = (uint8_t)(0x80 | (scalar >> 12 & 0x3F));
+        destination[2] = (uint8_t)(0x80 | (scalar >> 6 & 0x3F));
+        destination[3] = (uint8_t)(0x80 | (scalar & 0x3F));
+        return 4;
+    }
+}
+
+// Reads the non-ASCII scalar of valid UTF-8 that starts at `source` and stores its length.
+static inline uint32_t _transcodeshims_decode_utf8(const uint8_t *source, size_t *length) {
+    const uint8_t lead = source[0];
+    if (lead < 0xE0) {
+        *length = 2;
+        return (uint32_t)(lead & 0x1F) << 6 | (source[1] & 0x3F);
+    } else if (lead < 0xF0) {
+        *length = 3;
+        return (uint32_t)(lead & 0x0F) << 12 | (uint32_t)(source[1] & 0x3F) << 6 | (source[2] & 0x3F);
+    } else {
+        *length = 4;
+        return (uint32_t)(lead & 0x07) << 18 | (uint32_t)(source[1] & 0x3F) << 12 | (uint32_t)(source[2] & 0x3F) << 6 | (source[3] & 0x3F);
+    }
+}
+
+#if !TRANSCODESHIMS_X86 && !TRANSCODESHIMS_NEON
+// Without vectors the scalar loops handle ASCII as well
+static size_t _transcodeshims_none(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination) {
+    return 0;
+}
+#endif
+
+// MARK: - x86
+
+#if TRANSCODESHIMS_X86
+
+static inline __m128i _transcodeshims_swap16_sse2(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static inline __m128i _transcodeshims_swap32_sse2(__m128i v) {
+    return _transcodeshims_swap16_sse2(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1));
+}
+
+// UTF-16 to UTF-8, 16 units at a time
+static size_t _transcodeshims_narrow16_sse2(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination) {
+    const __m128i nonASCII = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= units; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(source + 2 * i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(source + 2 * i + 16));
+        if (bigEndian) {
+            a = _transcodeshims_swap16_sse2(a);
+            b = _transcodeshims_swap16_sse2(b);
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), nonASCII), zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(destination + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+// UTF-32 to UTF-8, 16 units at a time
+static size_t _transcodeshims_narrow32_sse2(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination) {
+    const __m128i nonASCII = _mm_set1_epi32((int)0xFFFFFF80);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= units; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(source + 4 * i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(source + 4 * i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(source + 4 * i + 32));
+        __m128i d = _mm_loadu_si128((const __m128i *)(source + 4 * i + 48));
+        if (bigEndian) {
+            a = _transcodeshims_swap32_sse2(a);
+            b = _transcodeshims_swap32_sse2(b);
+            c = _transcodeshims_swap32_sse2(c);
+            d = _transcodeshims_swap32_sse2(d);
+        }
+        const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, nonASCII), zero)) != 0xFFFF) {
+            break;
+        }
+        // Every unit is below 0x80, so neither pack saturates
+        _mm_storeu_si128((__m128i *)(destination + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    return i;
+}
+
+// UTF-8 to UTF-16, 16 bytes at a time
+static size_t _transcodeshims_widen16_sse2(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(source + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        // Interleaving with zero bytes first puts the zero in the high byte for big-endian output
+        const __m128i low = bigEndian ? _mm_unpacklo_epi8(zero, v) : _mm_unpacklo_epi8(v, zero);
+        const __m128i high = bigEndian ? _mm_unpackhi_epi8(zero, v) : _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128((__m128i *)(destination + 2 * i), low);
+        _mm_storeu_si128((__m128i *)(destination + 2 * i + 16), high);
+    }
+    return i;
+}
+
+// UTF-8 to UTF-32, 16 bytes at a time
+static size_t _transcodeshims_widen32_sse2(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(source + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        const __m128i low = bigEndian ? _mm_unpacklo_epi8(zero, v) : _mm_unpacklo_epi8(v, zero);
+        const __m128i high = bigEndian ? _mm_unpackhi_epi8(zero, v) : _mm_unpackhi_epi8(v, zero);
+        __m128i *out = (__m128i *)(destination + 4 * i);
+        _mm_storeu_si128(out, bigEndian ? _mm_unpacklo_epi16(zero, low) : _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, bigEndian ? _mm_unpackhi_epi16(zero, low) : _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, bigEndian ? _mm_unpacklo_epi16(zero, high) : _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, bigEndian ? _mm_unpackhi_epi16(zero, high) : _mm_unpackhi_epi16(high, zero));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static inline __m256i _transcodeshims_swap16_avx2(__m256i v) {
+    return _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8));
+}
+
+// UTF-16 to UTF-8, 32 units at a time
+__attribute__((target("avx2")))
+static size_t _transcodeshims_narrow16_avx2(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination) {
+    const __m256i nonASCII = _mm256_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 32 <= units; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(source + 2 * i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(source + 2 * i + 32));
+        if (bigEndian) {
+            a = _transcodeshims_swap16_avx2(a);
+            b = _transcodeshims_swap16_avx2(b);
+        }
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), nonASCII)) {
+            break;
+        }
+        // The pack works within 128-bit lanes, so put the lanes back in order afterwards
+        _mm256_storeu_si256((__m256i *)(destination + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    return i + _transcodeshims_narrow16_sse2(source + 2 * i, units - i, bigEndian, destination + i);
+}
+
+// UTF-8 to UTF-16, 32 bytes at a time
+__attribute__((target("avx2")))
+static size_t _transcodeshims_widen16_avx2(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(source + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        __m256i low = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v));
+        __m256i high = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+        if (bigEndian) {
+            low = _transcodeshims_swap16_avx2(low);
+            high = _transcodeshims_swap16_avx2(high);
+        }
+        _mm256_storeu_si256((__m256i *)(destination + 2 * i), low);
+        _mm256_storeu_si256((__m256i *)(destination + 2 * i + 32), high);
+    }
+    return i + _transcodeshims_widen16_sse2(source + i, length - i, bigEndian, destination + 2 * i);
+}
+
+#endif // TRANSCODESHIMS_X86
+
+// MARK: - NEON
+
+#if TRANSCODESHIMS_NEON
+
+// UTF-16 to UTF-8, 16 units at a time
+static size_t _transcodeshims_narrow16_neon(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination) {
+    size_t i = 0;
+    for (; i + 16 <= units; i += 16) {
+        uint8x16_t a = vld1q_u8(source + 2 * i);
+        uint8x16_t b = vld1q_u8(source + 2 * i + 16);
+        if (bigEndian) {
+            a = vrev16q_u8(a);
+            b = vrev16q_u8(b);
+        }
+        const uint16x8_t a16 = vreinterpretq_u16_u8(a);
+        const uint16x8_t b16 = vreinterpretq_u16_u8(b);
+        if (vmaxvq_u16(vorrq_u16(a16, b16)) >= 0x80) {
+            break;
+        }
+        vst1q_u8(destination + i, vcombine_u8(vmovn_u16(a16), vmovn_u16(b16)));
+    }
+    return i;
+}
+
+// UTF-32 to UTF-8, 16 units at a time
+static size_t _transcodeshims_narrow32_neon(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination) {
+    size_t i = 0;
+    for (; i + 16 <= units; i += 16) {
+        uint8x16_t v[4];
+        for (size_t k = 0; k < 4; k++) {
+            v[k] = vld1q_u8(source + 4 * i + 16 * k);
+            if (bigEndian) {
+                v[k] = vrev32q_u8(v[k]);
+            }
+        }
+        const uint32x4_t a = vreinterpretq_u32_u8(v[0]), b = vreinterpretq_u32_u8(v[1]);
+        const uint32x4_t c = vreinterpretq_u32_u8(v[2]), d = vreinterpretq_u32_u8(v[3]);
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+            break;
+        }
+        const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+        vst1q_u8(destination + i, vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+    }
+    return i;
+}
+
+// UTF-8 to UTF-16, 16 bytes at a time
+static size_t _transcodeshims_widen16_neon(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t v = vld1q_u8(source + i);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        uint8x16_t low = vreinterpretq_u8_u16(vmovl_u8(vget_low_u8(v)));
+        uint8x16_t high = vreinterpretq_u8_u16(vmovl_high_u8(v));
+        if (bigEndian) {
+            low = vrev16q_u8(low);
+            high = vrev16q_u8(high);
+        }
+        vst1q_u8(destination + 2 * i, low);
+        vst1q_u8(destination + 2 * i + 16, high);
+    }
+    return i;
+}
+
+// UTF-8 to UTF-32, 16 bytes at a time
+static size_t _transcodeshims_widen32_neon(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t v = vld1q_u8(source + i);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        const uint16x8_t low = vmovl_u8(vget_low_u8(v));
+        const uint16x8_t high = vmovl_high_u8(v);
+        uint8x16_t out[4] = {
+            vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(low))),
+            vreinterpretq_u8_u32(vmovl_high_u16(low)),
+            vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(high))),
+            vreinterpretq_u8_u32(vmovl_high_u16(high)),
+        };
+        for (size_t k = 0; k < 4; k++) {
+            vst1q_u8(destination + 4 * i + 16 * k, bigEndian ? vrev32q_u8(out[k]) : out[k]);
+        }
+    }
+    return i;
+}
+
+#endif // TRANSCODESHIMS_NEON
+
+// MARK: - Dispatch
+
+typedef struct {
+    _transcodeshims_kernel narrow16;
+    _transcodeshims_kernel narrow32;
+    _transcodeshims_kernel widen16;
+    _transcodeshims_kernel widen32;
+} _transcodeshims_kernels;
+
+static _transcodeshims_kernels _transcodeshims_select_kernels(void) {
+#if TRANSCODESHIMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        // The UTF-32 kernels are limited by the 64 bytes they read or write per block, not by the width of the vectors
+        return (_transcodeshims_kernels){ _transcodeshims_narrow16_avx2, _transcodeshims_narrow32_sse2, _transcodeshims_widen16_avx2, _transcodeshims_widen32_sse2 };
+    }
+    return (_transcodeshims_kernels){ _transcodeshims_narrow16_sse2, _transcodeshims_narrow32_sse2, _transcodeshims_widen16_sse2, _transcodeshims_widen32_sse2 };
+#elif TRANSCODESHIMS_NEON
+    return (_transcodeshims_kernels){ _transcodeshims_narrow16_neon, _transcodeshims_narrow32_neon, _transcodeshims_widen16_neon, _transcodeshims_widen32_neon };
+#else
+    return (_transcodeshims_kernels){ _transcodeshims_none, _transcodeshims_none, _transcodeshims_none, _transcodeshims_none };
+#endif
+}
+
+static size_t _transcodeshims_narrow16_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination);
+static size_t _transcodeshims_narrow32_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination);
+static size_t _transcodeshims_widen16_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination);
+static size_t _transcodeshims_widen32_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination);
+
+static _transcodeshims_kernel _transcodeshims_narrow16_kernel = _transcodeshims_narrow16_resolve;
+static _transcodeshims_kernel _transcodeshims_narrow32_kernel = _transcodeshims_narrow32_resolve;
+static _transcodeshims_kernel _transcodeshims_widen16_kernel = _transcodeshims_widen16_resolve;
+static _transcodeshims_kernel _transcodeshims_widen32_kernel = _transcodeshims_widen32_resolve;
+
+static void _transcodeshims_resolve(void) {
+    const _transcodeshims_kernels kernels = _transcodeshims_select_kernels();
+    _CSHIMS_STORE_KERNEL(_transcodeshims_narrow16_kernel, kernels.narrow16);
+    _CSHIMS_STORE_KERNEL(_transcodeshims_narrow32_kernel, kernels.narrow32);
+    _CSHIMS_STORE_KERNEL(_transcodeshims_widen16_kernel, kernels.widen16);
+    _CSHIMS_STORE_KERNEL(_transcodeshims_widen32_kernel, kernels.widen32);
+}
+
+static size_t _transcodeshims_narrow16_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination) {
+    _transcodeshims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_transcodeshims_narrow16_kernel)(source, count, bigEndian, destination);
+}
+
+static size_t _transcodeshims_narrow32_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination) {
+    _transcodeshims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_transcodeshims_narrow32_kernel)(source, count, bigEndian, destination);
+}
+
+static size_t _transcodeshims_widen16_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination) {
+    _transcodeshims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_transcodeshims_widen16_kernel)(source, count, bigEndian, destination);
+}
+
+static size_t _transcodeshims_widen32_resolve(const uint8_t *source, size_t count, bool bigEndian, uint8_t *destination) {
+    _transcodeshims_resolve();
+    return _CSHIMS_LOAD_KERNEL(_transcodeshims_widen32_kernel)(source, count, bigEndian, destination);
+}
+
+// MARK: - Transcoders
+
+bool _transcodeshims_utf16_to_utf8(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination, size_t *length) {
+    const _transcodeshims_kernel kernel = _CSHIMS_LOAD_KERNEL(_transcodeshims_narrow16_kernel);
+    size_t i = 0;
+    size_t out = 0;
+    while (i < units) {
+        const size_t run = kernel(source + 2 * i, units - i, bigEndian, destination + out);
+        i += run;
+        out += run;
+        const size_t scalarEnd = i + TRANSCODESHIMS_SCALAR_RUN;
+        while (i < units) {
+            const uint32_t unit = _transcodeshims_load16(source + 2 * i, bigEndian);
+            if (unit < 0x80) {
+                if (i >= scalarEnd) {
+                    break;
+                }
+                destination[out++] = (uint8_t)unit;
+                i += 1;
+            } else if (unit < 0xD800 || unit > 0xDFFF) {
+                out += _transcodeshims_encode_utf8(destination + out, unit);
+                i += 1;
+            } else {
+                // A leading surrogate must be followed by a trailing one
+                if (unit > 0xDBFF || i + 1 >= units) {
+                    return false;
+                }
+                const uint32_t trailing = _transcodeshims_load16(source + 2 * i + 2, bigEndian);
+                if (trailing < 0xDC00 || trailing > 0xDFFF) {
+                    return false;
+                }
+                out += _transcodeshims_encode_utf8(destination + out, 0x10000 + ((unit - 0xD800) << 10) + (trailing - 0xDC00));
+                i += 2;
+            }
+        }
+    }
+    *length = out;
+    return true;
+}
+
+bool _transcodeshims_utf32_to_utf8(const uint8_t *source, size_t units, bool bigEndian, uint8_t *destination, size_t *length) {
+    const _transcodeshims_kernel kernel = _CSHIMS_LOAD_KERNEL(_transcodeshims_narrow32_kernel);
+    size_t i = 0;
+    size_t out = 0;
+    while (i < units) {
+        const size_t run = kernel(source + 4 * i, units - i, bigEndian, destination + out);
+        i += run;
+        out += run;
+        const size_t scalarEnd = i + TRANSCODESHIMS_SCALAR_RUN;
+        while (i < units) {
+            const uint32_t unit = _transcodeshims_load32(source + 4 * i, bigEndian);
+            if (unit < 0x80) {
+                if (i >= scalarEnd) {
+                    break;
+                }
+                destination[out++] = (uint8_t)unit;
+            } else if (unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF)) {
+                return false;
+            } else {
+                out += _transcodeshims_encode_utf8(destination + out, unit);
+            }
+            i += 1;
+        }
+    }
+    *length = out;
+    return true;
+}
+
+size_t _transcodeshims_utf8_to_utf16(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    const _transcodeshims_kernel kernel = _CSHIMS_LOAD_KERNEL(_transcodeshims_widen16_kernel);
+    size_t i = 0;
+    size_t out = 0;
+    while (i < length) {
+        const size_t run = kernel(source + i, length - i, bigEndian, destination + out);
+        i += run;
+        out += 2 * run;
+        const size_t scalarEnd = i + TRANSCODESHIMS_SCALAR_RUN;
+        while (i < length) {
+            if (source[i] < 0x80) {
+                if (i >= scalarEnd) {
+                    break;
+                }
+                _transcodeshims_store16(destination + out, source[i], bigEndian);
+                out += 2;
+                i += 1;
+                continue;
+            }
+            size_t scalarLength;
+            const uint32_t scalar = _transcodeshims_decode_utf8(source + i, &scalarLength);
+            if (scalar < 0x10000) {
+                _transcodeshims_store16(destination + out, scalar, bigEndian);
+                out += 2;
+            } else {
+                _transcodeshims_store16(destination + out, 0xD800 + ((scalar - 0x10000) >> 10), bigEndian);
+                _transcodeshims_store16(destination + out + 2, 0xDC00 + ((scalar - 0x10000) & 0x3FF), bigEndian);
+                out += 4;
+            }
+            i += scalarLength;
+        }
+    }
+    return out;
+}
+
+size_t _transcodeshims_utf8_to_utf32(const uint8_t *source, size_t length, bool bigEndian, uint8_t *destination) {
+    const _transcodeshims_kernel kernel = _CSHIMS_LOAD_KERNEL(_transcodeshims_widen32_kernel);
+    size_t i = 0;
+    size_t out = 0;
+    while (i < length) {
+        const size_t run = kernel(source + i, length - i, bigEndian, destination + out);
+        i += run;
+        out += 4 * run;
+        const size_t scalarEnd = i + TRANSCODESHIMS_SCALAR_RUN;
+        while (i < length) {
+            if (source[i] < 0x80) {
+                if (i >= scalarEnd) {
+                    break;
+                }
+                _transcodeshims_store32(destination + out, source[i], bigEndian);
+                i += 1;
+            } else {
+                size_t scalarLength;
+                _transcodeshims_store32(destination + out, _transcodeshims_decode_utf8(source + i, &scalarLength), bigEndian);
+                i += scalarLength;
+            }
+            out += 4;
+        }
+    }
+    return out;
+}
@@ -82,6 +82,26 @@ private final class DataIOTests {
         #expect(readData == slice)
     }
 
+    @Test func writeChunked() throws {
+        let data = generateTestData()
+        var chunked = ChunkedData()
+        var offset = 0
+        // Enough chunks to need more than one gathering write, of sizes that do not line up with them
+        while offset < data.count {
+            let end = min(offset + 7919 * (chunked.regions.count % 5 + 1), data.count)
+            chunked.append(data[offset ..< end])
+            offset = end
+        }
+
+        try chunked.write(to: url)
+        #expect(try Data(contentsOf: url) == data)
+
+        #if !os(WASI)
+        try chunked.write(to: url, options: [.atomic])
+        #expect(try Data(contentsOf: url) == data)
+        #endif
+    }
+
     #if !os(WASI)
     // Atomic writing is a very different code path
     @Test func readWriteAtomic() throws {
@@ -91,12 +111,45 @@ private final class DataIOTests {
         // Perform an atomic write to a file that already exists
         try writeAndVerifyTestData(to: url, writeOptions: [.atomic])
     }
+
+    @Test func atomicWriteLeavesNoTemporaryFiles() throws {
+        let directory = URL.temporaryDirectory.appendingPathComponent("atomic-\(UUID().uuidString)")
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: false)
+        defer { try? FileManager.default.removeItem(at: directory) }
+        let file = directory.appendingPathComponent("file")
+
+        try writeAndVerifyTestData(to: file, writeOptions: [.atomic])
+#if !os(Windows)
+        try FileManager.default.setAttributes([.posixPermissions: 0o640], ofItemAtPath: file.path)
+#endif
+        let replacement = Data("replacement".utf8)
+        try replacement.write(to: file, options: [.atomic])
+        #expect(try Data(contentsOf: file) == replacement)
+#if !os(Windows)
+        // Replacing a file keeps its permissions
+        let attributes = try FileManager.default.attributesOfItem(atPath: file.path)
+        #expect(attributes[.posixPermissions] as? UInt == 0o640)
+#endif
+        #expect(try FileManager.default.contentsOfDirectory(atPath: directory.path) == ["file"])
+    }
     #endif
 
     @Test func readWriteMapped() throws {
         try writeAndVerifyTestData(to: url, readOptions: [.mappedIfSafe])
     }
 
+    @Test(arguments: [
+        Data.ReadingOptions.sequentialAccess,
+        .prefetch,
+        .preferHugePages,
+        [.sequentialAccess, .prefetch, .preferHugePages],
+        [.alwaysMapped, .populateMapping],
+        [.alwaysMapped, .sequentialAccess, .prefetch],
+    ])
+    func readWithAccessHints(options: Data.ReadingOptions) throws {
+        try writeAndVerifyTestData(to: url, readOptions: options)
+    }
+
     @Test func writeFailure() throws {
         let data = Data()
         try data.write(to: url)
@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 import Testing
+import Synchronization
 
 #if canImport(TestSupport)
 import TestSupport
@@ -3259,6 +3260,144 @@ extension DataTests {
         #expect("TG9yZW0gaXBzdW0gZG9sb3Igc2l0IGFtZXQsIGNvbnNlY3RldHVyIGFkaXBpc2NpbmcgZWxpdC4gVXQgYXQgdGluY2lkdW50IGFyY3UuIFN1c3BlbmRpc3NlIG5lYyBzb2RhbGVzIGVyYXQsIHNpdCBhbWV0IGltcGVyZGlldCBpcHN1bS4gRXRpYW0gc2VkIG9ybmFyZSBmZWxpcy4gTnVuYyBtYXVyaXMgdHVycGlzLCBiaWJlbmR1bSBub24gbGVjdHVzIHF1aXMsIG1hbGVzdWFkYSBwbGFjZXJhdCB0dXJwaXMuIE5hbSBhZGlwaXNjaW5nIG5vbiBtYXNzYSBldCBzZW1wZXIuIE51bGxhIGNvbnZhbGxpcyBzZW1wZXIgYmliZW5kdW0uIEFsaXF1YW0gZGljdHVtIG51bGxhIGN1cnN1cyBtaSB1bHRyaWNpZXMsIGF0IHRpbmNpZHVudCBtaSBzYWdpdHRpcy4gTnVsbGEgZmF1Y2lidXMgYXQgZHVpIHF1aXMgc29kYWxlcy4gTW9yYmkgcnV0cnVtLCBkdWkgaWQgdWx0cmljZXMgdmVuZW5hdGlzLCBhcmN1IHVybmEgZWdlc3RhcyBmZWxpcywgdmVsIHN1c2NpcGl0IG1hdXJpcyBhcmN1IHF1aXMgcmlzdXMuIE51bmMgdmVuZW5hdGlzIGxpZ3VsYSBhdCBvcmNpIHRyaXN0aXF1ZSwgZXQgbWF0dGlzIHB1cnVzIHB1bHZpbmFyLiBFdGlhbSB1bHRyaWNpZXMgZXN0IG9kaW8uIE51bmMgZWxlaWZlbmQgbWFsZXN1YWRhIGp1c3RvLCBuZWMgZXVpc21vZCBzZW0gdWx0cmljZXMgcXVpcy4gRXRpYW0gbmVjIG5pYmggc2l0IGFtZXQgbG9yZW0gZmF1Y2lidXMgZGFwaWJ1cyBxdWlzIG5lYyBsZW8uIFByYWVzZW50IHNpdCBhbWV0IG1hdXJpcyB2ZWwgbGFjdXMgaGVuZHJlcml0IHBvcnRhIG1vbGxpcyBjb25zZWN0ZXR1ciBtaS4gRG9uZWMgZWdldCB0b3J0b3IgZHVpLiBNb3JiaSBpbXBlcmRpZXQsIGFyY3Ugc2l0IGFtZXQgZWxlbWVudHVtIGludGVyZHVtLCBxdWFtIG5pc2wgdGVtcG9yIHF1YW0sIHZpdGFlIGZldWdpYXQgYXVndWUgcHVydXMgc2VkIGxhY3VzLiBJbiBhYyB1cm5hIGFkaXBpc2NpbmcgcHVydXMgdmVuZW5hdGlzIHZvbHV0cGF0IHZlbCBldCBtZXR1cy4gTnVsbGFtIG5lYyBhdWN0b3IgcXVhbS4gUGhhc2VsbHVzIHBvcnR0aXRvciBmZWxpcyBhYyBuaWJoIGdyYXZpZGEgc3VzY2lwaXQgdGVtcHVzIGF0IGFudGUuIE51bmMgcGVsbGVudGVzcXVlIGlhY3VsaXMgc2FwaWVuIGEgbWF0dGlzLiBBZW5lYW4gZWxlaWZlbmQgZG9sb3Igbm9uIG51bmMgbGFvcmVldCwgbm9uIGRpY3R1bSBtYXNzYSBhbGlxdWFtLiBBZW5lYW4gcXVpcyB0dXJwaXMgYXVndWUuIFByYWVzZW50IGF1Z3VlIGxlY3R1cywgbW9sbGlzIG5lYyBlbGVtZW50dW0gZXUsIGRpZ25pc3NpbSBhdCB2ZWxpdC4gVXQgY29uZ3VlIG5lcXVlIGlkIHVsbGFtY29ycGVyIHBlbGxlbnRlc3F1ZS4gTWFlY2VuYXMgZXVpc21vZCBpbiBlbGl0IGV1IHZlaGljdWxhLiBOdWxsYW0gdHJpc3RpcXVlIGR1aSBudWxsYSwgbmVjIGNvbnZhbGxpcyBtZXR1cyBzdXNjaXBpdCBlZ2V0LiBDcmFzIHNlbXBlciBhdWd1ZSBuZWMgY3Vyc3VzIGJsYW5kaXQuIE51bGxhIHJob25jdXMgZXQgb2RpbyBxdWlzIGJsYW5kaXQuIFByYWVzZW50IGxvYm9ydGlzIGRpZ25pc3NpbSB2ZWxpdCB1dCBwdWx2aW5hci4gRHVpcyBpbnRlcmR1bSBxdWFtIGFkaXBpc2NpbmcgZG9sb3Igc2VtcGVyIHNlbXBlci4gTnVuYyBiaWJlbmR1bSBjb252YWxsaXMgZHVpLCBlZ2V0IG1vbGxpcyBtYWduYSBoZW5kcmVyaXQgZXQuIE1vcmJpIGZhY2lsaXNpcywgYXVndWUgZXUgZnJpbmdpbGxhIGNvbnZhbGxpcywgbWF1cmlzIGVzdCBjdXJzdXMgZG9sb3IsIGV1IHBvc3VlcmUgb2RpbyBudW5jIHF1aXMgb3JjaS4gVXQgZXUganVzdG8gc2VtLiBQaGFzZWxsdXMgdXQgZXJhdCByaG9uY3VzLCBmYXVjaWJ1cyBhcmN1IHZpdGFlLCB2dWxwdXRhdGUgZXJhdC4gQWxpcXVhbSBuZWMgbWFnbmEgdml2ZXJyYSwgaW50ZXJkdW0gZXN0IHZpdGFlLCByaG9uY3VzIHNhcGllbi4gRHVpcyB0aW5jaWR1bnQgdGVtcG9yIGlwc3VtIHV0IGRhcGlidXMuIE51bGxhbSBjb21tb2RvIHZhcml1cyBtZXR1cywgc2VkIHNvbGxpY2l0dWRpbiBlcm9zLiBFdGlhbSBuZWMgb2RpbyBldCBkdWkgdGVtcG9yIGJsYW5kaXQgcG9zdWVyZS4=" == base64, "medium base64 conversion should work")
     }
 
+    @Test(arguments: [
+        Data.Base64EncodingOptions(),
+        .omitPaddingCharacter,
+        .base64URLAlphabet,
+        [.base64URLAlphabet, .omitPaddingCharacter],
+        .lineLength64Characters,
+        [.lineLength76Characters, .endLineWithLineFeed],
+        [.lineLength64Characters, .endLineWithCarriageReturn, .base64URLAlphabet],
+    ])
+    func base64VectorKernelsMatchScalarImplementation(options: Data.Base64EncodingOptions) {
+        func encode(_ bytes: [UInt8], useVectorKernels: Bool) -> [UInt8] {
+            let capacity = Base64.encodeComputeCapacity(bytes: bytes.count, options: options)
+            return bytes.withUnsafeBufferPointer { input in
+                [UInt8](unsafeUninitializedCapacity: capacity) { buffer, length in
+                    Base64._encode(input: input, buffer: buffer, length: &length, options: options, useVectorKernels: useVectorKernels)
+                }
+            }
+        }
+
+        func decode(_ encoded: [UInt8], options: Data.Base64DecodingOptions, useVectorKernels: Bool) -> Result<[UInt8], Base64.DecodingError> {
+            encoded.withUnsafeBufferPointer { input in
+                var output = [UInt8](repeating: 0, count: (input.count + 3) / 4 * 3)
+                var length = output.count
+                let result = output.withUnsafeMutableBufferPointer { buffer in
+                    Result { () throws(Base64.DecodingError) in
+                        if options.contains(.ignoreUnknownCharacters) {
+                            try Base64._decodeIgnoringErrors(from: input, into: buffer, length: &length, options: options, useVectorKernels: useVectorKernels)
+                        } else {
+                            try Base64._decode(from: input, into: buffer, length: &length, options: options, useVectorKernels: useVectorKernels)
+                        }
+                    }
+                }
+                return result.map { Array(output.prefix(length)) }
+            }
+        }
+
+        var decodingOptions = Data.Base64DecodingOptions()
+        if options.contains(.base64URLAlphabet) { decodingOptions.insert(.base64URLAlphabet) }
+        if options.contains(.omitPaddingCharacter) { decodingOptions.insert(.omitPaddingCharacter) }
+        if options.contains(.lineLength64Characters) || options.contains(.lineLength76Characters) {
+            decodingOptions.insert(.ignoreUnknownCharacters)
+        }
+
+        var generator = SystemRandomNumberGenerator()
+        for count in [1, 2, 3, 23, 24, 25, 31, 32, 33, 47, 48, 49, 57, 63, 64, 65, 95, 96, 97, 191, 192, 193, 1000, 4099] {
+            let bytes = (0 ..< count).map { _ in UInt8.random(in: .min ... .max, using: &generator) }
+            let encoded = encode(bytes, useVectorKernels: false)
+            #expect(encode(bytes, useVectorKernels: true) == encoded, "count: \(count)")
+            #expect(decode(encoded, options: decodingOptions, useVectorKernels: true) == .success(bytes), "count: \(count)")
+
+            // Invalid characters must be reported the same way, wherever they show up in a block.
+            for invalid in [UInt8(ascii: "!"), UInt8(ascii: "="), UInt8(ascii: "\n"), 0x80] {
+                var corrupted = encoded
+                corrupted[Int.random(in: corrupted.indices, using: &generator)] = invalid
+                #expect(
+                    decode(corrupted, options: decodingOptions, useVectorKernels: true) ==
+                    decode(corrupted, options: decodingOptions, useVectorKernels: false),
+                    "count: \(count), invalid: \(invalid)"
+                )
+            }
+        }
+    }
+
+    @Test(arguments: [
+        Data.Base64EncodingOptions(),
+        .omitPaddingCharacter,
+        .base64URLAlphabet,
+        .lineLength64Characters,
+        [.lineLength76Characters, .endLineWithLineFeed],
+        [.lineLength64Characters, .endLineWithCarriageReturn, .base64URLAlphabet],
+    ])
+    func base64StreamingMatchesOneShot(options: Data.Base64EncodingOptions) throws {
+        var generator = SystemRandomNumberGenerator()
+        let data = Data((0 ..< 1000).map { _ in UInt8.random(in: .min ... .max, using: &generator) })
+        let expected = data.base64EncodedData(options: options)
+
+        var decodingOptions = Data.Base64DecodingOptions()
+        if options.contains(.base64URLAlphabet) { decodingOptions.insert(.base64URLAlphabet) }
+        if options.contains(.omitPaddingCharacter) { decodingOptions.insert(.omitPaddingCharacter) }
+        if options.contains(.lineLength64Characters) || options.contains(.lineLength76Characters) {
+            decodingOptions.insert(.ignoreUnknownCharacters)
+        }
+
+        for chunkSize in [1, 2, 3, 5, 47, 48, 57, 100, 1000] {
+            var encoder = Data.Base64Encoder(options: options)
+            var encoded = Data()
+            for start in stride(from: 0, to: data.count, by: chunkSize) {
+                encoded.append(encoder.encode(data[start ..< min(start + chunkSize, data.count)]))
+            }
+            encoded.append(encoder.finish())
+            #expect(encoded == expected, "chunk size: \(chunkSize)")
+
+            var decoder = Data.Base64Decoder(options: decodingOptions)
+            var decoded = Data()
+            for start in stride(from: 0, to: encoded.count, by: chunkSize) {
+                decoded.append(try decoder.decode(encoded[start ..< min(start + chunkSize, encoded.count)]))
+            }
+            decoded.append(try decoder.finish())
+            #expect(decoded == data, "chunk size: \(chunkSize)")
+        }
+    }
+
+    @Test func base64StreamingDecoderRejectsInvalidInput() {
+        for invalid in ["Q", "QQ", "QQ=", "QU!D", "QQ==Q", "QQ==QQ=="] {
+            #expect(throws: CocoaError.self, "input: \(invalid)") {
+                var decoder = Data.Base64Decoder()
+                _ = try decoder.decode(Data(invalid.utf8))
+                _ = try decoder.finish()
+            }
+            #expect(Data(base64Encoded: invalid) == nil)
+        }
+    }
+
+    @Test func base64StreamingAsyncSequence() async throws {
+        func chunked(_ data: Data, by size: Int) -> AsyncStream<Data> {
+            AsyncStream { continuation in
+                for start in stride(from: 0, to: data.count, by: size) {
+                    continuation.yield(data[start ..< min(start + size, data.count)])
+                }
+                continuation.finish()
+            }
+        }
+
+        let data = Data((0 ..< 1000).map { UInt8(truncatingIfNeeded: $0 &* 31) })
+
+        var encoded = Data()
+        for try await chunk in chunked(data, by: 77).base64EncodedData(options: .lineLength76Characters) {
+            encoded.append(chunk)
+        }
+        #expect(encoded == data.base64EncodedData(options: .lineLength76Characters))
+
+        var decoded = Data()
+        for try await chunk in chunked(encoded, by: 13).base64DecodedData(options: .ignoreUnknownCharacters) {
+            decoded.append(chunk)
+        }
+        #expect(decoded == data)
+    }
+
     @Test func testBase64LineLengthOptions() {
         let expected46 = "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA=="
         let length46String = Data(repeating:0, count: 46).base64EncodedString(options: .lineLength64Characters)
@@ -3529,6 +3668,281 @@ extension DataTests {
         let range = slice.range(of: try #require("a".data(using: .ascii)))
         #expect(range == 4..<5 as Range<Data.Index>)
     }
+
+    @Test(arguments: [2, 3, 7, 16, 31, 32, 33, 40])
+    func rangeMatchesNaiveSearch(needleLength: Int) {
+        func naiveRange(of needle: Data, in haystack: Data, backwards: Bool) -> Range<Int>? {
+            let offsets = Array(0 ... haystack.count - needle.count)
+            for offset in backwards ? offsets.reversed() : offsets {
+                if haystack[offset ..< offset + needle.count] == needle {
+                    return offset ..< offset + needle.count
+                }
+            }
+            return nil
+        }
+
+        var generator = SystemRandomNumberGenerator()
+        for _ in 0 ..< 50 {
+            // A small alphabet produces many partial matches.
+            let haystack = Data((0 ..< 300).map { _ in UInt8.random(in: 0 ... 2, using: &generator) })
+            var needle = Data((0 ..< needleLength).map { _ in UInt8.random(in: 0 ... 2, using: &generator) })
+            if Bool.random(using: &generator) {
+                let offset = Int.random(in: 0 ... haystack.count - needleLength, using: &generator)
+                needle = haystack[offset ..< offset + needleLength]
+            }
+            let searcher = Data.Searcher(pattern: needle)
+
+            for backwards in [false, true] {
+                let expected = naiveRange(of: Data(needle), in: haystack, backwards: backwards)
+                let options: Data.SearchOptions = backwards ? .backwards : []
+                #expect(haystack.range(of: needle, options: options) == expected)
+                #expect(haystack.range(of: searcher, options: options) == expected)
+            }
+        }
+    }
+
+    @Test func rangeWithSearcher() {
+        let haystack = dataFrom("--boundary\r\ncontent\r\n--boundary--")
+        let searcher = Data.Searcher(pattern: dataFrom("--boundary"))
+
+        #expect(haystack.range(of: searcher) == 0..<10)
+        #expect(haystack.range(of: searcher, in: 1..<haystack.count) == 21..<31)
+        #expect(haystack.range(of: searcher, options: .backwards) == 21..<31)
+        #expect(haystack.range(of: searcher, options: .anchored, in: 1..<haystack.count) == nil)
+        #expect(haystack.range(of: Data.Searcher(pattern: Data())) == nil)
+
+        let slice = haystack[12...]
+        #expect(slice.range(of: searcher) == 21..<31)
+    }
+
+    @Test func firstMatchOfMultiplePatterns() {
+        let searcher = Data.MultiPatternSearcher(patterns: ["he", "she", "his", "hers", ""].map(dataFrom))
+        let haystack = dataFrom("ahishers")
+
+        let match = haystack.firstMatch(of: searcher)
+        #expect(match?.range == 1..<4)
+        #expect(match?.patternIndex == 2)
+
+        #expect(haystack.firstMatch(of: searcher, in: 2..<haystack.count)?.range == 3..<6)
+        #expect(haystack.firstMatch(of: searcher, in: 2..<haystack.count)?.patternIndex == 1)
+        #expect(haystack.firstMatch(of: searcher, in: 4..<haystack.count)?.range == 4..<6)
+        #expect(haystack.firstMatch(of: searcher, in: 4..<haystack.count)?.patternIndex == 0)
+        #expect(haystack.firstMatch(of: searcher, in: 0..<2) == nil)
+
+        // The earlier start wins over the pattern order, and the pattern order breaks ties.
+        let overlapping = Data.MultiPatternSearcher(patterns: ["bcd", "abcdef", "ab", "abc"].map(dataFrom))
+        #expect(dataFrom("xabcdefg").firstMatch(of: overlapping)?.range == 1..<7)
+        #expect(dataFrom("xabcdefg").firstMatch(of: overlapping)?.patternIndex == 1)
+        #expect(dataFrom("xabcdx").firstMatch(of: overlapping)?.range == 1..<3)
+        #expect(dataFrom("xabcdx").firstMatch(of: overlapping)?.patternIndex == 2)
+
+        let slice = haystack[3...]
+        #expect(slice.firstMatch(of: searcher)?.range == 3..<6)
+
+        #expect(haystack.firstMatch(of: Data.MultiPatternSearcher(patterns: [])) == nil)
+    }
+
+    @Test func firstMatchOfPatternsWithCommonFirstByte() {
+        let searcher = Data.MultiPatternSearcher(patterns: ["\r\n--a", "\r\n--b", "\r\n\r\n"].map(dataFrom))
+        let haystack = dataFrom("header\r\nmore\r\n\r\nbody\r\n--b\r\n--a")
+
+        #expect(haystack.firstMatch(of: searcher)?.range == 12..<16)
+        #expect(haystack.firstMatch(of: searcher)?.patternIndex == 2)
+        #expect(haystack.firstMatch(of: searcher, in: 13..<haystack.count)?.range == 20..<25)
+        #expect(haystack.firstMatch(of: searcher, in: 13..<haystack.count)?.patternIndex == 1)
+    }
+
+    @Test func chunkedDataSharesChunks() {
+        let header = dataFrom("HTTP/1.1 200 OK\r\n\r\n")
+        let payload = Data((0 ..< 4096).map { UInt8(truncatingIfNeeded: $0) })
+        let trailer = dataFrom("\r\n")
+
+        var chunked = ChunkedData()
+        chunked.append(header)
+        chunked.append(payload[1024 ..< 3072])
+        chunked.append(trailer)
+        chunked.append(contentsOf: [UInt8](repeating: 0x2A, count: 3))
+
+        var expected = header + payload[1024 ..< 3072] + trailer
+        expected.append(contentsOf: [0x2A, 0x2A, 0x2A])
+
+        #expect(chunked.count == expected.count)
+        #expect(chunked.elementsEqual(expected))
+        #expect((0 ..< chunked.count).allSatisfy { chunked[$0] == expected[$0] })
+        #expect(chunked[19 ..< 25].elementsEqual(expected[19 ..< 25]))
+        #expect(chunked.lastRange(of: trailer) == 2067 ..< 2069)
+
+        // The payload is shared, while the small pieces after it are joined into one chunk.
+        #expect(chunked.regions.count == 3)
+        let payloadAddress = payload.withUnsafeBytes { $0.baseAddress! + 1024 }
+        #expect(chunked.regions[1].withUnsafeBytes { $0.baseAddress } == payloadAddress)
+
+        #expect(Data(chunked) == expected)
+        let joined = chunked.data
+        #expect(joined == expected)
+        #expect(chunked.regions.count == 1)
+
+        #expect(ChunkedData().isEmpty)
+        #expect(Data(ChunkedData([Data(), Data()])).isEmpty)
+    }
+
+    @Test func dataWithAllocator() {
+        final class CountingAllocator: Data.Allocator {
+            let outstanding = Mutex(0)
+
+            func allocate(byteCount: Int) -> UnsafeMutableRawBufferPointer {
+                outstanding.withLock { $0 += 1 }
+                return UnsafeMutableRawBufferPointer.allocate(byteCount: byteCount, alignment: 16)
+            }
+
+            func deallocate(_ buffer: UnsafeMutableRawBufferPointer) {
+                outstanding.withLock { $0 -= 1 }
+                buffer.deallocate()
+            }
+        }
+
+        let allocator = CountingAllocator()
+        do {
+            var data = Data(capacity: 256, allocator: allocator)
+            #expect(data.isEmpty)
+            let address = data.withUnsafeBytes { $0.baseAddress }
+            data.append(contentsOf: 0 ..< 200)
+            #expect(data.elementsEqual(0 ..< 200))
+            #expect(data.withUnsafeBytes { $0.baseAddress } == address)
+            #expect(allocator.outstanding.withLock { $0 } == 1)
+
+            // Growing beyond the capacity moves the bytes and returns the memory
+            data.append(Data(count: 100))
+            #expect(data.count == 300)
+            #expect(data[199] == 199)
+            #expect(allocator.outstanding.withLock { $0 } == 0)
+
+            let zeroed = Data(count: 64, allocator: allocator)
+            #expect(zeroed == Data(count: 64))
+            #expect(allocator.outstanding.withLock { $0 } == 1)
+        }
+        #expect(allocator.outstanding.withLock { $0 } == 0)
+        #expect(Data(capacity: 0, allocator: allocator).isEmpty)
+    }
+
+    @Test func dataWithArenaAllocator() {
+        let arena = Data.ArenaAllocator(blockSize: 1024)
+        var header = Data(capacity: 100, allocator: arena)
+        var body = Data(capacity: 200, allocator: arena)
+        var large = Data(count: 4096, allocator: arena)
+        header.append(contentsOf: repeatElement(1, count: 100))
+        body.append(contentsOf: repeatElement(2, count: 200))
+        large[4095] = 3
+
+        #expect(header.allSatisfy { $0 == 1 })
+        #expect(body.allSatisfy { $0 == 2 })
+        #expect(large.count == 4096)
+        #expect(large.dropLast().allSatisfy { $0 == 0 })
+        #expect(large.last == 3)
+
+        // The most recent allocation is given back, so the next one reuses its memory
+        let address = body.withUnsafeBytes { $0.baseAddress }
+        body = Data()
+        let scratch = Data(count: 200, allocator: arena)
+        #expect(scratch.withUnsafeBytes { $0.baseAddress } == address)
+    }
+
+    @Test func growingHugeData() {
+        let megabyte = 1024 * 1024
+        var data = Data(count: 40 * megabyte)
+        data[0] = 1
+        data[40 * megabyte - 1] = 2
+
+        // Appending beyond the capacity moves the buffer
+        let chunk = Data(repeating: 3, count: 8 * megabyte)
+        for _ in 0 ..< 4 {
+            data.append(chunk)
+        }
+        #expect(data.count == 72 * megabyte)
+        #expect(data[0] == 1)
+        #expect(data[40 * megabyte - 1] == 2)
+        #expect(data[40 * megabyte] == 3)
+        #expect(data.last == 3)
+
+        // Growing the count fills with zeros, also where bytes were truncated before
+        data.count = megabyte
+        data.count = 96 * megabyte
+        #expect(data[0] == 1)
+        #expect(data[megabyte...] == Data(count: 95 * megabyte))
+
+        let copy = data
+        data[0] = 4
+        #expect(copy[0] == 1)
+        #expect(data[0] == 4)
+    }
+
+    @Test func checksums() {
+        let fox = Data("The quick brown fox jumps over the lazy dog".utf8)
+        #expect(Data("123456789".utf8).crc32cChecksum() == 0xE3069283)
+        #expect(Data(count: 32).crc32cChecksum() == 0x8A9136AA)
+        #expect(fox.crc32cChecksum() == 0x22620404)
+        #expect(Data().crc32cChecksum() == 0)
+
+        #expect(Data().xxh3Hash() == 0x2D06800538D394C2)
+        #expect(fox.xxh3Hash() == 0xCE7D19A5418FB365)
+        #expect(fox.xxh3Hash(seed: 42) == 0xB4A3F3C36B3C7D26)
+        #expect(fox.xxh3Hash128() == 0xDDD650205CA3E7FA_24A1CC2E3A8A7651)
+
+        // Long enough for the vectorized path
+        let long = Data((0 ..< 4096).map { UInt8(truncatingIfNeeded: $0 * 31 + 7) })
+        #expect(long.xxh3Hash() == 0xA3C19F8174CDE0BB)
+        #expect(long.xxh3Hash(seed: 42) == 0x334B260CACB92CA4)
+        #expect(long.xxh3Hash128(seed: 42) == 0xC7EEB700DAC2F25A_334B260CACB92CA4)
+    }
+
+    @Test func incrementalChecksums() {
+        let data = Data((0 ..< 10_000).map { UInt8(truncatingIfNeeded: $0 * 131 ^ $0 >> 5) })
+        for size in [0, 1, 3, 17, 129, 241, 1024, 4000, 10_000] {
+            let input = data.prefix(size)
+            var crc = Data.CRC32C()
+            var hash = Data.XXH3(seed: 7)
+            var chunked = ChunkedData()
+            var offset = input.startIndex
+            var length = 1
+            while offset < input.endIndex {
+                let chunk = input[offset ..< min(offset + length, input.endIndex)]
+                crc.update(chunk)
+                hash.update(chunk)
+                chunked.append(Data(chunk))
+                offset += chunk.count
+                length = length * 3 % 509
+            }
+            #expect(crc.value == input.crc32cChecksum())
+            #expect(hash.value == input.xxh3Hash(seed: 7))
+            #expect(hash.value128 == input.xxh3Hash128(seed: 7))
+            // Non-contiguous input gives the same result
+            #expect(chunked.crc32cChecksum() == crc.value)
+            #expect(chunked.xxh3Hash(seed: 7) == hash.value)
+            #expect(chunked.xxh3Hash128(seed: 7) == hash.value128)
+        }
+
+        // Copies of a hash continue independently
+        var first = Data.XXH3()
+        first.update(data.prefix(300))
+        var second = first
+        second.update(data.dropFirst(300))
+        #expect(first.value == data.prefix(300).xxh3Hash())
+        #expect(second.value == data.xxh3Hash())
+    }
+
+    @Test func sampledHashKey() {
+        var large = Data(repeating: 1, count: 4096)
+        let key = Data.SampledHashKey(large)
+        large[2048] = 2
+        let differentInTheMiddle = Data.SampledHashKey(large)
+        #expect(key.hashValue == differentInTheMiddle.hashValue)
+        #expect(key != differentInTheMiddle)
+
+        let keys: Set = [key, differentInTheMiddle, Data.SampledHashKey(Data([1, 2, 3]))]
+        #expect(keys.count == 3)
+        #expect(keys.contains(Data.SampledHashKey(large)))
+        #expect(!keys.contains(Data.SampledHashKey(Data([1, 2]))))
+    }
 }
 
 #if FOUNDATION_FRAMEWORK // Bridging is not available in the FoundationPreview package
@@ -138,5 +138,42 @@ private struct HTTPFormatStyleFormattingTests {
         #expect(parsed.second == 59)
         #expect(try Date("Sat, 20 Jan 2025 01:50:60 GMT", strategy: .http) == Date("Sat, 20 Jan 2025 01:50:59 GMT", strategy: .http))
     }
-}
 
+    @Test func fixedLengthMatchesComponents() throws {
+        var gregorian = Calendar(identifier: .gregorian)
+        gregorian.timeZone = .gmt
+        let buffer = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: 64)
+        defer { buffer.deallocate() }
+
+        // 1900-01-01 through 9999, with fractional seconds, and each date twice to format once from the cache
+        var dates = [Date(timeIntervalSince1970: -2208988800), Date(timeIntervalSince1970: 253402300799.5), Date(timeIntervalSince1970: -0.5)]
+        for i in 0 ..< 500 {
+            dates.append(Date(timeIntervalSince1970: -2208988800 + Double(i) * 22_700_000.25))
+        }
+        for date in dates + dates {
+            let components = gregorian.dateComponents([.weekday, .day, .month, .year, .hour, .minute, .second], from: date)
+            let expected = DateComponents.HTTPFormatStyle().format(components)
+
+            #expect(date.formatted(.http) == expected)
+            let count = try #require(Date.HTTPFormatStyle().format(date, into: buffer))
+            #expect(count == Date.HTTPFormatStyle.fixedLength)
+            #expect(String(decoding: UnsafeBufferPointer(rebasing: buffer[..<count]), as: UTF8.self) == expected)
+
+            let parsed = try Date(expected, strategy: .http)
+            #expect(parsed == gregorian.date(from: components))
+        }
+
+        // Too small a buffer
+        #expect(Date.HTTPFormatStyle().format(.now, into: UnsafeMutableBufferPointer(rebasing: buffer[..<28])) == nil)
+
+        // Outside of the fixed length range
+        let early = try #require(gregorian.date(from: DateComponents(year: 1850, month: 3, day: 4, hour: 5, minute: 6, second: 7)))
+        let count = try #require(Date.HTTPFormatStyle().format(early, into: buffer))
+        #expect(String(decoding: UnsafeBufferPointer(rebasing: buffer[..<count]), as: UTF8.self) == "Mon, 04 Mar 1850 05:06:07 GMT")
+    }
+
+    @Test func dayPastEndOfMonth() throws {
+        // The day is not validated against the month, it rolls over into the next one
+        #expect(try Date("Mon, 31 Feb 2025 00:00:00 GMT", strategy: .http) == Date("Mon, 03 Mar 2025 00:00:00 GMT", strategy: .http))
+    }
+}
@@ -265,4 +265,38 @@ private struct ISO8601FormatStyleFormattingTests {
         let date = try style.parse(input)
         #expect(style.format(date) == input)
     }
+
+    @Test func fixedLayoutMatchesComponents() throws {
+        // A space between the date and the time takes the general path through `Calendar`
+        let fixed = Date.ISO8601FormatStyle(includingFractionalSeconds: true)
+        let general = Date.ISO8601FormatStyle(dateTimeSeparator: .space, includingFractionalSeconds: true)
+
+        // 1600-01-01 through 9999, with fractional seconds
+        var dates = [Date(timeIntervalSince1970: -11676096000), Date(timeIntervalSince1970: 253402300799.9996), Date(timeIntervalSince1970: -0.0005), Date(timeIntervalSince1970: 1_674_036_251.123)]
+        for i in 0 ..< 500 {
+            dates.append(Date(timeIntervalSince1970: -11676096000 + Double(i) * 530_000_000.123))
+        }
+        for date in dates {
+            let expected = String(general.format(date).map { $0 == " " ? "T" : $0 })
+            #expect(fixed.format(date) == expected)
+            #expect(fixed.format([date]) == [expected])
+            let written = String(_capacity: 32) { output in
+                #expect(fixed.format(date, into: &output))
+            }
+            #expect(written == expected)
+
+            let parsed = try general.parse(general.format(date))
+            #expect(try fixed.parse(expected) == parsed)
+        }
+
+        // Too small a span
+        let truncated = String(_capacity: 23) { output in
+            #expect(!fixed.format(.now, into: &output))
+        }
+        #expect(truncated.isEmpty)
+
+        // Before 1600, and in other time zones
+        #expect(fixed.format(Date(timeIntervalSince1970: -12219292800)) == "1582-10-15T00:00:00.000Z")
+        #expect(Date.ISO8601FormatStyle(timeZone: TimeZone(secondsFromGMT: 3600)!).format(Date(timeIntervalSince1970: 0)) == "1970-01-01T01:00:00+0100")
+    }
 }
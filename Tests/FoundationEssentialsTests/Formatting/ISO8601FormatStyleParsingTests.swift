@@ -121,6 +121,34 @@ private struct ISO8601FormatStyleParsingTests {
             try iso8601WithFraction.parse(strWithFraction)
         }
     }
+
+    @Test func fixedLayout() throws {
+        let iso8601 = Date.ISO8601FormatStyle()
+        let general = Date.ISO8601FormatStyle(dateTimeSeparator: .space)
+
+        // Parsed from bytes, ignoring anything that follows the date
+        let bytes = Array("2023-01-18T10:04:11.123456789Z, and more".utf8)
+        let result = try #require(bytes.withUnsafeBufferPointer { iso8601.parse($0.span) })
+        #expect(result.consumed == 30)
+        #expect(result.date == (try general.parse("2023-01-18 10:04:11.123456789Z")))
+
+        // Days past the end of the month, an hour of 24, and leap seconds
+        #expect(try iso8601.parse("2023-02-31T24:00:00Z") == (try iso8601.parse("2023-03-04T00:00:00Z")))
+        #expect(try iso8601.parse("2023-01-18T10:04:60Z") == (try iso8601.parse("2023-01-18T10:04:59Z")))
+        #expect(throws: (any Error).self) {
+            try iso8601.parse("2023-01-18T24:00:01Z")
+        }
+        #expect(throws: (any Error).self) {
+            try iso8601.parse("2023-01-18T10:04:11.1234567890Z")
+        }
+
+        // Other layouts fall back to the general parser
+        let date = try iso8601.parse("2023-01-18T10:04:11Z")
+        #expect(try iso8601.parse(["2023-01-18T10:04:11Z", "2023-01-18T10:04:11+0100", "2023-1-18T10:04:11Z"]) == [date, date - 3600, date])
+        #expect(throws: (any Error).self) {
+            try iso8601.parse(["2023-01-18T10:04:11Z", "2023-01-18"])
+        }
+    }
     
     @Test(arguments: [
         ("2019-W52-07", "2019-12-29"),
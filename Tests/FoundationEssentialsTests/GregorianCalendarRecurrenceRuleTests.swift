@@ -959,4 +959,73 @@ private struct GregorianCalendarRecurrenceRuleTests {
         #expect(results.next() == Date(timeIntervalSince1970: 1287151200.0)) // 2010-10-15T14:00:00-0000
         // No upper bound
     }
+
+    @Test func occurrencesInIntervalMatchReplay() async {
+        let eventStart = Date(timeIntervalSince1970: 1285077600.0) // 2010-09-21T14:00:00-0000
+        let interval = DateInterval(start: Date(timeIntervalSince1970: 1704067200.0), // 2024-01-01T00:00:00-0000
+                                    end: Date(timeIntervalSince1970: 2019686400.0))   // 2034-01-01T00:00:00-0000
+
+        var everyOtherWeek = Calendar.RecurrenceRule(calendar: gregorian, frequency: .weekly, interval: 2)
+        everyOtherWeek.weekdays = [.every(.monday), .every(.friday)]
+        var lastWeekdayOfMonth = Calendar.RecurrenceRule(calendar: gregorian, frequency: .monthly)
+        lastWeekdayOfMonth.weekdays = [.every(.monday), .every(.tuesday), .every(.wednesday), .every(.thursday), .every(.friday)]
+        lastWeekdayOfMonth.setPositions = [-1]
+        let rules: [Calendar.RecurrenceRule] = [
+            .daily(calendar: gregorian, interval: 3),
+            everyOtherWeek,
+            .monthly(calendar: gregorian, interval: 5),
+            lastWeekdayOfMonth,
+            .yearly(calendar: gregorian),
+            .hourly(calendar: gregorian, interval: 7),
+        ]
+        for rule in rules {
+            // Enumerating from the start date visits every period before the interval
+            let replayed = rule.recurrences(of: eventStart)
+                .lazy
+                .prefix { $0 <= interval.end }
+                .filter { $0 >= interval.start }
+            let expected = Array(replayed)
+            #expect(!expected.isEmpty)
+            #expect(Array(rule.recurrences(of: eventStart, in: interval.start...interval.end)) == expected, "\(rule)")
+            #expect(await rule.occurrences(of: eventStart, in: interval) == expected, "\(rule)")
+            #expect(await rule.count(of: eventStart, in: interval) == expected.count, "\(rule)")
+        }
+    }
+
+    @Test func occurrencesInIntervalMatchReplayAcrossDaylightSavingTime() async throws {
+        var calendar = Calendar(identifier: .gregorian)
+        calendar.timeZone = try #require(TimeZone(identifier: "America/Los_Angeles"))
+        // 01:30 local time repeats when daylight saving time ends
+        let eventStart = Date(timeIntervalSince1970: 1285057800.0) // 2010-09-21T01:30:00-0700
+        // Includes the 2024-03-10 and 2024-11-03 transitions
+        let interval = DateInterval(start: Date(timeIntervalSince1970: 1704096000.0), // 2024-01-01T00:00:00-0800
+                                    end: Date(timeIntervalSince1970: 1735718400.0))   // 2025-01-01T00:00:00-0800
+
+        let rules: [Calendar.RecurrenceRule] = [
+            .hourly(calendar: calendar, interval: 2),
+            .daily(calendar: calendar),
+        ]
+        for rule in rules {
+            let expected = Array(rule.recurrences(of: eventStart).lazy.prefix { $0 <= interval.end }.filter { $0 >= interval.start })
+            #expect(!expected.isEmpty)
+            #expect(Array(rule.recurrences(of: eventStart, in: interval.start...interval.end)) == expected, "\(rule)")
+            #expect(await rule.occurrences(of: eventStart, in: interval) == expected, "\(rule)")
+            #expect(await rule.count(of: eventStart, in: interval) == expected.count, "\(rule)")
+        }
+    }
+
+    @Test func occurrencesInIntervalWithoutSeeking() async {
+        // A monthly recurrence on the 31st doesn't match once in every month,
+        // so it can't seek and the interval is enumerated as a single range
+        let eventStart = Date(timeIntervalSince1970: 1264946400.0) // 2010-01-31T14:00:00-0000
+        let interval = DateInterval(start: Date(timeIntervalSince1970: 1704067200.0), // 2024-01-01T00:00:00-0000
+                                    end: Date(timeIntervalSince1970: 2019686400.0))   // 2034-01-01T00:00:00-0000
+        let rule = Calendar.RecurrenceRule.monthly(calendar: gregorian)
+        #expect(rule._concurrentChunks(of: interval, from: eventStart).count == 1)
+
+        let expected = Array(rule.recurrences(of: eventStart).lazy.prefix { $0 <= interval.end }.filter { $0 >= interval.start })
+        #expect(!expected.isEmpty)
+        #expect(await rule.occurrences(of: eventStart, in: interval) == expected)
+        #expect(await rule.count(of: eventStart, in: interval) == expected.count)
+    }
 }
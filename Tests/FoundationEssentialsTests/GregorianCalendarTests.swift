@@ -274,6 +274,73 @@ private struct GregorianCalendarTests {
         test(Date(timeIntervalSince1970: -210866760000.0), expectedEra: 0, year: 4713, month: 1, day: 1, hour: 12, minute: 0, second: 0, nanosecond: 0, weekday: 2, weekdayOrdinal: 1, quarter: 1, weekOfMonth: 1, weekOfYear: 1, yearForWeekOfYear: -4712, isLeapMonth: false)
     }
 
+    @available(FoundationPreview 6.5, *)
+    @Test func testDateComponentsFromDates() throws {
+        let components: Set<Calendar.Component> = [.era, .year, .month, .day, .hour, .minute, .second, .nanosecond, .weekday, .weekdayOrdinal, .quarter, .weekOfMonth, .dayOfYear]
+
+        // Ascending, crossing DST transitions, followed by dates out of order, around the Gregorian cutover and out of range
+        var dates = (0 ..< 5000).map { Date(timeIntervalSince1970: 1677628800 + Double($0) * 4321.25) } // From 2023-03-01
+        dates += (0 ..< 500).map { Date(timeIntervalSince1970: Double(($0 * 7919) % 500) * 86400 * 37 - 1e9) }
+        dates += [Date(timeIntervalSince1970: -12219292800), Date(timeIntervalSince1970: -12219292801), Date(timeIntervalSince1970: -12212553600), Date(timeIntervalSince1970: -62135769600), .distantPast, .distantFuture, Date(timeIntervalSince1970: 1e15)]
+
+        func test(_ calendar: Calendar, _ components: Set<Calendar.Component>, sourceLocation: SourceLocation = #_sourceLocation) {
+            var columns = Calendar.ComponentColumns()
+            calendar.dateComponents(components, from: dates, appendingTo: &columns)
+            var expected = Calendar.ComponentColumns()
+            for date in dates {
+                expected.append(calendar.dateComponents(components, from: date), for: Calendar.ComponentSet(components))
+            }
+            #expect(columns == expected, sourceLocation: sourceLocation)
+        }
+
+        for identifier in ["America/Los_Angeles", "Australia/Lord_Howe", "Asia/Kathmandu", "GMT"] {
+            var calendar = Calendar(identifier: .gregorian)
+            calendar.timeZone = try #require(TimeZone(identifier: identifier))
+            calendar.firstWeekday = 2
+            calendar.minimumDaysInFirstWeek = 4
+            test(calendar, components)
+            test(calendar, [.day, .hour])
+            // Week of year goes through the per-date path
+            test(calendar, [.year, .weekOfYear, .yearForWeekOfYear])
+        }
+
+        // Appends to what is already there
+        var columns = Calendar.ComponentColumns()
+        columns.year = [1]
+        Calendar(identifier: .gregorian).dateComponents([.year], from: [Date(timeIntervalSince1970: 0)], appendingTo: &columns)
+        #expect(columns.year.count == 2)
+        #expect(columns.month.isEmpty)
+    }
+
+    @Test func testDateComponentsFromDate_sameDay() {
+        // Consecutive conversions on the same day reuse the last day's result; it should not leak into other days
+        let calendar = _CalendarGregorian(identifier: .gregorian, timeZone: TimeZone(secondsFromGMT: -28800)!, locale: nil, firstWeekday: 1, minimumDaysInFirstWeek: 1, gregorianStartDate: nil)
+        let reference = _CalendarGregorian(identifier: .gregorian, timeZone: TimeZone(secondsFromGMT: -28800)!, locale: nil, firstWeekday: 1, minimumDaysInFirstWeek: 1, gregorianStartDate: nil)
+        let components: Calendar.ComponentSet = [.era, .year, .month, .day, .hour, .minute, .second, .weekday, .dayOfYear]
+        var dates = (0 ..< 200).map { Date(timeIntervalSince1970: 1709193600 + Double($0) * 1234.5) } // From 2024-02-29T08:00:00Z
+        dates += [Date(timeIntervalSince1970: -12219292800), Date(timeIntervalSince1970: 1709193600), Date(timeIntervalSince1970: -12219292800 - 86400 * 3), Date(timeIntervalSince1970: 1709193600)]
+
+        // `reference` converts another day first, so it never has this day remembered
+        func uncached<T>(_ body: () -> T) -> T {
+            _ = reference.dateComponents(components, from: Date(timeIntervalSince1970: 0))
+            return body()
+        }
+
+        for date in dates {
+            let dc = calendar.dateComponents(components, from: date)
+            #expect(dc == uncached { reference.dateComponents(components, from: date) }, "\(date.timeIntervalSince1970)")
+
+            // And back, including days that are not valid
+            var roundTrip = dc
+            roundTrip.weekday = nil
+            roundTrip.dayOfYear = nil
+            #expect(calendar.date(from: roundTrip) == Date(timeIntervalSince1970: date.timeIntervalSince1970.rounded(.down)), "\(date.timeIntervalSince1970)")
+            roundTrip.day = 31
+            roundTrip.month = 2
+            #expect(calendar.date(from: roundTrip) == uncached { reference.date(from: roundTrip) }, "\(date.timeIntervalSince1970)")
+        }
+    }
+
     // MARK: - Add
 
     @Test func testAdd() {
@@ -1549,7 +1616,81 @@ private struct GregorianCalendarTests {
         test(.minute, expected: -120)
         test(.second, expected: -7200)
     }
-    
+
+    // MARK: - Exact matches
+
+    @Test func testExactMatches() throws {
+        var calendar = Calendar(identifier: .gregorian)
+        calendar.timeZone = try #require(TimeZone(identifier: "America/Los_Angeles"))
+        let y2000 = Date(timeIntervalSince1970: 946713600) // 2000-01-01T00:00:00-0800
+        let y2024 = Date(timeIntervalSince1970: 1704096000) // 2024-01-01T00:00:00-0800
+        let y2025 = Date(timeIntervalSince1970: 1735718400) // 2025-01-01T00:00:00-0800
+
+        // The matches of the search in `Calendar_Enumerate.swift`, without computing any directly
+        func strictMatches(_ components: DateComponents, after start: Date, count: Int, direction: Calendar.SearchDirection = .forward, until end: Date? = nil) -> [Date] {
+            var matches: [Date] = []
+            calendar._enumerateDates(startingAfter: start, matching: components, matchingPolicy: .strict, repeatedTimePolicy: .first, direction: direction, computingExactMatches: false) { date, _, stop in
+                guard let date, end.map({ date < $0 }) ?? true else {
+                    stop = true
+                    return
+                }
+                matches.append(date)
+                stop = matches.count == count
+            }
+            return matches
+        }
+
+        // February 29 on a Monday
+        let leapMonday = DateComponents(month: 2, day: 29, weekday: 2)
+        #expect(strictMatches(leapMonday, after: y2000, count: 3) == [1456732800, 2340345600, 3223958400].map { Date(timeIntervalSince1970: $0) })
+        #expect(calendar.nextDate(after: y2000, matching: leapMonday, matchingPolicy: .strict) == Date(timeIntervalSince1970: 1456732800))
+        #expect(calendar.date(2, matching: leapMonday, startingAfter: y2000) == Date(timeIntervalSince1970: 2340345600))
+
+        // Friday the 13th
+        let friday13 = DateComponents(day: 13, weekday: 6)
+        #expect(calendar.date(10, matching: friday13, startingAfter: y2000) == Date(timeIntervalSince1970: 1137139200)) // 2006-01-13
+        #expect(calendar.date(10, matching: friday13, startingAfter: y2000) == strictMatches(friday13, after: y2000, count: 10).last)
+        #expect(calendar.numberOfDates(matching: friday13, in: y2000 ..< Date(timeIntervalSince1970: 4102473600)) == 172) // Through 2099
+
+        // The fifth Friday of a month, and the 31st
+        let fifthFriday = DateComponents(weekday: 6, weekdayOrdinal: 5)
+        #expect(strictMatches(fifthFriday, after: y2024, count: 3) == [1711695600, 1717138800, 1725001200].map { Date(timeIntervalSince1970: $0) })
+        #expect(calendar.numberOfDates(matching: DateComponents(day: 31), in: y2024 ..< y2025) == 7)
+        #expect(strictMatches(DateComponents(day: 31), after: Date(timeIntervalSince1970: 1709280000), count: 1, direction: .backward) == [Date(timeIntervalSince1970: 1706688000)]) // From 2024-03-01 back to 2024-01-31
+
+        // 02:30 is skipped on 2024-03-10, and 01:30 repeated on 2024-11-03
+        let skipped = DateComponents(hour: 2, minute: 30)
+        #expect(calendar.numberOfDates(matching: skipped, in: y2024 ..< y2025) == 365)
+        #expect(calendar.date(70, matching: skipped, startingAfter: y2024) == Date(timeIntervalSince1970: 1710149400)) // 2024-03-11T02:30:00-0700
+        #expect(calendar.date(70, matching: skipped, startingAfter: y2024) == strictMatches(skipped, after: y2024, count: 70).last)
+        let repeated = DateComponents(hour: 1, minute: 30)
+        #expect(calendar.numberOfDates(matching: repeated, in: y2024 ..< y2025) == 366)
+        #expect(calendar.date(1, matching: repeated, startingAfter: Date(timeIntervalSince1970: 1730600000)) == Date(timeIntervalSince1970: 1730622600))
+        #expect(calendar.date(1, matching: repeated, startingAfter: Date(timeIntervalSince1970: 1730600000), repeatedTimePolicy: .last) == Date(timeIntervalSince1970: 1730626200))
+
+        // Counting agrees with the sequence, including a match at the start of the range
+        let secondTuesdayNoon = DateComponents(hour: 12, weekday: 3, weekdayOrdinal: 2)
+        let matches = strictMatches(secondTuesdayNoon, after: y2000, count: 40)
+        #expect(calendar.numberOfDates(matching: secondTuesdayNoon, in: matches[5] ..< matches[30]) == 25)
+        #expect(calendar.date(40, matching: secondTuesdayNoon, startingAfter: y2000) == matches.last)
+        #expect(calendar.date(39, matching: secondTuesdayNoon, startingAfter: matches.last!, direction: .backward) == matches.first)
+        #expect(calendar.date(0, matching: secondTuesdayNoon, startingAfter: y2000) == nil)
+
+        // Without an hour, a match is at the start of its day, even when midnight is skipped
+        calendar.timeZone = try #require(TimeZone(identifier: "America/Santiago"))
+        let santiago2024 = Date(timeIntervalSince1970: 1704078000) // 2024-01-01T00:00:00-0300
+        let santiago2026 = Date(timeIntervalSince1970: 1767236400) // 2026-01-01T00:00:00-0300
+        let noMidnight = Date(timeIntervalSince1970: 1725768000) // 2024-09-08T01:00:00-0300
+        for components in [DateComponents(day: 8), DateComponents(weekday: 1), DateComponents(month: 9, day: 8)] {
+            let stepped = strictMatches(components, after: santiago2024, count: 60)
+            #expect(stepped.contains(noMidnight))
+            #expect(Array(calendar.dates(byMatching: components, startingAt: santiago2024, matchingPolicy: .strict).prefix(60)) == stepped)
+            #expect(calendar.date(60, matching: components, startingAfter: santiago2024) == stepped.last)
+            let steppedCount = strictMatches(components, after: Date(timeIntervalSince1970: 1704077999), count: .max, until: santiago2026).count
+            #expect(calendar.numberOfDates(matching: components, in: santiago2024 ..< santiago2026) == steppedCount)
+        }
+    }
+
     // MARK: ISO8601
     
     @Test func test_iso8601Gregorian() {
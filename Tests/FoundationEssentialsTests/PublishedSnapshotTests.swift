@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+#if canImport(TestSupport)
+import TestSupport
+#endif
+
+#if FOUNDATION_FRAMEWORK
+@testable import Foundation
+#else
+@testable import FoundationEssentials
+#endif
+
+@Suite("PublishedSnapshot")
+private struct PublishedSnapshotTests {
+    // `_PublishedSnapshot` is noncopyable, so tasks share it through a class
+    final class Box: Sendable {
+        let snapshot = _PublishedSnapshot<[Int]>()
+    }
+
+    @Test func publishAndClear() {
+        let box = Box()
+        #expect(box.snapshot.value == nil)
+
+        #expect(box.snapshot.publishIfAbsent([1]) == [1])
+        #expect(box.snapshot.publishIfAbsent([2]) == [1])
+        #expect(box.snapshot.value == [1])
+
+        box.snapshot.publish([3])
+        #expect(box.snapshot.value == [3])
+
+        box.snapshot.publish(nil)
+        #expect(box.snapshot.value == nil)
+        #expect(box.snapshot.publishIfAbsent([4]) == [4])
+        #expect(box.snapshot.value == [4])
+    }
+
+    @Test func concurrentPublishAndRead() async {
+        let box = Box()
+        let publishes = 10_000
+        box.snapshot.publish(Array(repeating: 0, count: 16))
+
+        let failures = await withTaskGroup(of: Int.self) { group in
+            group.addTask {
+                for i in 1 ... publishes {
+                    // Clearing and republishing retires snapshots while readers may still hold them
+                    if i % 100 == 0 {
+                        box.snapshot.publish(nil)
+                        _ = box.snapshot.publishIfAbsent(Array(repeating: i, count: 16))
+                    } else {
+                        box.snapshot.publish(Array(repeating: i, count: 16))
+                    }
+                }
+                return 0
+            }
+            for _ in 0 ..< 4 {
+                group.addTask {
+                    // Read a fixed number of times rather than until the last publish, so readers can't keep
+                    // the publishing task from running on a narrow thread pool
+                    var failures = 0
+                    var last = 0
+                    for _ in 0 ..< 100_000 {
+                        guard let value = box.snapshot.value else {
+                            continue
+                        }
+                        // Every read sees a whole value, and never one older than a previous read
+                        if value.count != 16 || value.contains(where: { $0 != value[0] }) || value[0] < last {
+                            failures += 1
+                        }
+                        last = value[0]
+                    }
+                    return failures
+                }
+            }
+            return await group.reduce(0, +)
+        }
+        #expect(failures == 0)
+        #expect(box.snapshot.value == Array(repeating: publishes, count: 16))
+    }
+}
@@ -268,6 +268,103 @@ private struct StringTests {
         test("\r \r\n \r", "\r", anchored: true, backwards: true, 4..<5)
     }
 
+    @Test func testCompare_asciiPrefix() {
+        func test(_ string1: String, _ string2: String, _ options: String.CompareOptions, _ expectation: ComparisonResult, sourceLocation: SourceLocation = #_sourceLocation) {
+            #expect(string1[...]._unlocalizedCompare(other: string2[...], options: options) == expectation, sourceLocation: sourceLocation)
+        }
+
+        let prefix = String(repeating: "The Quick Brown Fox ", count: 5)
+        test(prefix + "jumps", prefix.uppercased() + "JUMPS", .caseInsensitive, .orderedSame)
+        test(prefix + "jumpa", prefix.uppercased() + "JUMPS", .caseInsensitive, .orderedAscending)
+        test(prefix + "jumps", prefix.uppercased() + "JUMP", .caseInsensitive, .orderedDescending)
+        test(prefix + "jumps", prefix.uppercased() + "JUMPS", [.caseInsensitive, .literal], .orderedSame)
+        test(prefix + "jumps", prefix + "jumps", .widthInsensitive, .orderedSame)
+        // Case-folded letters sort after '_', which lies between the upper and lower case letters
+        test(prefix + "A", prefix + "_", .caseInsensitive, .orderedDescending)
+
+        // Differences after the ASCII prefix
+        test(prefix + "абв", prefix.lowercased() + "АБВ", .caseInsensitive, .orderedSame)
+        test(prefix + "абв", prefix.lowercased() + "АБГ", .caseInsensitive, .orderedAscending)
+
+        // A non-ASCII byte can extend the last ASCII character
+        test(prefix + "E\u{301}", prefix + "e", [.caseInsensitive, .diacriticInsensitive], .orderedSame)
+        test(prefix + "e", prefix + "E\u{301}", [.caseInsensitive, .diacriticInsensitive], .orderedSame)
+
+        // CR-LF is a single character
+        test(prefix + "\r\n", prefix.uppercased() + "\r\n", .caseInsensitive, .orderedSame)
+        test(prefix + "\r", prefix + "\r\n", .caseInsensitive, .orderedAscending)
+    }
+
+    @Test func testRangeOfString_asciiCaseInsensitive() throws {
+        func test(_ tested: String, _ string: String, _ options: String.CompareOptions, _ expectation: Range<Int>?, sourceLocation: SourceLocation = #_sourceLocation) throws {
+            let result = try tested[...]._range(of: string[...], options: options)
+            let readableRange = result.map { tested.distance(from: tested.startIndex, to: $0.lowerBound) ..< tested.distance(from: tested.startIndex, to: $0.upperBound) }
+            #expect(readableRange == expectation, sourceLocation: sourceLocation)
+        }
+
+        let text = String(repeating: "lorem ipsum dolor sit amet, ", count: 4) + "Needle in a haystack"
+        try test(text, "NEEDLE", .caseInsensitive, 112 ..< 118)
+        try test(text, "LOREM", [.caseInsensitive, .backwards], 84 ..< 89)
+        try test(text, "LOREM", [.caseInsensitive, .anchored], 0 ..< 5)
+        try test(text, "HAYSTACK", [.caseInsensitive, .anchored, .backwards], 124 ..< 132)
+        try test(text, "needles", .caseInsensitive, nil)
+
+        // Matches in and after a non-ASCII part
+        let mixed = text + " héllo HELLO"
+        try test(mixed, "hello", .caseInsensitive, 139 ..< 144)
+        try test(mixed, "hello", .diacriticInsensitive, 133 ..< 138)
+        try test(mixed, "hello", [.caseInsensitive, .diacriticInsensitive], 133 ..< 138)
+        try test(mixed, "hello", [.caseInsensitive, .backwards], 139 ..< 144)
+
+        // A match cannot end in a character that a combining mark extends
+        let combining = text + "e\u{301}"
+        try test(combining, "stacke", .caseInsensitive, nil)
+        try test(combining, "stacke", [.caseInsensitive, .diacriticInsensitive], 127 ..< 133)
+
+        // Nor split CR-LF
+        let lines = text + "\r\nnext"
+        try test(lines, "\nNEXT", .caseInsensitive, nil)
+        try test(lines, "\r\nNEXT", .caseInsensitive, 132 ..< 137)
+        try test(lines, "K\r", .caseInsensitive, nil)
+    }
+
+    @Test func testSearcher() {
+        func offsets(_ range: Range<String.Index>?, in string: String) -> Range<Int>? {
+            range.map { string.distance(from: string.startIndex, to: $0.lowerBound) ..< string.distance(from: string.startIndex, to: $0.upperBound) }
+        }
+
+        let text = String(repeating: "lorem ipsum dolor sit amet, ", count: 4) + "Needle in a haystack"
+        #expect(offsets(text.range(of: String.Searcher(pattern: "NEEDLE", options: .caseInsensitive)), in: text) == 112 ..< 118)
+        #expect(offsets(text.range(of: String.Searcher(pattern: "lorem")), in: text) == 0 ..< 5)
+        #expect(offsets(text.range(of: String.Searcher(pattern: "lorem", options: .backwards)), in: text) == 84 ..< 89)
+        #expect(offsets(text.range(of: String.Searcher(pattern: "lorem", options: .anchored), range: text.index(text.startIndex, offsetBy: 28) ..< text.endIndex), in: text) == 28 ..< 33)
+        #expect(text.range(of: String.Searcher(pattern: "Lorem")) == nil)
+        #expect(text.range(of: String.Searcher(pattern: "")) == nil)
+        #expect(!"".contains(String.Searcher(pattern: "a")))
+
+        // Patterns long enough to use the shift tables
+        let long = "AMET, LOREM IPSUM DOLOR SIT AMET, NEEDLE"
+        #expect(offsets(text.range(of: String.Searcher(pattern: long, options: .caseInsensitive)), in: text) == 78 ..< 118)
+        #expect(offsets(text.range(of: String.Searcher(pattern: long.lowercased(), options: [.caseInsensitive, .backwards])), in: text) == 78 ..< 118)
+        #expect(text.range(of: String.Searcher(pattern: long)) == nil)
+        let repeated = String.Searcher(pattern: "lorem ipsum dolor sit amet, lorem ipsum", options: .backwards)
+        #expect(offsets(text.range(of: repeated), in: text) == 56 ..< 95)
+
+        // Non-ASCII patterns and haystacks
+        #expect(offsets("ÉCOLE école".range(of: String.Searcher(pattern: "école", options: .caseInsensitive)), in: "ÉCOLE école") == 0 ..< 5)
+        #expect(offsets("résumé resume".range(of: String.Searcher(pattern: "resume", options: [.diacriticInsensitive, .backwards])), in: "résumé resume") == 7 ..< 13)
+        #expect("cafe\u{301}".contains(String.Searcher(pattern: "cafe")) == false)
+        #expect("line\r\nnext".contains(String.Searcher(pattern: "\nnext")) == false)
+
+        // Reuse across many strings
+        let searcher = String.Searcher(pattern: "ERROR", options: .caseInsensitive)
+        let lines = ["info: started", "error: disk full", "Warning: slow", "fatal ERROR"]
+        #expect(lines.filter { $0.contains(searcher) } == ["error: disk full", "fatal ERROR"])
+
+        #expect("a, b,c, ".components(separatedBy: String.Searcher(pattern: ", ")) == ["a", "b,c", ""])
+        #expect("oneANDtwoandthree".components(separatedBy: String.Searcher(pattern: "and", options: [.caseInsensitive, .anchored])) == ["one", "two", "three"])
+    }
+
     @Test func testTryFromUTF16() {
         func test(_ utf16Buffer: [UInt16], expected: String?, sourceLocation: SourceLocation = #_sourceLocation) {
             let result = utf16Buffer.withUnsafeBufferPointer {
@@ -327,7 +424,30 @@ private struct StringTests {
         let end = str.index(str.startIndex, offsetBy: 9)
         #expect(range == start ..< end)
     }
-    
+
+    @Test func regexPatternCache() throws {
+        let cache = RegexPatternCache(capacity: 2, shardCount: 1)
+        let insensitive = try cache.regex(for: "b+", caseInsensitive: true)
+        #expect("aBBc".contains(insensitive))
+        let sensitive = try cache.regex(for: "b+", caseInsensitive: false)
+        #expect(!"aBBc".contains(sensitive))
+        #expect(cache.metrics == .init(hits: 0, misses: 2, evictions: 0))
+
+        // Reusing the case insensitive pattern makes the case sensitive one the least recently used
+        _ = try cache.regex(for: "b+", caseInsensitive: true)
+        _ = try cache.regex(for: "c", flavor: .pattern)
+        #expect(cache.metrics == .init(hits: 1, misses: 3, evictions: 1))
+        _ = try cache.regex(for: "b+", caseInsensitive: true)
+        #expect(cache.metrics == .init(hits: 2, misses: 3, evictions: 1))
+        _ = try cache.regex(for: "b+", caseInsensitive: false)
+        #expect(cache.metrics == .init(hits: 2, misses: 4, evictions: 2))
+
+        // Invalid patterns are compiled once, and throw on every lookup
+        #expect(throws: (any Error).self) { try cache.regex(for: "(", flavor: .pattern) }
+        #expect(throws: (any Error).self) { try cache.regex(for: "(", flavor: .pattern) }
+        #expect(cache.metrics == .init(hits: 3, misses: 5, evictions: 3))
+    }
+
     @Test func testParagraphLineRangeOfSeparator() {
         for separator in ["\n", "\r", "\r\n", "\u{2029}", "\u{2028}", "\u{85}"] {
             let range = separator.startIndex ..< separator.endIndex
@@ -345,6 +465,52 @@ private struct StringTests {
         #expect(lineResult.end == string.endIndex)
         #expect(lineResult.contentsEnd == string.endIndex)
     }
+
+    @Test func testLineBoundsInLongText() {
+        // Long enough that the separators are found a vector at a time, with near misses in between
+        let filler = String(repeating: "lorem ipsum “dolor” sit amet — ", count: 3)
+        for separator in ["\n", "\r", "\r\n", "\u{2029}", "\u{2028}", "\u{85}"] {
+            let string = filler + separator + filler + "é" + separator + filler
+            let firstEnd = string.index(string.startIndex, offsetBy: filler.count)
+            let secondStart = string.index(after: firstEnd)
+            let secondEnd = string.index(secondStart, offsetBy: filler.count + 1)
+            let thirdStart = string.index(after: secondEnd)
+
+            let line = string._lineBounds(around: string.index(secondStart, offsetBy: 40) ..< string.index(secondStart, offsetBy: 41))
+            #expect(line.start == secondStart)
+            #expect(line.contentsEnd == secondEnd)
+            #expect(line.end == thirdStart)
+
+            let lastLine = string._lineBounds(around: string.index(before: string.endIndex) ..< string.endIndex)
+            #expect(lastLine.start == thirdStart)
+            #expect(lastLine.end == string.endIndex)
+
+            let paragraph = string._paragraphBounds(around: string.index(secondStart, offsetBy: 40) ..< string.index(secondStart, offsetBy: 41))
+            if separator == "\u{2028}" || separator == "\u{85}" {
+                #expect(paragraph.start == string.startIndex)
+                #expect(paragraph.end == string.endIndex)
+            } else {
+                #expect(paragraph.start == secondStart)
+                #expect(paragraph.end == thirdStart)
+            }
+        }
+    }
+
+    @Test func testLines() {
+        #expect(Array("".lines).isEmpty)
+        #expect(Array("one".lines) == ["one"])
+        #expect(Array("one\n".lines) == ["one"])
+        #expect(Array("\n".lines) == [""])
+        #expect(Array("one\ntwo\r\nthree\rfour\u{85}five\u{2028}six\u{2029}seven".lines) == ["one", "two", "three", "four", "five", "six", "seven"])
+        #expect(Array("one\n\ntwo\r\r\n".lines) == ["one", "", "two", ""])
+        #expect(Array("A\u{200D}B\u{2027}C".lines) == ["A\u{200D}B\u{2027}C"])
+
+        let log = (0 ..< 100).map { "line \($0) — “ok”" }.joined(separator: "\r\n")
+        #expect(Array(log.lines) == (0 ..< 100).map { "line \($0) — “ok”" })
+
+        let substring = log.dropFirst(5).prefix(29)
+        #expect(Array(substring.lines) == ["0 — “ok”", "line 1 — “ok”", "line 2"])
+    }
     
     @Test func testFileSystemRepresentation() throws {
         func assertCString(_ ptr: UnsafePointer<CChar>, equals other: String, sourceLocation: SourceLocation = #_sourceLocation) {
@@ -958,6 +1124,78 @@ private struct StringTests {
         #expect("".appendingPathComponent("") == "")
     }
 
+    #if !os(Windows)
+    @Test func pathBuilder() throws {
+        func appending(_ path: String, _ component: String, standardizingPath: Bool = false) throws -> String {
+            var builder = try #require(_PathBuilder(fileSystemRepresentationOf: path))
+            if standardizingPath {
+                builder.compressSlashes()
+                builder.removeTrailingSlashes()
+            }
+            builder.appendComponent(component)
+            return builder.path
+        }
+        func deletingLastComponent(_ path: String) throws -> String {
+            var builder = try #require(_PathBuilder(fileSystemRepresentationOf: path))
+            builder.removeLastComponent()
+            return builder.path
+        }
+
+        // Matches appendingPathComponent and deletingLastPathComponent once the slashes of the path are standardized
+        for path in ["/a/b/c", "", "/", "q", "/aaa", "/a/b/c/", "hello/", "hello///", "//"] {
+            for component in ["test", "/test", "///test", "test/", "test///test2/", "/", ""] {
+                #expect(try appending(path, component, standardizingPath: true) == path.appendingPathComponent(component), "\(path) + \(component)")
+            }
+            #expect(try deletingLastComponent(path) == path.deletingLastPathComponent(), "\(path)")
+        }
+        #expect(try deletingLastComponent("a//b//") == "a")
+
+        // The existing path is kept as it is, including its trailing slashes
+        for path in ["/a/b/c/", "hello/", "hello///", "//"] {
+            for component in ["test", "/test", "///test", "test/", "test///test2/", "/", ""] {
+                let standardized = String("x".appendingPathComponent(component).dropFirst(2))
+                #expect(try appending(path, component) == path + standardized, "\(path) + \(component)")
+            }
+        }
+        for path in ["a//", "//"] {
+            var builder = try #require(_PathBuilder(fileSystemRepresentationOf: path))
+            let base = builder.count
+            for (name, appended) in [("comp", "comp"), ("x", "x"), ("/other/", "other")] {
+                builder.truncate(to: base)
+                #expect(builder.path == path)
+                builder.appendComponent(name)
+                #expect(builder.path == path + appended)
+            }
+            builder.truncate(to: base)
+            #expect(builder.path == path)
+        }
+
+        // Appending past the initial capacity and truncating back
+        var builder = _PathBuilder(capacity: 4)
+        builder.appendComponent("/usr")
+        let base = builder.count
+        for name in ["local", "share", String(repeating: "x", count: 300)] {
+            builder.truncate(to: base)
+            builder.appendComponent(name)
+            #expect(builder.path == "/usr/" + name)
+            #expect(builder.withFileSystemRepresentation { strlen($0!) } == builder.count)
+        }
+        builder.truncate(to: base)
+        #expect(builder.path == "/usr")
+        #expect(builder.span.count == 4 && builder.span[3] == UInt8(ascii: "r"))
+
+        var dotted = try #require(_PathBuilder(fileSystemRepresentationOf: "/a//b/./c/../d/"))
+        dotted.compressSlashes()
+        #expect(dotted.path == "/a/b/./c/../d/")
+        dotted.removeDotSegments()
+        #expect(dotted.path == "/a/b/d/")
+
+        var dot = try #require(_PathBuilder(fileSystemRepresentationOf: "./"))
+        dot.removeDotSegments()
+        #expect(dot.path == "./".removingDotSegments)
+    }
+    #endif
+
     @Test func dataUsingEncoding() {
         let s = "hello 🧮"
         
@@ -1084,6 +1322,32 @@ private struct StringTests {
         #expect(String(bytes: helloWorld + utf8BOM, encoding: .utf8) == "Hello, world\u{FEFF}")
     }
 
+    @Test func dataUsingEncoding_longText() {
+        // Long runs of ASCII with other scalars at every offset, so that each falls at a different position within a block
+        var strings = [String(repeating: "a", count: 100), String(repeating: "é", count: 100)]
+        for scalar in ["é", "€", "🧮"] {
+            for offset in 0 ..< 40 {
+                strings.append(String(repeating: "x", count: offset) + scalar + String(repeating: "y", count: 70))
+            }
+        }
+        let utf16Encodings: [String.Encoding] = [.utf16BigEndian, .utf16LittleEndian, .utf16]
+        let utf32Encodings: [String.Encoding] = [.utf32BigEndian, .utf32LittleEndian, .utf32]
+        for s in strings {
+            for encoding in utf16Encodings + utf32Encodings {
+                let data = s.data(using: encoding)
+                #expect(data.flatMap { String(data: $0, encoding: encoding) } == s, "\(encoding)")
+            }
+            #expect(s.data(using: .utf16BigEndian) == Data(s.utf16.flatMap { [UInt8($0 >> 8), UInt8($0 & 0xFF)] }))
+            #expect(s.data(using: .utf32LittleEndian) == Data(s.unicodeScalars.flatMap { withUnsafeBytes(of: $0.value.littleEndian, Array.init) }))
+        }
+
+        // A lone surrogate after a long run of ASCII
+        let loneSurrogate = Data(String(repeating: "a", count: 40).utf16.flatMap { [0, UInt8($0)] } + [0xDC, 0x00] + [0, 0x61])
+        #expect(String(data: loneSurrogate, encoding: .utf16BigEndian) == nil)
+        let surrogatePair = Data(String(repeating: "a", count: 40).utf16.flatMap { [UInt8($0), 0] } + [0x3E, 0xD8, 0xEE, 0xDD])
+        #expect(String(data: surrogatePair, encoding: .utf16LittleEndian) == String(repeating: "a", count: 40) + "🧮")
+    }
+
     @Test func dataUsingEncoding_preservingBOM() {
         func roundTrip(_ data: Data) -> Bool {
             let str = String(data: data, encoding: .utf8)!
@@ -0,0 +1,202 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Testing
+
+#if canImport(TestSupport)
+import TestSupport
+#endif
+
+#if FOUNDATION_FRAMEWORK
+@testable import Foundation
+#else
+@testable import FoundationEssentials
+#endif
+
+@Suite("TimeZone TZif")
+private struct TimeZoneTZifTests {
+    /// Builds a version 2 TZif file with the same data in both the 32-bit and 64-bit sections.
+    func tzif(transitions: [(time: Int64, type: UInt8)], types: [(offset: Int32, isDST: Bool, abbreviationIndex: UInt8)], abbreviations: String, footer: String) -> [UInt8] {
+        var bytes = [UInt8]()
+        func append<T: FixedWidthInteger>(_ value: T) {
+            withUnsafeBytes(of: value.bigEndian) { bytes.append(contentsOf: $0) }
+        }
+        let abbreviationBytes = Array(abbreviations.utf8)
+        for timeSize in [4, 8] {
+            bytes += Array("TZif2".utf8) + Array(repeating: 0, count: 15)
+            for count in [0, 0, 0, transitions.count, types.count, abbreviationBytes.count] {
+                append(UInt32(count))
+            }
+            for transition in transitions {
+                if timeSize == 4 {
+                    append(Int32(transition.time))
+                } else {
+                    append(transition.time)
+                }
+            }
+            bytes += transitions.map(\.type)
+            for type in types {
+                append(type.offset)
+                bytes += [type.isDST ? 1 : 0, type.abbreviationIndex]
+            }
+            bytes += abbreviationBytes
+        }
+        bytes += Array("\n\(footer)\n".utf8)
+        return bytes
+    }
+
+    @Test func parsesFileAndFooter() throws {
+        let bytes = tzif(transitions: [(946684800, 1)], types: [(-17762, false, 0), (-18000, false, 4), (-14400, true, 8)], abbreviations: "LMT\0EST\0EDT\0", footer: "EST5EDT,M3.2.0,M11.1.0")
+        let zone = try #require(bytes.withUnsafeBytes { _TZifZone(tzif: $0) })
+
+        // Before the first transition
+        #expect(zone.period(at: 0).secondsFromGMT == -17762)
+        #expect(zone.abbreviation(of: zone.period(at: 0)) == "LMT")
+
+        // Tabulated from the footer: 2000-07-01
+        #expect(zone.period(at: 962409600).secondsFromGMT == -14400)
+        #expect(zone.period(at: 962409600).daylightSavingOffset == 3600)
+        #expect(zone.abbreviation(of: zone.period(at: 962409600)) == "EDT")
+
+        // Computed from the footer: 2200-01-15 and 2200-07-01
+        #expect(zone.period(at: 7259328000).secondsFromGMT == -18000)
+        #expect(zone.period(at: 7273756800).secondsFromGMT == -14400)
+        #expect(zone.nextTransition(after: 7259328000) == 7263932400)
+        #expect(zone.fixedOffset == nil)
+    }
+
+    @Test func rejectsMalformedFiles() {
+        let valid = tzif(transitions: [], types: [(3600, false, 0)], abbreviations: "CET\0", footer: "CET-1")
+        #expect(valid.withUnsafeBytes { _TZifZone(tzif: $0) }?.fixedOffset == 3600)
+
+        // Truncated
+        #expect(valid.dropLast(3).withUnsafeBytes { _TZifZone(tzif: $0) } == nil)
+        // Not a TZif file
+        #expect(Array("# tzdb timezone descriptions\n".utf8).withUnsafeBytes { _TZifZone(tzif: $0) } == nil)
+        // Transitions out of order
+        let unordered = tzif(transitions: [(100, 0), (50, 0)], types: [(3600, false, 0)], abbreviations: "CET\0", footer: "CET-1")
+        #expect(unordered.withUnsafeBytes { _TZifZone(tzif: $0) } == nil)
+        // Type index out of range
+        let badType = tzif(transitions: [(100, 1)], types: [(3600, false, 0)], abbreviations: "CET\0", footer: "CET-1")
+        #expect(badType.withUnsafeBytes { _TZifZone(tzif: $0) } == nil)
+        // More transitions than the file has data for
+        var overcounted = valid
+        let header64 = 44 + 6 + 4
+        overcounted.replaceSubrange(header64 + 32 ..< header64 + 36, with: [0xFF, 0xFF, 0xFF, 0xFF])
+        #expect(overcounted.withUnsafeBytes { _TZifZone(tzif: $0) } == nil)
+    }
+
+    @Test func posixRules() throws {
+        let santiago = try #require(_POSIXTimeZoneRule("<-04>4<-03>,M9.1.6/24,M4.1.6/24"[...].utf8))
+        #expect(santiago.standardAbbreviation == "-04")
+        #expect(santiago.standardOffset == -14400)
+        #expect(santiago.daylight?.abbreviation == "-03")
+        #expect(santiago.daylight?.offset == -10800)
+        #expect(santiago.daylight?.start == .init(day: .monthWeekday(month: 9, week: 1, weekday: 6), time: 86400))
+
+        let stJohns = try #require(_POSIXTimeZoneRule("NST3:30NDT,M3.2.0,M11.1.0"[...].utf8))
+        #expect(stJohns.standardOffset == -12600)
+        #expect(stJohns.daylight?.offset == -9000)
+
+        let jerusalem = try #require(_POSIXTimeZoneRule("IST-2IDT,M3.4.4/26,M10.5.0"[...].utf8))
+        #expect(jerusalem.daylight?.start.time == 26 * 3600)
+        #expect(jerusalem.daylight?.end == .init(day: .monthWeekday(month: 10, week: 5, weekday: 0), time: 7200))
+
+        // Daylight saving time all year
+        let allYear = try #require(_POSIXTimeZoneRule("EST5EDT,0/0,J365/25"[...].utf8))
+        #expect(allYear.constantOffsets?.secondsFromGMT == -14400)
+        #expect(allYear.constantOffsets?.daylightSavingOffset == 3600)
+
+        for invalid in ["", "E5", "EST", "EST5EDT,M3.2.0", "EST5EDT,M13.2.0,M11.1.0", "<EST5", "EST5EDT,M3.2.0,M11.1.0junk"] {
+            #expect(_POSIXTimeZoneRule(invalid[...].utf8) == nil, "\(invalid)")
+        }
+    }
+
+    @Test func southernHemisphere() throws {
+        let zone = try #require(_TZifZone(posixRule: "<-04>4<-03>,M9.1.6/24,M4.1.6/24"))
+        // 2024-01-15 is in daylight saving time, 2024-07-15 is not
+        #expect(zone.period(at: 1705276800).secondsFromGMT == -10800)
+        #expect(zone.period(at: 1721001600).secondsFromGMT == -14400)
+        #expect(zone.abbreviation(of: zone.period(at: 1721001600)) == "-04")
+    }
+
+    @Test func negativeSavings() throws {
+        // Europe/Dublin marks winter time as daylight saving time, with negative savings. It is reported as standard
+        // time, and summer time as daylight saving time. 2023-07-15, 2024-01-15 and 2024-07-15:
+        let (july2023, january, july) = (Int64(1689379200), Int64(1705276800), Int64(1721001600))
+        let bytes = tzif(transitions: [(1698541200, 1), (1711846800, 0)], types: [(3600, false, 0), (0, true, 4)], abbreviations: "IST\0GMT\0", footer: "IST-1GMT0,M10.5.0,M3.5.0/1")
+        let file = try #require(bytes.withUnsafeBytes { _TZifZone(tzif: $0) })
+        let rule = try #require(_TZifZone(posixRule: "IST-1GMT0,M10.5.0,M3.5.0/1"))
+        for zone in [file, rule] {
+            #expect(zone.period(at: january).secondsFromGMT == 0)
+            #expect(zone.period(at: january).daylightSavingOffset == 0)
+            #expect(zone.period(at: july).secondsFromGMT == 3600)
+            #expect(zone.period(at: july).daylightSavingOffset == 3600)
+            // Computed from the rule: 2200-01-15 and 2200-07-01
+            #expect(zone.period(at: 7259328000).daylightSavingOffset == 0)
+            #expect(zone.period(at: 7273756800).daylightSavingOffset == 3600)
+        }
+        #expect(file.period(at: july2023).daylightSavingOffset == 3600)
+
+        let dublin = try #require(_TimeZoneTZif(identifier: "Europe/Dublin"))
+        #expect(!dublin.isDaylightSavingTime(for: Date(timeIntervalSince1970: TimeInterval(january))))
+        #expect(dublin.daylightSavingTimeOffset(for: Date(timeIntervalSince1970: TimeInterval(january))) == 0)
+        #expect(dublin.isDaylightSavingTime(for: Date(timeIntervalSince1970: TimeInterval(july))))
+        #expect(dublin.daylightSavingTimeOffset(for: Date(timeIntervalSince1970: TimeInterval(july))) == 3600)
+        #expect(dublin.rawAndDaylightSavingTimeOffset(for: Date(timeIntervalSince1970: TimeInterval(july))).rawOffset == 0)
+    }
+
+    @Test func localTimes() throws {
+        let tz = try #require(_TimeZoneTZif(identifier: "America/Los_Angeles"))
+        func test(_ localTime: Int64, former: (Int, TimeInterval), latter: (Int, TimeInterval), sourceLocation: SourceLocation = #_sourceLocation) {
+            let date = Date(timeIntervalSince1970: TimeInterval(localTime))
+            let formerResult = tz.rawAndDaylightSavingTimeOffset(for: date, repeatedTimePolicy: .former, skippedTimePolicy: .former)
+            let latterResult = tz.rawAndDaylightSavingTimeOffset(for: date, repeatedTimePolicy: .latter, skippedTimePolicy: .latter)
+            #expect(formerResult.rawOffset == former.0 && formerResult.daylightSavingOffset == former.1, sourceLocation: sourceLocation)
+            #expect(latterResult.rawOffset == latter.0 && latterResult.daylightSavingOffset == latter.1, sourceLocation: sourceLocation)
+        }
+        let march12 = Int64(1678579200) // 2023-03-12, as local time
+        let november5 = Int64(1699142400) // 2023-11-05, as local time
+
+        test(march12 + 1 * 3600, former: (-28800, 0), latter: (-28800, 0))
+        // Skipped by the transition to daylight saving time
+        test(march12 + 2 * 3600, former: (-28800, 0), latter: (-28800, 3600))
+        test(march12 + 3 * 3600, former: (-28800, 3600), latter: (-28800, 3600))
+        // Repeated by the transition to standard time
+        test(november5 + 1 * 3600, former: (-28800, 3600), latter: (-28800, 0))
+        test(november5 + 2 * 3600, former: (-28800, 0), latter: (-28800, 0))
+    }
+
+    @Test func namedZones() throws {
+        let tz = try #require(_TimeZoneTZif(identifier: "America/Los_Angeles"))
+        #expect(tz.identifier == "America/Los_Angeles")
+        // 2023-03-12T09:59:59Z and 2023-03-12T10:00:00Z
+        #expect(tz.secondsFromGMT(for: Date(timeIntervalSince1970: 1678615199)) == -28800)
+        #expect(tz.secondsFromGMT(for: Date(timeIntervalSince1970: 1678615200)) == -25200)
+        #expect(tz.abbreviation(for: Date(timeIntervalSince1970: 1678615200)) == "PDT")
+        #expect(tz.isDaylightSavingTime(for: Date(timeIntervalSince1970: 1678615200)))
+        #expect(tz.nextDaylightSavingTimeTransition(after: Date(timeIntervalSince1970: 1678615200)) == Date(timeIntervalSince1970: 1699174800))
+        #expect(tz.fixedOffsetFromGMT == nil)
+
+        if tz.data != nil {
+            // History is only available from the time zone database. 1918-03-31T12:00:00Z was in the first
+            // nationwide daylight saving time in the US, and 1942-12-30T12:00:00Z in year-round war time.
+            let newYork = try #require(_TimeZoneTZif(identifier: "America/New_York"))
+            #expect(newYork.secondsFromGMT(for: Date(timeIntervalSince1970: -1633262400)) == -14400)
+            #expect(newYork.daylightSavingTimeOffset(for: Date(timeIntervalSince1970: -852206400)) == 3600)
+        }
+
+        for invalid in ["", "../../etc/passwd", "/etc/localtime", "America/Not_A_City"] {
+            #expect(_TimeZoneTZif(identifier: invalid) == nil, "\(invalid)")
+        }
+    }
+}
@@ -37,12 +37,13 @@ private struct FormatterCacheTests {
 
 
     @Test func createItem() {
-        let cache = FormatterCache<Int, Int>()
+        // A single shard, so that eviction order does not depend on how keys hash
+        let cache = FormatterCache<Int, Int>(countLimit: 100, shardCount: 1)
 
         var initializerBlockInvocationCount = 0
 
         // Fill up the cache until its `countLimit`
-        for i in 0...cache.countLimit {
+        for i in 0..<cache.countLimit {
             let item = cache.formatter(for: i) {
                 initializerBlockInvocationCount += 1
                 return -i
@@ -50,8 +51,8 @@ private struct FormatterCacheTests {
             #expect(item == -i)
         }
 
-        // `creator` block has been called 101 times
-        #expect(initializerBlockInvocationCount == cache.countLimit + 1)
+        // `creator` block has been called 100 times
+        #expect(initializerBlockInvocationCount == cache.countLimit)
 
         // `creator` block does not get executed when the key exists
         for i in 0..<initializerBlockInvocationCount {
@@ -69,11 +70,57 @@ private struct FormatterCacheTests {
             return -1000
         }
 
-        // cache has been cleared out; only the one we just filled in is present
-        for i in 0..<cache.countLimit {
-            #expect(cache[i] == nil)
+        // Only the least recently used item has been evicted
+        #expect(cache[0] == nil)
+        for i in 1..<cache.countLimit {
+            #expect(cache[i] == -i)
         }
         #expect(cache[1000] == item)
+        #expect(cache.metrics == .init(hits: cache.countLimit, misses: cache.countLimit + 1, evictions: 1))
+
+        // Looking up an item makes it the most recently used one
+        _ = cache.formatter(for: 1) { Int.max }
+        _ = cache.formatter(for: 2000) { -2000 }
+        #expect(cache[1] == -1)
+        #expect(cache[2] == nil)
+    }
+
+    @Test func workingSetWithinCountLimit() {
+        // However the keys are spread over the shards, a working set that fits the count limit is never evicted
+        let cache = FormatterCache<Int, Int>(countLimit: 100)
+        for _ in 0 ..< 3 {
+            for i in 0 ..< cache.countLimit {
+                #expect(cache.formatter(for: i * 7919) { -i } == -i)
+            }
+        }
+        #expect(cache.metrics == .init(hits: 2 * cache.countLimit, misses: cache.countLimit, evictions: 0))
+
+        // Once it is full, each new formatter evicts another one
+        _ = cache.formatter(for: -1) { 1 }
+        #expect(cache.metrics.evictions == 1)
+        #expect(cache[-1] == 1)
+    }
+
+    @Test func concurrentCreation() async {
+        final class CacheRef : Sendable {
+            let cache = FormatterCache<Int, Int>()
+        }
+
+        let cacheRef = CacheRef()
+
+        await withDiscardingTaskGroup { group in
+            for _ in 0 ..< 20 {
+                group.addTask {
+                    let cached = cacheRef.cache.formatter(for: 42) {
+                        -42
+                    }
+                    #expect(cached == -42)
+                }
+            }
+        }
+
+        // Lookups that arrive while the formatter is being created wait for it instead of creating another one
+        #expect(cacheRef.cache.metrics == .init(hits: 19, misses: 1, evictions: 0))
     }
 
     @Test(.timeLimit(.minutes(1)))
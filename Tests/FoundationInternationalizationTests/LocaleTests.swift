@@ -365,6 +365,22 @@ private struct LocaleTests {
     }
     #endif
 
+    @Test func resetCurrentIsVisibleToNextRead() async {
+        await usingCurrentInternationalizationPreferences {
+            var prefs = LocalePreferences()
+            prefs.languages = ["es-ES"]
+            prefs.locale = "es_ES"
+            LocaleCache.cache.resetCurrent(to: prefs)
+            #expect(Locale.current.identifier == "es_ES")
+
+            prefs.languages = ["en-US"]
+            prefs.locale = "en_US"
+            LocaleCache.cache.resetCurrent(to: prefs)
+            #expect(Locale.current.identifier == "en_US")
+            #expect(Locale.autoupdatingCurrent.identifier == "en_US")
+        }
+    }
+
     @Test func identifierCapturingPreferences() async {
         await usingCurrentInternationalizationPreferences {
             // This test requires that no additional Locale preferences be set for the current locale
@@ -248,6 +248,26 @@ private struct TimeZoneTests {
         return try jd.decode(TimeZone.self, from: data)
     }
     
+    @Test func resetsAreVisibleToNextRead() async {
+        await usingCurrentInternationalizationPreferences {
+            TimeZoneCache.cache.resetCurrent(to: TimeZone(identifier: "America/Los_Angeles")!)
+            #expect(TimeZone.current.identifier == "America/Los_Angeles")
+            #expect(TimeZoneCache.cache.default.identifier == "America/Los_Angeles")
+
+            // Both values are published now, so the reset has to replace them
+            TimeZoneCache.cache.resetCurrent(to: .gmt)
+            #expect(TimeZone.current.identifier == "GMT")
+            #expect(TimeZoneCache.cache.default.identifier == "GMT")
+
+            TimeZoneCache.cache.setDefault(TimeZone(identifier: "Asia/Tokyo")!)
+            #expect(TimeZoneCache.cache.default.identifier == "Asia/Tokyo")
+            #expect(TimeZone.current.identifier == "GMT")
+
+            TimeZoneCache.cache.setDefault(nil)
+            #expect(TimeZoneCache.cache.default.identifier == "GMT")
+        }
+    }
+
     @Test func serializationOfCurrent() async throws {
         try await usingCurrentInternationalizationPreferences {
             let current = TimeZone.current
@@ -434,6 +454,32 @@ private struct TimeZoneICUTests {
         try test("UTC+9:00", dc, expectedRawOffset: 32400, expectedDSTOffset: 0)
         try test("GMT+9", dc, expectedRawOffset: 32400, expectedDSTOffset: 0)
     }
+
+    @Test func offsetTable() throws {
+        // Offsets of dates between 1900 and 2100 come from the table, and the rest from the UTimeZone
+        let seeds = [
+            Date(timeIntervalSince1970: -2240524800), // 1899-01-01
+            Date(timeIntervalSince1970: -1633269600), // 1918-03-31T10:00:00Z
+            Date(timeIntervalSince1970: 1678615200), // 2023-03-12T10:00:00Z
+            Date(timeIntervalSince1970: 4099766400), // 2099-12-01
+        ]
+        for identifier in ["America/Los_Angeles", "Europe/Dublin", "Australia/Lord_Howe", "Asia/Kolkata"] {
+            let tz = try #require(_TimeZoneICU(identifier: identifier, preferringICUResource: false))
+            let truth = try _TimeZoneICUResource(identifier: identifier)
+            for seed in seeds {
+                for i in 0...2000 {
+                    let d = Date(timeInterval: Double(i * 1800), since: seed)
+                    #expect(tz.secondsFromGMT(for: d) == truth.secondsFromGMT(for: d), "\(identifier) at \(d.timeIntervalSince1970)")
+                    #expect(tz.daylightSavingTimeOffset(for: d) == truth.daylightSavingTimeOffset(for: d), "\(identifier) at \(d.timeIntervalSince1970)")
+                    #expect(tz.nextDaylightSavingTimeTransition(after: d) == truth.nextTransition(after: d), "\(identifier) at \(d.timeIntervalSince1970)")
+                }
+            }
+        }
+
+        // The next transition after the end of the table comes from the UTimeZone
+        let pacific = try #require(_TimeZoneICU(identifier: "America/Los_Angeles", preferringICUResource: false))
+        #expect(pacific.nextDaylightSavingTimeTransition(after: Date(timeIntervalSince1970: 4099766400)) == Date(timeIntervalSince1970: 4108701600))
+    }
 }
 
 @Suite("TimeZone_ICUResource", .tags(.timeZone))